@@ -21,33 +21,14 @@ void JDispatcher::registerNatives() {
   registerHybrid({makeNativeMethod("initHybrid", JDispatcher::initHybrid), makeNativeMethod("trigger", JDispatcher::trigger)});
 }
 
-void JDispatcher::scheduleTrigger() {
+void JDispatcher::scheduleDrain() {
+  // Only called once per batch, so we only cross JNI when the executor has to wake up.
   static const auto method = javaClassLocal()->getMethod<void()>("scheduleTrigger");
   method(_javaPart);
 }
 
 void JDispatcher::trigger() {
-  std::unique_lock lock(_mutex);
-  auto job = _jobs.front();
-  job();
-  _jobs.pop();
-}
-
-void JDispatcher::runAsync(std::function<void()>&& function) {
-  std::unique_lock lock(_mutex);
-  _jobs.push(std::move(function));
-  scheduleTrigger();
-}
-
-void JDispatcher::runSync(std::function<void()>&& function) {
-  // TODO: Don't use a mutex here, use a condition variable instead
-  _syncMutex.lock();
-  runAsync([this, function = std::move(function)]() {
-    function();
-    _syncMutex.unlock();
-  });
-  _syncMutex.lock();
-  _syncMutex.unlock();
+  drain();
 }
 
 } // namespace margelo
\ No newline at end of file
@@ -4,22 +4,20 @@
 
 #pragma once
 
-#include "threading/RNFDispatcher.h"
+#include "threading/RNFBatchingDispatcher.h"
 #include <fbjni/fbjni.h>
 
 namespace margelo {
 
 using namespace facebook;
 
-class JDispatcher : public jni::HybridClass<JDispatcher>, public Dispatcher {
+class JDispatcher : public jni::HybridClass<JDispatcher>, public BatchingDispatcher {
 public:
   ~JDispatcher();
   static void registerNatives();
 
-public:
-  void scheduleTrigger();
-  void runAsync(std::function<void()>&& function) override;
-  void runSync(std::function<void()>&& function) override;
+protected:
+  void scheduleDrain() override;
 
 private:
   void trigger();
@@ -28,11 +26,6 @@ private:
   friend HybridBase;
   jni::global_ref<JDispatcher::javaobject> _javaPart;
 
-private:
-  std::queue<std::function<void()>> _jobs;
-  std::recursive_mutex _mutex;
-  std::recursive_mutex _syncMutex;
-
 private:
   static auto constexpr TAG = "JDispatcher";
   static auto constexpr kJavaDescriptor = "Lcom/margelo/filament/Dispatcher;";
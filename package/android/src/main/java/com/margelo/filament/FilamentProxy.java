@@ -23,8 +23,6 @@ import com.facebook.react.turbomodule.core.interfaces.CallInvokerHolder;
 import com.facebook.react.uimanager.UIManagerHelper;
 
 import java.io.ByteArrayOutputStream;
-import java.io.File;
-import java.io.FileInputStream;
 import java.io.IOException;
 import java.io.InputStream;
 import java.nio.ByteBuffer;
@@ -120,20 +118,7 @@ class FilamentProxy {
     ByteBuffer loadAsset(String uriString) throws Exception {
         Log.i(NAME, "Loading byte data from URL: " + uriString + "...");
 
-        // It's a file path, read the file system directly
-        if (uriString.contains("file://")) {
-            String filePath = uriString.replace("file://", "");
-            File file = new File(filePath);
-            if (!file.exists()) {
-                throw new Exception("File does not exist: " + filePath);
-            }
-            try (FileInputStream stream = new FileInputStream(file)) {
-                return streamToDirectByteBuffer(stream);
-            } catch (Exception e) {
-                Log.e(NAME, "Failed to read file: " + filePath, e);
-                throw e;
-            }
-        }
+        // Note: Local files (file://) never get here, they are memory mapped in C++.
 
         // It's a URL/http resource
         if (uriString.contains("http://") || uriString.contains("https://")) {
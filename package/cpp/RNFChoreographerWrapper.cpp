@@ -13,10 +13,11 @@ ChoreographerWrapper::~ChoreographerWrapper() {
 }
 
 void ChoreographerWrapper::loadHybridMethods() {
-  registerHybridMethod("start", &ChoreographerWrapper::start, this);
-  registerHybridMethod("stop", &ChoreographerWrapper::stop, this);
-  registerHybridMethod("addFrameCallbackListener", &ChoreographerWrapper::addFrameCallbackListener, this);
-  registerHybridMethod("release", &ChoreographerWrapper::release, this, true);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("start", &ChoreographerWrapper::start);
+  registerHybridMethod("stop", &ChoreographerWrapper::stop);
+  registerHybridMethod("addFrameCallbackListener", &ChoreographerWrapper::addFrameCallbackListener);
+  registerHybridMethod("release", &ChoreographerWrapper::release, true);
 }
 
 void ChoreographerWrapper::start() {
@@ -23,6 +23,7 @@ public:
 protected:
   std::shared_ptr<Choreographer> getChoreographer();
   friend class FilamentView; // Allow filament view to access protected method
+  friend class BulletWrapper; // Physics clocks listen to the frames of the choreographer
 
 private: // Exposed JS API
   void start();
@@ -0,0 +1,103 @@
+#include "RNFChunkedBufferLoader.h"
+#include "RNFHeapManagedBuffer.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "RNFLogger.h"
+
+namespace margelo {
+
+FileChunkSource::FileChunkSource(const std::string& path) : _path(path) {
+  _fileDescriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (_fileDescriptor < 0) {
+    [[unlikely]];
+    throw std::runtime_error("Failed to open file \"" + path + "\": " + std::strerror(errno));
+  }
+
+  struct stat fileStat;
+  if (fstat(_fileDescriptor, &fileStat) != 0) {
+    [[unlikely]];
+    std::string error = std::strerror(errno);
+    close(_fileDescriptor);
+    throw std::runtime_error("Failed to read size of file \"" + path + "\": " + error);
+  }
+  _size = static_cast<size_t>(fileStat.st_size);
+}
+
+FileChunkSource::~FileChunkSource() {
+  close(_fileDescriptor);
+}
+
+size_t FileChunkSource::read(uint8_t* destination, size_t maxBytes) {
+  while (true) {
+    ssize_t bytesRead = ::read(_fileDescriptor, destination, maxBytes);
+    if (bytesRead >= 0) {
+      return static_cast<size_t>(bytesRead);
+    }
+    if (errno != EINTR) {
+      [[unlikely]];
+      throw std::runtime_error("Failed to read file \"" + _path + "\": " + std::strerror(errno));
+    }
+  }
+}
+
+ChunkedBufferLoader::ChunkedBufferLoader(std::unique_ptr<ChunkSource>&& source, size_t chunkSize, std::shared_ptr<Dispatcher> dispatcher)
+    : _source(std::move(source)), _chunkSize(chunkSize), _totalBytes(_source->getSize()), _dispatcher(dispatcher) {
+  if (_chunkSize == 0) {
+    [[unlikely]];
+    throw std::invalid_argument("The chunk size has to be greater than 0!");
+  }
+}
+
+std::future<std::shared_ptr<FilamentBuffer>> ChunkedBufferLoader::load() {
+  if (_isStarted.exchange(true)) {
+    [[unlikely]];
+    throw std::runtime_error("The ChunkedBufferLoader has already been started!");
+  }
+
+  // The load keeps this loader alive until it has finished, even if JS drops its reference to it.
+  std::shared_ptr<ChunkedBufferLoader> self = shared_from_this();
+  return _dispatcher->runAsyncAwaitable<std::shared_ptr<FilamentBuffer>>([self]() { return self->readChunks(); });
+}
+
+std::shared_ptr<Listener> ChunkedBufferLoader::addOnProgressListener(OnProgress&& onProgress) {
+  return _listeners->add(std::move(onProgress));
+}
+
+void ChunkedBufferLoader::cancel() {
+  Logger::log(TAG, "Cancelling load after %zu of %zu bytes...", getLoadedBytes(), _totalBytes);
+  _cancellationToken.cancel();
+}
+
+std::shared_ptr<FilamentBuffer> ChunkedBufferLoader::readChunks() {
+  // Freed automatically if the load is cancelled or fails half-way
+  std::unique_ptr<uint8_t[]> data(new uint8_t[_totalBytes]);
+  size_t loadedBytes = 0;
+  while (loadedBytes < _totalBytes) {
+    _cancellationToken.throwIfCancelled("The load has been cancelled after " + std::to_string(loadedBytes) + " of " +
+                                        std::to_string(_totalBytes) + " bytes!");
+
+    size_t bytesRead = _source->read(data.get() + loadedBytes, std::min(_chunkSize, _totalBytes - loadedBytes));
+    if (bytesRead == 0) {
+      [[unlikely]];
+      throw std::runtime_error("The source ended after " + std::to_string(loadedBytes) + " of " + std::to_string(_totalBytes) + " bytes!");
+    }
+    loadedBytes += bytesRead;
+    _loadedBytes.store(loadedBytes, std::memory_order_relaxed);
+
+    _listeners->forEach([loadedBytes, this](const OnProgress& onProgress) { onProgress(loadedBytes, _totalBytes); });
+  }
+
+  // Close the source now, the loader itself may stay around for as long as JS holds on to it
+  _source = nullptr;
+  auto managedBuffer = std::make_shared<HeapManagedBuffer>(std::move(data), _totalBytes);
+  return std::make_shared<FilamentBuffer>(managedBuffer);
+}
+
+} // namespace margelo
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "RNFFilamentBuffer.h"
+#include "RNFListener.h"
+#include "RNFListenerManager.h"
+#include "threading/RNFCancellationToken.h"
+#include "threading/RNFDispatcher.h"
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+
+namespace margelo {
+
+// A source of bytes that is read front to back, one chunk at a time.
+class ChunkSource {
+public:
+  virtual ~ChunkSource() {}
+  // The total amount of bytes this source provides.
+  virtual size_t getSize() const = 0;
+  // Reads up to `maxBytes` into `destination` and returns the amount of bytes read, 0 only at the end of the source.
+  virtual size_t read(uint8_t* destination, size_t maxBytes) = 0;
+};
+
+// Reads a local file.
+class FileChunkSource : public ChunkSource {
+public:
+  /**
+   * Opens the file at the given path (without a `file://` prefix). Throws if it cannot be opened.
+   */
+  explicit FileChunkSource(const std::string& path);
+  ~FileChunkSource() override;
+
+  size_t getSize() const override {
+    return _size;
+  }
+  size_t read(uint8_t* destination, size_t maxBytes) override;
+
+private:
+  std::string _path;
+  int _fileDescriptor;
+  size_t _size;
+};
+
+// Loads a ChunkSource into a FilamentBuffer on a background Dispatcher, one chunk at a time.
+// Between chunks it reports the progress to its listeners and checks whether the load has been cancelled,
+// in which case it stops reading and frees the partially loaded buffer.
+class ChunkedBufferLoader : public std::enable_shared_from_this<ChunkedBufferLoader> {
+public:
+  using OnProgress = std::function<void(size_t loadedBytes, size_t totalBytes)>;
+
+  static constexpr size_t DEFAULT_CHUNK_SIZE = 256 * 1024;
+
+  explicit ChunkedBufferLoader(std::unique_ptr<ChunkSource>&& source, size_t chunkSize, std::shared_ptr<Dispatcher> dispatcher);
+
+  /**
+   * Starts loading the source. Can only be called once.
+   * The future resolves with the loaded buffer, or rejects with a CancellationError if the load has been cancelled.
+   */
+  std::future<std::shared_ptr<FilamentBuffer>> load();
+
+  /**
+   * Adds a listener that is called on the loading Thread after every chunk.
+   */
+  std::shared_ptr<Listener> addOnProgressListener(OnProgress&& onProgress);
+
+  /**
+   * Cancels the load. The loading Thread stops before reading the next chunk.
+   */
+  void cancel();
+
+  size_t getLoadedBytes() const {
+    return _loadedBytes.load(std::memory_order_relaxed);
+  }
+  size_t getTotalBytes() const {
+    return _totalBytes;
+  }
+
+private:
+  std::shared_ptr<FilamentBuffer> readChunks();
+
+private:
+  std::unique_ptr<ChunkSource> _source;
+  size_t _chunkSize;
+  size_t _totalBytes;
+  std::shared_ptr<Dispatcher> _dispatcher;
+  std::shared_ptr<ListenerManager<OnProgress>> _listeners = ListenerManager<OnProgress>::create();
+  CancellationToken _cancellationToken;
+  std::atomic<bool> _isStarted{false};
+  std::atomic<size_t> _loadedBytes{0};
+
+private:
+  static constexpr auto TAG = "ChunkedBufferLoader";
+};
+
+} // namespace margelo
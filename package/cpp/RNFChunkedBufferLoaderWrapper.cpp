@@ -0,0 +1,61 @@
+#include "RNFChunkedBufferLoaderWrapper.h"
+#include "jsi/RNFJSIConverter.h"
+
+namespace margelo {
+
+void ChunkedBufferLoaderWrapper::loadHybridMethods() {
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("load", &ChunkedBufferLoaderWrapper::load);
+  registerHybridMethod("addOnProgressListener", &ChunkedBufferLoaderWrapper::addOnProgressListener);
+  registerHybridMethod("cancel", &ChunkedBufferLoaderWrapper::cancel);
+  registerHybridGetter("loadedBytes", &ChunkedBufferLoaderWrapper::getLoadedBytes);
+  registerHybridGetter("totalBytes", &ChunkedBufferLoaderWrapper::getTotalBytes);
+}
+
+std::future<std::shared_ptr<FilamentBuffer>> ChunkedBufferLoaderWrapper::load() {
+  return pointee()->load();
+}
+
+jsi::Value ChunkedBufferLoaderWrapper::addOnProgressListener(jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args,
+                                                             size_t count) {
+  if (count != 1) {
+    [[unlikely]];
+    throw jsi::JSError(runtime, "addOnProgressListener(..) expects 1 argument, but received " + std::to_string(count) + "!");
+  }
+
+  // Progress is reported on the loading Thread, so we call the JS callback on the Thread of the Runtime that added the listener.
+  // The callback also has to be deleted on that Thread, as it holds a jsi::Function.
+  using ProgressCallback = std::function<void(double, double)>;
+  std::shared_ptr<Dispatcher> dispatcher = Dispatcher::getRuntimeGlobalDispatcher(runtime);
+  auto callbackPtr = new ProgressCallback(JSIConverter<ProgressCallback>::fromJSI(runtime, args[0]));
+  auto callback =
+      std::shared_ptr<ProgressCallback>(callbackPtr, [dispatcher](ProgressCallback* ptr) { dispatcher->runAsync([ptr]() { delete ptr; }); });
+
+  std::shared_ptr<Listener> listener = pointee()->addOnProgressListener([callback, dispatcher](size_t loadedBytes, size_t totalBytes) {
+    dispatcher->runAsync([callback, loadedBytes, totalBytes]() {
+      (*callback)(static_cast<double>(loadedBytes), static_cast<double>(totalBytes));
+    });
+  });
+  return JSIConverter<std::shared_ptr<Listener>>::toJSI(runtime, listener);
+}
+
+void ChunkedBufferLoaderWrapper::cancel() {
+  pointee()->cancel();
+}
+
+double ChunkedBufferLoaderWrapper::getLoadedBytes() {
+  return static_cast<double>(pointee()->getLoadedBytes());
+}
+
+double ChunkedBufferLoaderWrapper::getTotalBytes() {
+  return static_cast<double>(pointee()->getTotalBytes());
+}
+
+void ChunkedBufferLoaderWrapper::release() {
+  if (getIsValid()) {
+    pointee()->cancel();
+  }
+  PointerHolder::release();
+}
+
+} // namespace margelo
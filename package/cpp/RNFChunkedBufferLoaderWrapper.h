@@ -0,0 +1,31 @@
+#pragma once
+
+#include "RNFChunkedBufferLoader.h"
+#include "jsi/RNFPointerHolder.h"
+
+#include <jsi/jsi.h>
+
+namespace margelo {
+
+using namespace facebook;
+
+class ChunkedBufferLoaderWrapper : public PointerHolder<ChunkedBufferLoader> {
+public:
+  explicit ChunkedBufferLoaderWrapper(std::shared_ptr<ChunkedBufferLoader> loader) : PointerHolder(TAG, loader) {}
+
+  void loadHybridMethods() override;
+
+private: // Exposed JS API
+  std::future<std::shared_ptr<FilamentBuffer>> load();
+  jsi::Value addOnProgressListener(jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* args, size_t count);
+  void cancel();
+  double getLoadedBytes();
+  double getTotalBytes();
+  // Releasing the loader (e.g. when a screen unmounts) also cancels its load
+  void release() override;
+
+private:
+  static constexpr auto TAG = "ChunkedBufferLoaderWrapper";
+};
+
+} // namespace margelo
@@ -5,6 +5,7 @@
 #include "RNFFilamentProxy.h"
 #include <jsi/jsi.h>
 
+#include "RNFMappedFileBuffer.h"
 #include "RNFReferences.h"
 #include "core/RNFEngineBackendEnum.h"
 #include "core/RNFEngineConfigHelper.h"
@@ -21,17 +22,18 @@ namespace margelo {
 using namespace facebook;
 
 void FilamentProxy::loadHybridMethods() {
-  registerHybridMethod("loadAsset", &FilamentProxy::loadAssetAsync, this);
-  registerHybridMethod("findFilamentView", &FilamentProxy::findFilamentViewAsync, this);
-  registerHybridMethod("createTestObject", &FilamentProxy::createTestObject, this);
-  registerHybridMethod("createEngine", &FilamentProxy::createEngine, this);
-  registerHybridMethod("createBullet", &FilamentProxy::createBullet, this);
-  registerHybridMethod("createChoreographer", &FilamentProxy::createChoreographerWrapper, this);
-  registerHybridMethod("createRecorder", &FilamentProxy::createRecorder, this);
-  registerHybridMethod("getCurrentDispatcher", &FilamentProxy::getCurrentDispatcher, this);
-  registerHybridGetter("hasWorklets", &FilamentProxy::getHasWorklets, this);
+  registerHybridMethod("loadAsset", &FilamentProxy::loadAssetAsync);
+  registerHybridMethod("createBufferLoader", &FilamentProxy::createBufferLoader);
+  registerHybridMethod("findFilamentView", &FilamentProxy::findFilamentViewAsync);
+  registerHybridMethod("createTestObject", &FilamentProxy::createTestObject);
+  registerHybridMethod("createEngine", &FilamentProxy::createEngine);
+  registerHybridMethod("createBullet", &FilamentProxy::createBullet);
+  registerHybridMethod("createChoreographer", &FilamentProxy::createChoreographerWrapper);
+  registerHybridMethod("createRecorder", &FilamentProxy::createRecorder);
+  registerHybridMethod("getCurrentDispatcher", &FilamentProxy::getCurrentDispatcher);
+  registerHybridGetter("hasWorklets", &FilamentProxy::getHasWorklets);
 #if HAS_WORKLETS
-  registerHybridMethod("createWorkletContext", &FilamentProxy::createWorkletContext, this);
+  registerHybridMethod("createWorkletContext", &FilamentProxy::createWorkletContext);
 #endif
 }
 
@@ -73,14 +75,34 @@ std::future<std::shared_ptr<FilamentBuffer>> FilamentProxy::loadAssetAsync(const
   auto dispatcher = getBackgroundDispatcher();
   return dispatcher->runAsyncAwaitable<std::shared_ptr<FilamentBuffer>>([weakThis, path]() {
     auto sharedThis = weakThis.lock();
-    if (sharedThis != nullptr) {
-      return sharedThis->loadAsset(path);
-    } else {
+    if (sharedThis == nullptr) {
       throw std::runtime_error("Failed to load asset, FilamentProxy has already been destroyed!");
     }
+    if (path.rfind(FILE_URI_PREFIX, 0) == 0) {
+      // Local files are memory mapped on all platforms instead of being read into memory
+      auto managedBuffer = std::make_shared<MappedFileBuffer>(path.substr(FILE_URI_PREFIX.size()));
+      return std::make_shared<FilamentBuffer>(managedBuffer);
+    }
+    return sharedThis->loadAsset(path);
   });
 }
 
+std::shared_ptr<ChunkedBufferLoaderWrapper> FilamentProxy::createBufferLoader(const std::string& path, std::optional<int> chunkSize) {
+  if (path.rfind(FILE_URI_PREFIX, 0) != 0) {
+    [[unlikely]];
+    throw std::invalid_argument("Chunked loading is only supported for local files (file://), but received \"" + path + "\"!");
+  }
+  if (chunkSize.has_value() && chunkSize.value() < 1) {
+    [[unlikely]];
+    throw std::invalid_argument("chunkSize must be greater than 0, but was " + std::to_string(chunkSize.value()) + "!");
+  }
+
+  auto source = std::make_unique<FileChunkSource>(path.substr(FILE_URI_PREFIX.size()));
+  size_t chunkSizeBytes = chunkSize.has_value() ? static_cast<size_t>(chunkSize.value()) : ChunkedBufferLoader::DEFAULT_CHUNK_SIZE;
+  auto loader = std::make_shared<ChunkedBufferLoader>(std::move(source), chunkSizeBytes, getBackgroundDispatcher());
+  return std::make_shared<ChunkedBufferLoaderWrapper>(loader);
+}
+
 std::future<std::shared_ptr<FilamentView>> FilamentProxy::findFilamentViewAsync(int id) {
   Logger::log(TAG, "Finding FilamentView #%i...", id);
   auto weakThis = std::weak_ptr<FilamentProxy>(shared<FilamentProxy>());
@@ -97,7 +119,7 @@ std::future<std::shared_ptr<FilamentView>> FilamentProxy::findFilamentViewAsync(
 
 std::shared_ptr<TestHybridObject> FilamentProxy::createTestObject() {
   Logger::log(TAG, "Creating TestObject...");
-  return std::make_shared<TestHybridObject>();
+  return std::make_shared<TestHybridObject>(getBackgroundDispatcher());
 }
 
 std::shared_ptr<EngineWrapper> FilamentProxy::createEngine(std::optional<std::string> backend,
@@ -137,7 +159,7 @@ std::shared_ptr<EngineWrapper> FilamentProxy::createEngine(std::optional<std::st
 
 std::shared_ptr<BulletWrapper> FilamentProxy::createBullet() {
   Logger::log(TAG, "Creating Bullet...");
-  return std::make_shared<BulletWrapper>();
+  return std::make_shared<BulletWrapper>(getBackgroundDispatcher());
 }
 
 jsi::Value FilamentProxy::createChoreographerWrapper(jsi::Runtime& runtime, const jsi::Value&, const jsi::Value*, size_t) {
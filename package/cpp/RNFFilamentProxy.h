@@ -8,10 +8,12 @@
 
 #include <future>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "RNFChoreographer.h"
 #include "RNFChoreographerWrapper.h"
+#include "RNFChunkedBufferLoaderWrapper.h"
 #include "RNFFilamentBuffer.h"
 #include "RNFFilamentRecorder.h"
 #include "RNFFilamentView.h"
@@ -43,6 +45,7 @@ public:
 
 private:
   // Platform-specific implementations
+  // Loads web URLs and bundled assets. Local files (`file://`) are memory mapped by the FilamentProxy itself.
   virtual std::shared_ptr<FilamentBuffer> loadAsset(const std::string& path) = 0;
   virtual std::shared_ptr<FilamentView> findFilamentView(int id) = 0;
   virtual std::shared_ptr<Choreographer> createChoreographer() = 0;
@@ -84,6 +87,7 @@ private:
 
   // Public API
   std::future<std::shared_ptr<FilamentBuffer>> loadAssetAsync(const std::string& path);
+  std::shared_ptr<ChunkedBufferLoaderWrapper> createBufferLoader(const std::string& path, std::optional<int> chunkSize);
   std::future<std::shared_ptr<FilamentView>> findFilamentViewAsync(int id);
   std::shared_ptr<EngineWrapper> createEngine(std::optional<std::string> backend = std::nullopt,
                                               std::optional<std::unordered_map<std::string, int>> arguments = std::nullopt);
@@ -109,6 +113,7 @@ public:
 
 private:
   static constexpr auto TAG = "FilamentProxy";
+  static constexpr std::string_view FILE_URI_PREFIX = "file://";
 
 public:
   void loadHybridMethods() override;
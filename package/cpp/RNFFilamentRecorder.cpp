@@ -20,16 +20,16 @@ FilamentRecorder::~FilamentRecorder() {
 }
 
 void FilamentRecorder::loadHybridMethods() {
-  registerHybridGetter("width", &FilamentRecorder::getWidth, this);
-  registerHybridGetter("height", &FilamentRecorder::getHeight, this);
-  registerHybridGetter("fps", &FilamentRecorder::getFps, this);
-  registerHybridGetter("bitRate", &FilamentRecorder::getBitRate, this);
-  registerHybridGetter("outputFile", &FilamentRecorder::getOutputFile, this);
-  registerHybridGetter("isRecording", &FilamentRecorder::getIsRecording, this);
-  registerHybridMethod("startRecording", &FilamentRecorder::startRecording, this);
-  registerHybridMethod("stopRecording", &FilamentRecorder::stopRecording, this);
-  registerHybridMethod("renderFrame", &FilamentRecorder::renderFrame, this);
-  registerHybridMethod("addOnReadyForMoreDataListener", &FilamentRecorder::addOnReadyForMoreDataListener, this);
+  registerHybridGetter("width", &FilamentRecorder::getWidth);
+  registerHybridGetter("height", &FilamentRecorder::getHeight);
+  registerHybridGetter("fps", &FilamentRecorder::getFps);
+  registerHybridGetter("bitRate", &FilamentRecorder::getBitRate);
+  registerHybridGetter("outputFile", &FilamentRecorder::getOutputFile);
+  registerHybridGetter("isRecording", &FilamentRecorder::getIsRecording);
+  registerHybridMethod("startRecording", &FilamentRecorder::startRecording);
+  registerHybridMethod("stopRecording", &FilamentRecorder::stopRecording);
+  registerHybridMethod("renderFrame", &FilamentRecorder::renderFrame);
+  registerHybridMethod("addOnReadyForMoreDataListener", &FilamentRecorder::addOnReadyForMoreDataListener);
 }
 
 std::shared_ptr<Listener> FilamentRecorder::addOnReadyForMoreDataListener(ReadyForMoreDataCallback callback) {
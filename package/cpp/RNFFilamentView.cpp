@@ -15,8 +15,8 @@ FilamentView::~FilamentView() {
 }
 
 void FilamentView::loadHybridMethods() {
-  registerHybridMethod("getSurfaceProvider", &FilamentView::getSurfaceProvider, this);
-  registerHybridMethod("setChoreographer", &FilamentView::setChoreographer, this);
+  registerHybridMethod("getSurfaceProvider", &FilamentView::getSurfaceProvider);
+  registerHybridMethod("setChoreographer", &FilamentView::setChoreographer);
 }
 
 void FilamentView::setChoreographer(std::optional<std::shared_ptr<ChoreographerWrapper>> choreographerWrapperOrNull) {
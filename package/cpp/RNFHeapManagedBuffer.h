@@ -0,0 +1,32 @@
+#pragma once
+
+#include "RNFManagedBuffer.h"
+
+#include <memory>
+
+namespace margelo {
+
+// A buffer on the native heap, e.g. one that has been filled by the ChunkedBufferLoader.
+class HeapManagedBuffer : public ManagedBuffer {
+public:
+  explicit HeapManagedBuffer(std::unique_ptr<uint8_t[]>&& data, size_t size) : _data(std::move(data)), _size(size) {}
+
+  const uint8_t* getData() const override {
+    return _data.get();
+  }
+
+  size_t getSize() const override {
+    return _size;
+  }
+
+  void release() override {
+    _data = nullptr;
+    _size = 0;
+  }
+
+private:
+  std::unique_ptr<uint8_t[]> _data;
+  size_t _size;
+};
+
+} // namespace margelo
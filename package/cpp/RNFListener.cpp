@@ -17,7 +17,7 @@ Listener::~Listener() {
 }
 
 void Listener::loadHybridMethods() {
-  registerHybridMethod("remove", &Listener::remove, this);
+  registerHybridMethod("remove", &Listener::remove);
 }
 
 void Listener::remove() {
@@ -0,0 +1,76 @@
+#include "RNFMappedFileBuffer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <memory>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "RNFLogger.h"
+
+namespace margelo {
+
+static std::runtime_error makeError(const std::string& message, const std::string& path) {
+  return std::runtime_error(message + " \"" + path + "\": " + std::strerror(errno));
+}
+
+MappedFileBuffer::MappedFileBuffer(const std::string& path) {
+  int fileDescriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fileDescriptor < 0) {
+    [[unlikely]];
+    throw makeError("Failed to open file", path);
+  }
+
+  struct stat fileStat;
+  if (fstat(fileDescriptor, &fileStat) != 0) {
+    [[unlikely]];
+    auto error = makeError("Failed to read size of file", path);
+    close(fileDescriptor);
+    throw error;
+  }
+  if (fileStat.st_size <= 0) {
+    [[unlikely]];
+    // A zero length mapping is invalid, and no consumer can do anything with an empty file anyways.
+    close(fileDescriptor);
+    throw std::runtime_error("Cannot load file \"" + path + "\": The file is empty!");
+  }
+  _size = static_cast<size_t>(fileStat.st_size);
+
+  void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  if (data == MAP_FAILED) {
+    [[unlikely]];
+    auto error = makeError("Failed to map file", path);
+    close(fileDescriptor);
+    throw error;
+  }
+  _data = static_cast<uint8_t*>(data);
+
+  // The file is parsed right after loading, so start reading it in now. This is only a hint, failing to apply it is not an error.
+  madvise(_data, _size, MADV_WILLNEED);
+  // The mapping stays valid after the file descriptor is closed
+  close(fileDescriptor);
+
+  Logger::log(TAG, "Mapped %zu bytes of \"%s\"", _size, path.c_str());
+}
+
+MappedFileBuffer::~MappedFileBuffer() {
+  unmap();
+}
+
+void MappedFileBuffer::release() {
+  unmap();
+}
+
+void MappedFileBuffer::unmap() {
+  if (_data == nullptr) {
+    return;
+  }
+  munmap(_data, _size);
+  _data = nullptr;
+  _size = 0;
+}
+
+} // namespace margelo
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "RNFManagedBuffer.h"
+
+#include <string>
+
+namespace margelo {
+
+// A read-only, memory mapped local file.
+// The file's pages are only backed by the OS page cache, so loading them does not keep a second copy on the heap
+// (as reading the file into a byte array and copying it into a direct buffer would), and the OS can reclaim them at any time.
+class MappedFileBuffer : public ManagedBuffer {
+public:
+  /**
+   * Maps the file at the given path (without a `file://` prefix) into memory.
+   * Throws if the file does not exist, is empty or cannot be mapped.
+   */
+  explicit MappedFileBuffer(const std::string& path);
+  ~MappedFileBuffer() override;
+
+  const uint8_t* getData() const override {
+    return _data;
+  }
+
+  size_t getSize() const override {
+    return _size;
+  }
+
+  void release() override;
+
+private:
+  void unmap();
+
+private:
+  uint8_t* _data = nullptr;
+  size_t _size = 0;
+
+private:
+  static constexpr auto TAG = "MappedFileBuffer";
+};
+
+} // namespace margelo
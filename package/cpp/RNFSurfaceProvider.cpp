@@ -8,9 +8,9 @@
 namespace margelo {
 
 void SurfaceProvider::loadHybridMethods() {
-  registerHybridMethod("getSurface", &SurfaceProvider::getSurface, this);
-  registerHybridMethod("addOnSurfaceCreatedListener", &SurfaceProvider::addOnSurfaceCreatedListener, this);
-  registerHybridMethod("addOnSurfaceDestroyedListener", &SurfaceProvider::addOnSurfaceDestroyedListener, this);
+  registerHybridMethod("getSurface", &SurfaceProvider::getSurface);
+  registerHybridMethod("addOnSurfaceCreatedListener", &SurfaceProvider::addOnSurfaceCreatedListener);
+  registerHybridMethod("addOnSurfaceDestroyedListener", &SurfaceProvider::addOnSurfaceDestroyedListener);
 }
 
 std::shared_ptr<Listener> SurfaceProvider::addOnSurfaceChangedListener(SurfaceProvider::Callbacks&& callbacks) {
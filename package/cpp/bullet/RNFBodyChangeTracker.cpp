@@ -0,0 +1,67 @@
+#include "RNFBodyChangeTracker.h"
+
+namespace margelo {
+
+void BodyChangeTracker::collect(btAlignedObjectArray<btRigidBody*>& nonStaticBodies) {
+  for (int i = 0; i < nonStaticBodies.size(); i++) {
+    btRigidBody* body = nonStaticBodies[i];
+    // Only active bodies are integrated and get their motion state updated
+    if (body->isActive() || body->getActivationState() != body->getUserIndex2()) {
+      markChanged(body);
+    }
+  }
+}
+
+void BodyChangeTracker::markChanged(btRigidBody* body) {
+  body->setUserIndex2(body->getActivationState());
+  if (body->getUserIndex3() != NOT_PENDING || body->getUserIndex() < 0) {
+    return;
+  }
+  body->setUserIndex3(static_cast<int>(_changedBodies.size()));
+  _changedBodies.push_back(body);
+}
+
+void BodyChangeTracker::forget(btRigidBody* body) {
+  int position = body->getUserIndex3();
+  if (position != NOT_PENDING) {
+    // Swap with the last pending body, the order of the changes doesn't matter
+    btRigidBody* last = _changedBodies.back();
+    _changedBodies[position] = last;
+    last->setUserIndex3(position);
+    _changedBodies.pop_back();
+  }
+  body->setUserIndex2(-1);
+  body->setUserIndex3(NOT_PENDING);
+}
+
+std::shared_ptr<TypedArray<double>> BodyChangeTracker::takeChanges() {
+  auto changes = std::make_shared<TypedArray<double>>(_changedBodies.size() * CHANGE_STRIDE);
+  for (size_t i = 0; i < _changedBodies.size(); i++) {
+    _changedBodies[i]->setUserIndex3(NOT_PENDING);
+    write(changes->elements() + i * CHANGE_STRIDE, _changedBodies[i]);
+  }
+  _changedBodies.clear();
+  return changes;
+}
+
+void BodyChangeTracker::write(double* change, const btRigidBody* body) {
+  btTransform transform;
+  if (body->getMotionState() != nullptr) {
+    body->getMotionState()->getWorldTransform(transform);
+  } else {
+    transform = body->getWorldTransform();
+  }
+  const btVector3& origin = transform.getOrigin();
+  btQuaternion rotation = transform.getRotation();
+  change[0] = body->getUserIndex();
+  change[1] = body->getActivationState();
+  change[2] = origin.x();
+  change[3] = origin.y();
+  change[4] = origin.z();
+  change[5] = rotation.x();
+  change[6] = rotation.y();
+  change[7] = rotation.z();
+  change[8] = rotation.w();
+}
+
+} // namespace margelo
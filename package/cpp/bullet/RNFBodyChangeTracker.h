@@ -0,0 +1,59 @@
+#pragma once
+
+#include "jsi/RNFTypedArray.h"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <memory>
+#include <vector>
+
+namespace margelo {
+
+// Remembers which bodies moved or changed their activation state since the changes were last taken, so JS only has to
+// read the transforms of those. Most bodies come to rest quickly, and sleeping bodies are skipped after reporting them once.
+// Bodies are identified by the id stored in their `btCollisionObject::getUserIndex()`. The tracker also uses the bodies'
+// user index 2 (the activation state last seen) and user index 3 (the body's position in the pending list, or -1).
+// The changes are packed into a single Float64Array, `CHANGE_STRIDE` numbers per body:
+// [bodyId, activationState, x, y, z, rotationX, rotationY, rotationZ, rotationW]
+// with the transform of the body's motion state, which is interpolated between fixed steps.
+class BodyChangeTracker {
+public:
+  static constexpr size_t CHANGE_STRIDE = 9;
+
+  /**
+   * Marks the bodies that were simulated in the step that just finished, or whose activation state changed.
+   */
+  void collect(btAlignedObjectArray<btRigidBody*>& nonStaticBodies);
+
+  /**
+   * Marks the body as changed, e.g. because it was just added to the world or moved outside of a step.
+   */
+  void markChanged(btRigidBody* body);
+
+  /**
+   * Stops tracking the body and drops its pending change, must be called before it is removed from the world.
+   */
+  void forget(btRigidBody* body);
+
+  /**
+   * Returns the changes since the last call.
+   */
+  std::shared_ptr<TypedArray<double>> takeChanges();
+
+  size_t getPendingCount() const {
+    return _changedBodies.size();
+  }
+
+private:
+  // Bullet initializes the user indices to -1
+  static constexpr int NOT_PENDING = -1;
+
+private:
+  static void write(double* change, const btRigidBody* body);
+
+private:
+  // Only bodies that are still in the world, as forget() removes them, so this can't outgrow the world if never taken
+  std::vector<btRigidBody*> _changedBodies;
+};
+
+} // namespace margelo
@@ -10,8 +10,8 @@ namespace margelo {
 
 class BoxShapeWrapper : public ShapeWrapper {
 public:
-  explicit BoxShapeWrapper(double x, double y, double z)
-      : ShapeWrapper("BoxShapeWrapper", std::make_shared<btBoxShape>(btVector3(x, y, z))) {}
+  explicit BoxShapeWrapper(std::shared_ptr<ShapeCache> shapeCache, double x, double y, double z)
+      : ShapeWrapper("BoxShapeWrapper", shapeCache, ShapeCache::Key{ShapeCache::ShapeType::Box, {x, y, z, 0}}) {}
 };
 
 } // namespace margelo
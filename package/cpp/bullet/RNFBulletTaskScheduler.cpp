@@ -0,0 +1,142 @@
+#include "RNFBulletTaskScheduler.h"
+#include "RNFLogger.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace margelo {
+
+BulletTaskScheduler::BulletTaskScheduler(int threadsCount) : btITaskScheduler("RNFWorkerPool") {
+  if (threadsCount < 1 || threadsCount > static_cast<int>(BT_MAX_THREAD_COUNT)) {
+    [[unlikely]];
+    throw std::invalid_argument("Bullet can use between 1 and " + std::to_string(BT_MAX_THREAD_COUNT) + " threads, but " +
+                                std::to_string(threadsCount) + " were requested!");
+  }
+  Logger::log(TAG, "Using %i threads...", threadsCount);
+  _workerPool = std::make_unique<WorkerPool>("RNF.Bullet", static_cast<size_t>(threadsCount - 1));
+}
+
+std::shared_ptr<BulletTaskScheduler>& BulletTaskScheduler::getSharedInstance() {
+  static std::shared_ptr<BulletTaskScheduler> shared;
+  return shared;
+}
+
+std::shared_ptr<BulletTaskScheduler> BulletTaskScheduler::getShared(int threadsCount) {
+  std::unique_lock lock(getGlobalMutex());
+  std::shared_ptr<BulletTaskScheduler>& shared = getSharedInstance();
+  if (shared == nullptr) {
+    shared = std::shared_ptr<BulletTaskScheduler>(new BulletTaskScheduler(threadsCount));
+  } else if (threadsCount != shared->getNumThreads()) {
+    [[unlikely]];
+    throw std::invalid_argument("Cannot create a multithreaded world with " + std::to_string(threadsCount) +
+                                " threads - all multithreaded worlds share the threads of the first one, which uses " +
+                                std::to_string(shared->getNumThreads()) + " threads!");
+  }
+  return shared;
+}
+
+std::optional<int> BulletTaskScheduler::getSharedThreadsCount() {
+  std::unique_lock lock(getGlobalMutex());
+  std::shared_ptr<BulletTaskScheduler>& shared = getSharedInstance();
+  if (shared == nullptr) {
+    return std::nullopt;
+  }
+  return shared->getNumThreads();
+}
+
+BulletTaskScheduler::~BulletTaskScheduler() {
+  std::unique_lock lock(getGlobalMutex());
+  if (btGetTaskScheduler() == this) {
+    // Bullet deactivates the previous scheduler when installing the next one, so it must not keep pointing to us
+    btSetTaskScheduler(btGetSequentialTaskScheduler());
+    if (btGetTaskScheduler() == this) {
+      [[unlikely]];
+      Logger::log(TAG, "Failed to uninstall the Bullet task scheduler, it was destroyed on a different Thread than it was installed on!");
+    }
+  }
+}
+
+int BulletTaskScheduler::getMaxNumThreads() const {
+  // Bullet sizes per-thread storage (e.g. in btCollisionDispatcherMt) with this, and indexes it with the global index
+  // of the calling Thread (btGetCurrentThreadIndex), not the index within this scheduler.
+  return BT_MAX_THREAD_COUNT;
+}
+
+int BulletTaskScheduler::getNumThreads() const {
+  // The calling Thread takes part in every loop
+  return static_cast<int>(_workerPool->getThreadsCount()) + 1;
+}
+
+void BulletTaskScheduler::setNumThreads(int threadsCount) {
+  // The Threads are shared by all worlds and must stay the same, see getShared
+  if (threadsCount != getNumThreads()) {
+    Logger::log(TAG, "Ignoring the request to use %i threads, the shared task scheduler keeps using %i threads.", threadsCount,
+                getNumThreads());
+  }
+}
+
+size_t BulletTaskScheduler::getChunksCount(int iBegin, int iEnd, int grainSize) const {
+  int count = iEnd - iBegin;
+  if (count <= 0) {
+    return 0;
+  }
+  // Fewer, larger chunks when there are only a few Threads, as each chunk costs an atomic fetch
+  int chunkSize = std::max(grainSize, count / (getNumThreads() * 4));
+  chunkSize = std::max(chunkSize, 1);
+  return static_cast<size_t>((count + chunkSize - 1) / chunkSize);
+}
+
+void BulletTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) {
+  size_t chunksCount = getChunksCount(iBegin, iEnd, grainSize);
+  if (chunksCount <= 1) {
+    body.forLoop(iBegin, iEnd);
+    return;
+  }
+  int count = iEnd - iBegin;
+  _workerPool->parallelFor(chunksCount, [&](size_t chunk) {
+    int begin = iBegin + static_cast<int>(static_cast<int64_t>(count) * chunk / chunksCount);
+    int end = iBegin + static_cast<int>(static_cast<int64_t>(count) * (chunk + 1) / chunksCount);
+    body.forLoop(begin, end);
+  });
+}
+
+btScalar BulletTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) {
+  size_t chunksCount = getChunksCount(iBegin, iEnd, grainSize);
+  if (chunksCount <= 1) {
+    return body.sumLoop(iBegin, iEnd);
+  }
+  int count = iEnd - iBegin;
+  std::vector<btScalar> sums(chunksCount, btScalar(0));
+  _workerPool->parallelFor(chunksCount, [&](size_t chunk) {
+    int begin = iBegin + static_cast<int>(static_cast<int64_t>(count) * chunk / chunksCount);
+    int end = iBegin + static_cast<int>(static_cast<int64_t>(count) * (chunk + 1) / chunksCount);
+    sums[chunk] = body.sumLoop(begin, end);
+  });
+  // Summed in chunk order, so the result does not depend on which Thread finished first
+  btScalar sum = 0;
+  for (btScalar chunkSum : sums) {
+    sum += chunkSum;
+  }
+  return sum;
+}
+
+void BulletTaskScheduler::install() {
+  if (btGetTaskScheduler() == this) {
+    return;
+  }
+  btSetTaskScheduler(this);
+  if (btGetTaskScheduler() != this) {
+    [[unlikely]];
+    throw std::runtime_error("Failed to install the Bullet task scheduler! Multithreaded worlds have to be created and stepped on the "
+                             "first Thread that used Bullet's threading APIs.");
+  }
+}
+
+std::mutex& BulletTaskScheduler::getGlobalMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+} // namespace margelo
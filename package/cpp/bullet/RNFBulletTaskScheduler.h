@@ -0,0 +1,66 @@
+#pragma once
+
+#include "threading/RNFWorkerPool.h"
+
+#include <LinearMath/btThreads.h>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace margelo {
+
+// A Bullet task scheduler that runs Bullet's parallel loops (collision dispatch, island solving, batched constraints)
+// on our own WorkerPool, so we don't depend on Bullet's optional OpenMP/TBB/PPL schedulers.
+// Bullet only has one global scheduler, and gives every Thread that takes part in a parallel loop its own index (below
+// BT_MAX_THREAD_COUNT) that is never reused. So all multithreaded worlds share one scheduler with a fixed set of Threads.
+class BulletTaskScheduler : public btITaskScheduler {
+public:
+  ~BulletTaskScheduler() override;
+
+  /**
+   * Returns the scheduler shared by all multithreaded worlds, which is created with `threadsCount` Threads on first use
+   * and then kept for the lifetime of the process. Throws if it already exists with a different number of Threads.
+   */
+  static std::shared_ptr<BulletTaskScheduler> getShared(int threadsCount);
+
+  /**
+   * Returns the number of Threads of the shared scheduler, or `std::nullopt` if no multithreaded world was created yet.
+   */
+  static std::optional<int> getSharedThreadsCount();
+
+  int getMaxNumThreads() const override;
+  int getNumThreads() const override;
+  void setNumThreads(int threadsCount) override;
+  void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) override;
+  btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) override;
+
+  /**
+   * Installs this scheduler as Bullet's global task scheduler. Call while holding `getGlobalMutex()`.
+   * Bullet only allows that from the first Thread that used Bullet's threading APIs, this throws on any other Thread.
+   */
+  void install();
+
+  /**
+   * Guards Bullet's global task scheduler: Hold it while installing a scheduler and using it (e.g. while stepping a world).
+   */
+  static std::mutex& getGlobalMutex();
+
+private:
+  explicit BulletTaskScheduler(int threadsCount);
+
+  // Never released, a new scheduler would start new Threads which would use up more of Bullet's Thread indices.
+  // Only accessed while holding `getGlobalMutex()`.
+  static std::shared_ptr<BulletTaskScheduler>& getSharedInstance();
+
+  // Splits [iBegin, iEnd) into chunks of at least `grainSize` and returns their count
+  size_t getChunksCount(int iBegin, int iEnd, int grainSize) const;
+
+private:
+  std::unique_ptr<WorkerPool> _workerPool;
+
+private:
+  static constexpr auto TAG = "BulletTaskScheduler";
+};
+
+} // namespace margelo
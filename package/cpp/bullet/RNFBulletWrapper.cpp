@@ -3,23 +3,50 @@
 //
 
 #include "RNFBulletWrapper.h"
+#include "RNFLogger.h"
+#include "RNFMeshShapeBuilder.h"
+#include "core/RNFAssetCache.h"
+
+#include <cstring>
 
 namespace margelo {
 
 void BulletWrapper::loadHybridMethods() {
-  registerHybridMethod("createDiscreteDynamicWorld", &BulletWrapper::createDiscreteDynamicWorld, this);
-  registerHybridMethod("createRigidBody", &BulletWrapper::createRigidBody, this);
-  registerHybridMethod("createBoxShape", &BulletWrapper::createBoxShape, this);
-  registerHybridMethod("createCylinderShape", &BulletWrapper::createCylinderShape, this);
-  registerHybridMethod("createCylinderShapeX", &BulletWrapper::createCylinderShapeX, this);
-  registerHybridMethod("createCylinderShapeZ", &BulletWrapper::createCylinderShapeZ, this);
-  registerHybridMethod("createStaticPlaneShape", &BulletWrapper::createStaticPlaneShape, this);
-  registerHybridMethod("createRigidBodyFromTransform", &BulletWrapper::createRigidBodyFromTransform, this);
-  registerHybridMethod("createSphereShape", &BulletWrapper::createSphereShape, this);
+  registerHybridMethod("createDiscreteDynamicWorld", &BulletWrapper::createDiscreteDynamicWorld);
+  registerHybridMethod("createPhysicsClock", &BulletWrapper::createPhysicsClock);
+  registerHybridMethod("createRigidBody", &BulletWrapper::createRigidBody);
+  registerHybridMethod("createBoxShape", &BulletWrapper::createBoxShape);
+  registerHybridMethod("createCylinderShape", &BulletWrapper::createCylinderShape);
+  registerHybridMethod("createCylinderShapeX", &BulletWrapper::createCylinderShapeX);
+  registerHybridMethod("createCylinderShapeZ", &BulletWrapper::createCylinderShapeZ);
+  registerHybridMethod("createStaticPlaneShape", &BulletWrapper::createStaticPlaneShape);
+  registerHybridMethod("createRigidBodyFromTransform", &BulletWrapper::createRigidBodyFromTransform);
+  registerHybridMethod("createSphereShape", &BulletWrapper::createSphereShape);
+  registerHybridMethod("createConvexHullShape", &BulletWrapper::createConvexHullShape);
+  registerHybridMethod("createTriangleMeshShape", &BulletWrapper::createTriangleMeshShape);
+  registerHybridMethod("createCompoundShape", &BulletWrapper::createCompoundShape);
+  registerHybridMethod("getShapeCacheStats", &BulletWrapper::getShapeCacheStats);
+}
+
+std::shared_ptr<DiscreteDynamicWorldWrapper> BulletWrapper::createDiscreteDynamicWorld(double gravityX, double gravityY, double gravityZ,
+                                                                                    std::optional<int> threadsCount) {
+  return std::make_shared<DiscreteDynamicWorldWrapper>(gravityX, gravityY, gravityZ, threadsCount, _shapeCache);
 }
 
-std::shared_ptr<DiscreteDynamicWorldWrapper> BulletWrapper::createDiscreteDynamicWorld(double gravityX, double gravityY, double gravityZ) {
-  return std::make_shared<DiscreteDynamicWorldWrapper>(gravityX, gravityY, gravityZ);
+std::shared_ptr<PhysicsClockWrapper> BulletWrapper::createPhysicsClock(std::shared_ptr<DiscreteDynamicWorldWrapper> world,
+                                                                       std::shared_ptr<ChoreographerWrapper> choreographer,
+                                                                       std::optional<double> fixedTimeStep,
+                                                                       std::optional<int> maxCatchUpSteps) {
+  if (!world) {
+    throw std::invalid_argument("World is null");
+  }
+  std::shared_ptr<Choreographer> pointee = choreographer != nullptr ? choreographer->getChoreographer() : nullptr;
+  if (pointee == nullptr) {
+    throw std::invalid_argument("Choreographer is null or has been released");
+  }
+  return std::make_shared<PhysicsClockWrapper>(world, pointee,
+                                               fixedTimeStep.value_or(PhysicsClockWrapper::DEFAULT_FIXED_TIME_STEP),
+                                               maxCatchUpSteps.value_or(PhysicsClockWrapper::DEFAULT_MAX_CATCH_UP_STEPS));
 }
 
 std::shared_ptr<RigidBodyWrapper> BulletWrapper::createRigidBody(double mass, double x, double y, double z,
@@ -31,7 +58,7 @@ std::shared_ptr<RigidBodyWrapper> BulletWrapper::createRigidBody(double mass, do
     throw std::runtime_error("Shape is null");
   }
 
-  return RigidBodyWrapper::create(mass, x, y, z, shapePtr, id, collisionCallback);
+  return RigidBodyWrapper::create(mass, x, y, z, shapePtr, id, collisionCallback, _shapeCache);
 }
 
 std::shared_ptr<RigidBodyWrapper> BulletWrapper::createRigidBodyFromTransform(double mass, std::shared_ptr<TMat44Wrapper> entityTransform,
@@ -42,26 +69,101 @@ std::shared_ptr<RigidBodyWrapper> BulletWrapper::createRigidBodyFromTransform(do
     throw std::runtime_error("Shape is null");
   }
 
-  return RigidBodyWrapper::create(mass, entityTransform, shapePtr, id, collisionCallback);
+  return RigidBodyWrapper::create(mass, entityTransform, shapePtr, id, collisionCallback, _shapeCache);
 }
 
 std::shared_ptr<BoxShapeWrapper> BulletWrapper::createBoxShape(double x, double y, double z) {
-  return std::make_shared<BoxShapeWrapper>(x, y, z);
+  return std::make_shared<BoxShapeWrapper>(_shapeCache, x, y, z);
 }
 std::shared_ptr<CylinderShapeWrapper> BulletWrapper::createCylinderShape(double x, double y, double z) {
-  return std::make_shared<CylinderShapeWrapper>(x, y, z);
+  return std::make_shared<CylinderShapeWrapper>(_shapeCache, x, y, z);
 }
 std::shared_ptr<CylinderShapeWrapperX> BulletWrapper::createCylinderShapeX(double x, double y, double z) {
-  return std::make_shared<CylinderShapeWrapperX>(x, y, z);
+  return std::make_shared<CylinderShapeWrapperX>(_shapeCache, x, y, z);
 }
 std::shared_ptr<CylinderShapeWrapperZ> BulletWrapper::createCylinderShapeZ(double x, double y, double z) {
-  return std::make_shared<CylinderShapeWrapperZ>(x, y, z);
+  return std::make_shared<CylinderShapeWrapperZ>(_shapeCache, x, y, z);
 }
 std::shared_ptr<StaticPlaneShapeWrapper> BulletWrapper::createStaticPlaneShape(double normalX, double normalY, double normalZ,
                                                                                double planeConstant) {
-  return std::make_shared<StaticPlaneShapeWrapper>(normalX, normalY, normalZ, planeConstant);
+  return std::make_shared<StaticPlaneShapeWrapper>(_shapeCache, normalX, normalY, normalZ, planeConstant);
 }
 std::shared_ptr<SphereShapeWrapper> BulletWrapper::createSphereShape(double radius) {
-  return std::make_shared<SphereShapeWrapper>(radius);
+  return std::make_shared<SphereShapeWrapper>(_shapeCache, radius);
 }
+std::unordered_map<std::string, double> BulletWrapper::getShapeCacheStats() {
+  ShapeCache::Stats stats = _shapeCache->getStats();
+  size_t shapeLookups = stats.shapeHits + stats.shapeMisses;
+  return {{"hits", stats.shapeHits},
+          {"misses", stats.shapeMisses},
+          {"hitRate", shapeLookups > 0 ? static_cast<double>(stats.shapeHits) / shapeLookups : 0.0},
+          {"residentShapes", stats.residentShapes},
+          {"inertiaHits", stats.inertiaHits},
+          {"inertiaMisses", stats.inertiaMisses}};
+}
+std::future<std::shared_ptr<ConvexHullShapeWrapper>> BulletWrapper::createConvexHullShape(std::shared_ptr<FilamentBuffer> buffer,
+                                                                                          std::optional<std::string> nodeName) {
+  return createMeshShape<ConvexHullShapeWrapper>("convexHull", buffer, nodeName, &MeshShapeBuilder::createConvexHull);
+}
+
+std::future<std::shared_ptr<TriangleMeshShapeWrapper>> BulletWrapper::createTriangleMeshShape(std::shared_ptr<FilamentBuffer> buffer,
+                                                                                              std::optional<std::string> nodeName) {
+  return createMeshShape<TriangleMeshShapeWrapper>("triangleMesh", buffer, nodeName, &MeshShapeBuilder::createTriangleMesh);
+}
+
+std::future<std::shared_ptr<CompoundShapeWrapper>> BulletWrapper::createCompoundShape(std::shared_ptr<FilamentBuffer> buffer,
+                                                                                      std::optional<std::string> nodeName) {
+  return createMeshShape<CompoundShapeWrapper>("compound", buffer, nodeName, &MeshShapeBuilder::createCompound);
+}
+
+template <typename Wrapper>
+std::future<std::shared_ptr<Wrapper>> BulletWrapper::createMeshShape(const char* kind, std::shared_ptr<FilamentBuffer> buffer,
+                                                                     std::optional<std::string> nodeName, BuildShapeFunction&& buildShape) {
+  if (!buffer) {
+    [[unlikely]];
+    throw std::invalid_argument("Buffer is null");
+  }
+
+  std::weak_ptr<BulletWrapper> weakThis = shared<BulletWrapper>();
+  return _backgroundDispatcher->runAsyncAwaitable<std::shared_ptr<Wrapper>>(
+      [weakThis, kind, buffer, nodeName, buildShape = std::move(buildShape)]() -> std::shared_ptr<Wrapper> {
+        auto sharedThis = weakThis.lock();
+        if (sharedThis == nullptr) {
+          throw std::runtime_error("Failed to create shape, Bullet has already been destroyed!");
+        }
+
+        std::shared_ptr<ManagedBuffer> managedBuffer = buffer->getBuffer();
+        const uint8_t* data = managedBuffer->getData();
+        size_t size = managedBuffer->getSize();
+        uint64_t hash = AssetCache::hashContent(data, size);
+        std::string key = std::string(kind) + ":" + std::to_string(hash) + ":" + std::to_string(size) + ":" +
+                          (nodeName.has_value() ? "#" + nodeName.value() : "");
+        {
+          std::unique_lock lock(sharedThis->_meshShapesMutex);
+          auto iterator = sharedThis->_meshShapes.find(key);
+          if (iterator != sharedThis->_meshShapes.end()) {
+            auto cachedShape = std::static_pointer_cast<Wrapper>(iterator->second.shape.lock());
+            // A different glTF with the same hash gets its own shape, which then replaces the cached one
+            if (cachedShape != nullptr && (size == 0 || std::memcmp(iterator->second.source.data(), data, size) == 0)) {
+              return cachedShape;
+            }
+          }
+        }
+
+        std::vector<uint8_t> source(data, data + size);
+        std::vector<GltfGeometryReader::Primitive> primitives = GltfGeometryReader::read(data, size, nodeName);
+        auto shape = std::make_shared<Wrapper>(buildShape(primitives));
+        Logger::log(TAG, "Built %s shape from %zu primitives", kind, primitives.size());
+
+        std::unique_lock lock(sharedThis->_meshShapesMutex);
+        // Drop the entries of shapes that aren't used anymore
+        auto& meshShapes = sharedThis->_meshShapes;
+        for (auto iterator = meshShapes.begin(); iterator != meshShapes.end();) {
+          iterator = iterator->second.shape.expired() ? meshShapes.erase(iterator) : std::next(iterator);
+        }
+        sharedThis->_meshShapes[key] = MeshShapeEntry{shape, std::move(source)};
+        return shape;
+      });
+}
+
 } // namespace margelo
@@ -5,25 +5,47 @@
 #pragma once
 
 #include "RNFBoxShapeWrapper.h"
+#include "RNFChoreographerWrapper.h"
+#include "RNFCompoundShapeWrapper.h"
+#include "RNFConvexHullShapeWrapper.h"
 #include "RNFCylinderShapeWrapper.h"
 #include "RNFCylinderShapeWrapperX.h"
 #include "RNFCylinderShapeWrapperZ.h"
 #include "RNFDiscreteDynamicWorldWrapper.h"
+#include "RNFFilamentBuffer.h"
+#include "RNFPhysicsClockWrapper.h"
 #include "RNFRigidBodyWrapper.h"
+#include "RNFShapeCache.h"
 #include "RNFSphereShapeWrapper.h"
 #include "RNFStaticPlaneShapeWrapper.h"
+#include "RNFTriangleMeshShapeWrapper.h"
+#include "core/RNFGltfGeometryReader.h"
 #include "jsi/RNFHybridObject.h"
+#include "threading/RNFDispatcher.h"
+
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace margelo {
 
 // Main Wrapper for all Bullet Physics related APIs
 class BulletWrapper : public HybridObject {
 public:
-  explicit BulletWrapper() : HybridObject("BulletWrapper") {}
+  explicit BulletWrapper(std::shared_ptr<Dispatcher> backgroundDispatcher)
+      : HybridObject("BulletWrapper"), _backgroundDispatcher(backgroundDispatcher), _shapeCache(std::make_shared<ShapeCache>()) {}
   void loadHybridMethods() override;
 
 private:
-  std::shared_ptr<DiscreteDynamicWorldWrapper> createDiscreteDynamicWorld(double gravityX, double gravityY, double gravityZ);
+  std::shared_ptr<DiscreteDynamicWorldWrapper> createDiscreteDynamicWorld(double gravityX, double gravityY, double gravityZ,
+                                                                          std::optional<int> threadsCount);
+  std::shared_ptr<PhysicsClockWrapper> createPhysicsClock(std::shared_ptr<DiscreteDynamicWorldWrapper> world,
+                                                          std::shared_ptr<ChoreographerWrapper> choreographer,
+                                                          std::optional<double> fixedTimeStep, std::optional<int> maxCatchUpSteps);
   std::shared_ptr<RigidBodyWrapper> createRigidBody(double mass, double x, double y, double z, std::shared_ptr<ShapeWrapper> shape,
                                                     std::string id, std::optional<CollisionCallback> collisionCallback);
   std::shared_ptr<RigidBodyWrapper> createRigidBodyFromTransform(double mass, std::shared_ptr<TMat44Wrapper> entityTransform,
@@ -35,6 +57,39 @@ private:
   std::shared_ptr<CylinderShapeWrapperZ> createCylinderShapeZ(double x, double y, double z);
   std::shared_ptr<StaticPlaneShapeWrapper> createStaticPlaneShape(double normalX, double normalY, double normalZ, double planeConstant);
   std::shared_ptr<SphereShapeWrapper> createSphereShape(double radius);
+  std::future<std::shared_ptr<ConvexHullShapeWrapper>> createConvexHullShape(std::shared_ptr<FilamentBuffer> buffer,
+                                                                             std::optional<std::string> nodeName);
+  std::future<std::shared_ptr<TriangleMeshShapeWrapper>> createTriangleMeshShape(std::shared_ptr<FilamentBuffer> buffer,
+                                                                                 std::optional<std::string> nodeName);
+  std::future<std::shared_ptr<CompoundShapeWrapper>> createCompoundShape(std::shared_ptr<FilamentBuffer> buffer,
+                                                                         std::optional<std::string> nodeName);
+  std::unordered_map<std::string, double> getShapeCacheStats();
+
+private:
+  using BuildShapeFunction = std::function<std::shared_ptr<btCollisionShape>(const std::vector<GltfGeometryReader::Primitive>&)>;
+  /**
+   * Reads the glTF's geometry and builds the shape on the background Thread, or returns the same shape if it was built before
+   * and is still in use.
+   */
+  template <typename Wrapper>
+  std::future<std::shared_ptr<Wrapper>> createMeshShape(const char* kind, std::shared_ptr<FilamentBuffer> buffer,
+                                                        std::optional<std::string> nodeName, BuildShapeFunction&& buildShape);
+
+private:
+  std::shared_ptr<Dispatcher> _backgroundDispatcher;
+  // Shares the primitive shapes and their inertias
+  std::shared_ptr<ShapeCache> _shapeCache;
+  struct MeshShapeEntry {
+    std::weak_ptr<ShapeWrapper> shape;
+    // The glTF source the shape was built from, the key's hash is not cryptographic so hits are confirmed with it
+    std::vector<uint8_t> source;
+  };
+  std::mutex _meshShapesMutex;
+  // Mesh shapes by glTF content hash, node and kind of shape
+  std::unordered_map<std::string, MeshShapeEntry> _meshShapes;
+
+private:
+  static constexpr auto TAG = "BulletWrapper";
 };
 
 } // namespace margelo
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "RNFShapeWrapper.h"
+
+namespace margelo {
+
+// Convex hulls of the parts of a mesh, see MeshShapeBuilder::createCompound
+class CompoundShapeWrapper : public ShapeWrapper {
+public:
+  explicit CompoundShapeWrapper(std::shared_ptr<btCollisionShape> shape) : ShapeWrapper("CompoundShapeWrapper", shape) {}
+};
+
+} // namespace margelo
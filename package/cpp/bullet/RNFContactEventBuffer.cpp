@@ -0,0 +1,113 @@
+#include "RNFContactEventBuffer.h"
+
+#include <utility>
+
+namespace margelo {
+
+void ContactEventBuffer::collectTick(btDispatcher* dispatcher) {
+  _ticksCount++;
+
+  int numManifolds = dispatcher->getNumManifolds();
+  for (int i = 0; i < numManifolds; i++) {
+    btPersistentManifold* manifold = dispatcher->getManifoldByIndexInternal(i);
+    int bodyIdA = manifold->getBody0()->getUserIndex();
+    int bodyIdB = manifold->getBody1()->getUserIndex();
+    if (bodyIdA < 0 || bodyIdB < 0) {
+      continue;
+    }
+
+    const btManifoldPoint* deepestPoint = nullptr;
+    double impulse = 0;
+    int numContacts = manifold->getNumContacts();
+    for (int j = 0; j < numContacts; j++) {
+      const btManifoldPoint& point = manifold->getContactPoint(j);
+      if (point.getDistance() >= 0.f) {
+        continue;
+      }
+      impulse += point.getAppliedImpulse();
+      if (deepestPoint == nullptr || point.getDistance() < deepestPoint->getDistance()) {
+        deepestPoint = &point;
+      }
+    }
+    if (deepestPoint == nullptr) {
+      // Close, but not touching
+      continue;
+    }
+
+    // Events always list the smaller id first, flip the point and normal to match
+    bool isSwapped = bodyIdA > bodyIdB;
+    if (isSwapped) {
+      std::swap(bodyIdA, bodyIdB);
+    }
+    uint64_t key = makePairKey(bodyIdA, bodyIdB);
+    auto [iterator, isNewPair] = _pendingPairs.try_emplace(key, PairContact{0, btVector3(), btVector3(), 0});
+    PairContact& contact = iterator->second;
+    contact.impulse += impulse;
+    if (!isNewPair && contact.lastTick == _ticksCount) {
+      // Another manifold of the same pair in this step (e.g. a compound shape touching with multiple children)
+      continue;
+    }
+    contact.point = isSwapped ? deepestPoint->getPositionWorldOnA() : deepestPoint->getPositionWorldOnB();
+    contact.normal = isSwapped ? -deepestPoint->m_normalWorldOnB : deepestPoint->m_normalWorldOnB;
+    contact.lastTick = _ticksCount;
+  }
+}
+
+std::shared_ptr<TypedArray<double>> ContactEventBuffer::takeEvents() {
+  if (_ticksCount == 0) {
+    // The world did not advance, so nothing began or ended
+    return nullptr;
+  }
+
+  _events.clear();
+  for (const auto& [key, contact] : _pendingPairs) {
+    auto bodyIdA = static_cast<double>(key >> 32);
+    auto bodyIdB = static_cast<double>(key & 0xFFFFFFFF);
+    bool wasTouching = _activePairs.count(key) > 0;
+    bool isTouching = contact.lastTick == _ticksCount;
+    if (!wasTouching || isTouching) {
+      EventType type = wasTouching ? EventType::PERSIST : EventType::BEGIN;
+      _events.insert(_events.end(), {static_cast<double>(type), bodyIdA, bodyIdB, contact.impulse, contact.point.x(), contact.point.y(),
+                                     contact.point.z(), contact.normal.x(), contact.normal.y(), contact.normal.z()});
+    }
+    if (!isTouching) {
+      _events.insert(_events.end(), {static_cast<double>(EventType::END), bodyIdA, bodyIdB, 0, 0, 0, 0, 0, 0, 0});
+    }
+  }
+  for (uint64_t key : _activePairs) {
+    if (_pendingPairs.count(key) == 0) {
+      auto bodyIdA = static_cast<double>(key >> 32);
+      auto bodyIdB = static_cast<double>(key & 0xFFFFFFFF);
+      _events.insert(_events.end(), {static_cast<double>(EventType::END), bodyIdA, bodyIdB, 0, 0, 0, 0, 0, 0, 0});
+    }
+  }
+
+  _activePairs.clear();
+  for (const auto& [key, contact] : _pendingPairs) {
+    if (contact.lastTick == _ticksCount) {
+      _activePairs.insert(key);
+    }
+  }
+  _pendingPairs.clear();
+  _ticksCount = 0;
+
+  if (_events.empty()) {
+    return nullptr;
+  }
+  auto events = std::make_shared<TypedArray<double>>(std::move(_events));
+  _events = std::vector<double>();
+  return events;
+}
+
+void ContactEventBuffer::reset() {
+  _activePairs.clear();
+  _pendingPairs.clear();
+  _ticksCount = 0;
+  _events.clear();
+}
+
+uint64_t ContactEventBuffer::makePairKey(int bodyIdA, int bodyIdB) {
+  return (static_cast<uint64_t>(bodyIdA) << 32) | static_cast<uint32_t>(bodyIdB);
+}
+
+} // namespace margelo
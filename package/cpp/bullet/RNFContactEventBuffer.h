@@ -0,0 +1,68 @@
+#pragma once
+
+#include "jsi/RNFTypedArray.h"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace margelo {
+
+// Turns the contact manifolds of a world into begin, persist and end events per pair of bodies.
+// The manifolds are collected after every internal (fixed) step, and turned into events whenever the events are taken,
+// so contacts that only exist for some substeps between two takes are not lost.
+// Bodies are identified by the id stored in their `btCollisionObject::getUserIndex()`, objects without one are ignored.
+// The events are packed into a single Float64Array, `EVENT_STRIDE` numbers per event:
+// [type, bodyIdA, bodyIdB, impulse, pointX, pointY, pointZ, normalX, normalY, normalZ]
+// where bodyIdA < bodyIdB, the impulse is the total impulse of all internal steps since the last take, the point is the
+// deepest contact point on body B and the normal points from B towards A, both of the last internal step the pair touched in.
+// Every pair gets one event per take, except for pairs that began and ended touching in between, which get a begin and an end
+// event. End events only carry the type and the ids.
+class ContactEventBuffer {
+public:
+  enum class EventType { BEGIN = 0, PERSIST = 1, END = 2 };
+  static constexpr size_t EVENT_STRIDE = 10;
+
+  /**
+   * Records the touching pairs of the internal step that just finished. Call this from the world's internal tick callback.
+   */
+  void collectTick(btDispatcher* dispatcher);
+
+  /**
+   * Returns the events of all internal steps since the last call, or nullptr if there were none.
+   * If no internal step happened since the last call, the touching pairs are unchanged and there are no events.
+   */
+  std::shared_ptr<TypedArray<double>> takeEvents();
+
+  /**
+   * Forgets all touching pairs, so the next `takeEvents` reports all of them as begin events.
+   */
+  void reset();
+
+private:
+  static uint64_t makePairKey(int bodyIdA, int bodyIdB);
+
+private:
+  struct PairContact {
+    double impulse;
+    btVector3 point;
+    btVector3 normal;
+    // The last internal step the pair touched in
+    size_t lastTick;
+  };
+
+private:
+  // Pairs that touched in the last internal step before the previous take
+  std::unordered_set<uint64_t> _activePairs;
+  // Pairs that touched in any internal step since the previous take. Reused across takes.
+  std::unordered_map<uint64_t, PairContact> _pendingPairs;
+  // The number of internal steps since the previous take
+  size_t _ticksCount = 0;
+  std::vector<double> _events;
+};
+
+} // namespace margelo
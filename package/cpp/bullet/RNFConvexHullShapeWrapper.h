@@ -0,0 +1,13 @@
+#pragma once
+
+#include "RNFShapeWrapper.h"
+
+namespace margelo {
+
+// A convex hull around the vertices of a mesh, see MeshShapeBuilder::createConvexHull
+class ConvexHullShapeWrapper : public ShapeWrapper {
+public:
+  explicit ConvexHullShapeWrapper(std::shared_ptr<btCollisionShape> shape) : ShapeWrapper("ConvexHullShapeWrapper", shape) {}
+};
+
+} // namespace margelo
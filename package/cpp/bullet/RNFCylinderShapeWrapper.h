@@ -10,8 +10,8 @@ namespace margelo {
 
 class CylinderShapeWrapper : public ShapeWrapper {
 public:
-  explicit CylinderShapeWrapper(double x, double y, double z)
-      : ShapeWrapper("CylinderShapeWrapper", std::make_shared<btCylinderShape>(btVector3(x, y, z))) {}
+  explicit CylinderShapeWrapper(std::shared_ptr<ShapeCache> shapeCache, double x, double y, double z)
+      : ShapeWrapper("CylinderShapeWrapper", shapeCache, ShapeCache::Key{ShapeCache::ShapeType::Cylinder, {x, y, z, 0}}) {}
 };
 
 } // namespace margelo
@@ -10,8 +10,8 @@ namespace margelo {
 
 class CylinderShapeWrapperX : public ShapeWrapper {
 public:
-  explicit CylinderShapeWrapperX(double x, double y, double z)
-      : ShapeWrapper("CylinderShapeWrapperX", std::make_shared<btCylinderShapeX>(btVector3(x, y, z))) {}
+  explicit CylinderShapeWrapperX(std::shared_ptr<ShapeCache> shapeCache, double x, double y, double z)
+      : ShapeWrapper("CylinderShapeWrapperX", shapeCache, ShapeCache::Key{ShapeCache::ShapeType::CylinderX, {x, y, z, 0}}) {}
 };
 
 } // namespace margelo
@@ -10,8 +10,8 @@ namespace margelo {
 
 class CylinderShapeWrapperZ : public ShapeWrapper {
 public:
-  explicit CylinderShapeWrapperZ(double x, double y, double z)
-      : ShapeWrapper("CylinderShapeWrapperZ", std::make_shared<btCylinderShapeZ>(btVector3(x, y, z))) {}
+  explicit CylinderShapeWrapperZ(std::shared_ptr<ShapeCache> shapeCache, double x, double y, double z)
+      : ShapeWrapper("CylinderShapeWrapperZ", shapeCache, ShapeCache::Key{ShapeCache::ShapeType::CylinderZ, {x, y, z, 0}}) {}
 };
 
 } // namespace margelo
@@ -0,0 +1,199 @@
+#include "RNFDiscreteDynamicWorldWrapper.h"
+
+#include <algorithm>
+
+namespace margelo {
+
+static void validateQueryCount(const char* method, size_t valuesCount, size_t stride) {
+  if (valuesCount % stride != 0) {
+    [[unlikely]];
+    throw std::invalid_argument(std::string(method) + ": Expected " + std::to_string(stride) + " values per query, but received " +
+                                std::to_string(valuesCount) + " values!");
+  }
+}
+
+static btVector3 readVector(const double* values) {
+  return btVector3(values[0], values[1], values[2]);
+}
+
+// Writes [bodyId, fraction, point, normal]
+static void writeHit(double* hit, const btCollisionObject* object, btScalar fraction, const btVector3& point, const btVector3& normal) {
+  hit[0] = object != nullptr ? object->getUserIndex() : -1;
+  hit[1] = fraction;
+  hit[2] = point.x();
+  hit[3] = point.y();
+  hit[4] = point.z();
+  hit[5] = normal.x();
+  hit[6] = normal.y();
+  hit[7] = normal.z();
+}
+
+// Writes bodyId -1 and fraction 1, as if the query went all the way without hitting anything
+static void writeMiss(double* hit) {
+  std::fill(hit, hit + DiscreteDynamicWorldWrapper::HIT_STRIDE, 0.0);
+  hit[0] = -1;
+  hit[1] = 1;
+}
+
+std::shared_ptr<TypedArray<double>> DiscreteDynamicWorldWrapper::rayTest(TypedArrayView<double> rays) {
+  validateQueryCount("rayTest", rays.size(), RAY_STRIDE);
+  size_t count = rays.size() / RAY_STRIDE;
+  auto hits = std::make_shared<TypedArray<double>>(count * HIT_STRIDE);
+
+  std::unique_lock lock(*simulationMutex);
+  for (size_t i = 0; i < count; i++) {
+    btVector3 from = readVector(rays.data() + i * RAY_STRIDE);
+    btVector3 to = readVector(rays.data() + i * RAY_STRIDE + 3);
+    btCollisionWorld::ClosestRayResultCallback callback(from, to);
+    dynamicsWorld->rayTest(from, to, callback);
+
+    double* hit = hits->elements() + i * HIT_STRIDE;
+    if (callback.hasHit()) {
+      writeHit(hit, callback.m_collisionObject, callback.m_closestHitFraction, callback.m_hitPointWorld, callback.m_hitNormalWorld);
+    } else {
+      writeMiss(hit);
+    }
+  }
+  return hits;
+}
+
+std::shared_ptr<TypedArray<double>> DiscreteDynamicWorldWrapper::rayTestAll(TypedArrayView<double> rays) {
+  validateQueryCount("rayTestAll", rays.size(), RAY_STRIDE);
+  size_t count = rays.size() / RAY_STRIDE;
+  std::vector<double> hits;
+  std::vector<int> order;
+
+  std::unique_lock lock(*simulationMutex);
+  for (size_t i = 0; i < count; i++) {
+    btVector3 from = readVector(rays.data() + i * RAY_STRIDE);
+    btVector3 to = readVector(rays.data() + i * RAY_STRIDE + 3);
+    btCollisionWorld::AllHitsRayResultCallback callback(from, to);
+    dynamicsWorld->rayTest(from, to, callback);
+
+    // Bullet reports the hits in the order it found them in the broadphase
+    int hitsCount = callback.m_collisionObjects.size();
+    order.resize(hitsCount);
+    for (int j = 0; j < hitsCount; j++) {
+      order[j] = j;
+    }
+    std::sort(order.begin(), order.end(), [&callback](int a, int b) { return callback.m_hitFractions[a] < callback.m_hitFractions[b]; });
+
+    for (int j : order) {
+      size_t offset = hits.size();
+      hits.resize(offset + INDEXED_HIT_STRIDE);
+      hits[offset] = static_cast<double>(i);
+      writeHit(hits.data() + offset + 1, callback.m_collisionObjects[j], callback.m_hitFractions[j], callback.m_hitPointWorld[j],
+               callback.m_hitNormalWorld[j]);
+    }
+  }
+  return std::make_shared<TypedArray<double>>(std::move(hits));
+}
+
+std::shared_ptr<TypedArray<double>> DiscreteDynamicWorldWrapper::convexSweepTest(std::shared_ptr<ShapeWrapper> shape,
+                                                                                 TypedArrayView<double> sweeps) {
+  if (shape == nullptr || shape->getShape() == nullptr) {
+    [[unlikely]];
+    throw std::invalid_argument("convexSweepTest: Shape is null");
+  }
+  std::shared_ptr<btCollisionShape> collisionShape = shape->getShape();
+  if (!collisionShape->isConvex()) {
+    [[unlikely]];
+    throw std::invalid_argument("convexSweepTest: Only convex shapes can be swept, use a box, cylinder, sphere or convex hull shape!");
+  }
+  const auto* convexShape = static_cast<const btConvexShape*>(collisionShape.get());
+  validateQueryCount("convexSweepTest", sweeps.size(), RAY_STRIDE);
+  size_t count = sweeps.size() / RAY_STRIDE;
+  auto hits = std::make_shared<TypedArray<double>>(count * HIT_STRIDE);
+
+  std::unique_lock lock(*simulationMutex);
+  btTransform from;
+  btTransform to;
+  from.setIdentity();
+  to.setIdentity();
+  for (size_t i = 0; i < count; i++) {
+    from.setOrigin(readVector(sweeps.data() + i * RAY_STRIDE));
+    to.setOrigin(readVector(sweeps.data() + i * RAY_STRIDE + 3));
+    btCollisionWorld::ClosestConvexResultCallback callback(from.getOrigin(), to.getOrigin());
+    dynamicsWorld->convexSweepTest(convexShape, from, to, callback);
+
+    double* hit = hits->elements() + i * HIT_STRIDE;
+    if (callback.hasHit()) {
+      writeHit(hit, callback.m_hitCollisionObject, callback.m_closestHitFraction, callback.m_hitPointWorld, callback.m_hitNormalWorld);
+    } else {
+      writeMiss(hit);
+    }
+  }
+  return hits;
+}
+
+namespace {
+  // Keeps the deepest contact point per touched collision object
+  class DeepestContactsCallback : public btCollisionWorld::ContactResultCallback {
+  public:
+    struct Contact {
+      const btCollisionObject* object;
+      btScalar distance;
+      btVector3 point;
+      btVector3 normal;
+    };
+
+    explicit DeepestContactsCallback(const btCollisionObject* queryObject) : _queryObject(queryObject) {}
+
+    btScalar addSingleResult(btManifoldPoint& point, const btCollisionObjectWrapper* wrapper0, int, int,
+                             const btCollisionObjectWrapper* wrapper1, int, int) override {
+      // Bullet may pass the query object as either of the two objects
+      bool isQueryFirst = wrapper0->getCollisionObject() == _queryObject;
+      const btCollisionObject* other = isQueryFirst ? wrapper1->getCollisionObject() : wrapper0->getCollisionObject();
+      btVector3 position = isQueryFirst ? point.m_positionWorldOnB : point.m_positionWorldOnA;
+      // The normal points from B towards A
+      btVector3 normal = isQueryFirst ? point.m_normalWorldOnB : -point.m_normalWorldOnB;
+
+      auto iterator = std::find_if(contacts.begin(), contacts.end(), [other](const Contact& contact) { return contact.object == other; });
+      if (iterator == contacts.end()) {
+        contacts.push_back(Contact{other, point.getDistance(), position, normal});
+      } else if (point.getDistance() < iterator->distance) {
+        *iterator = Contact{other, point.getDistance(), position, normal};
+      }
+      return 0;
+    }
+
+  public:
+    std::vector<Contact> contacts;
+
+  private:
+    const btCollisionObject* _queryObject;
+  };
+} // namespace
+
+std::shared_ptr<TypedArray<double>> DiscreteDynamicWorldWrapper::contactTest(std::shared_ptr<ShapeWrapper> shape,
+                                                                             TypedArrayView<double> positions) {
+  if (shape == nullptr || shape->getShape() == nullptr) {
+    [[unlikely]];
+    throw std::invalid_argument("contactTest: Shape is null");
+  }
+  validateQueryCount("contactTest", positions.size(), POSITION_STRIDE);
+  size_t count = positions.size() / POSITION_STRIDE;
+  std::vector<double> contacts;
+
+  std::unique_lock lock(*simulationMutex);
+  // Not added to the world, so it never touches itself
+  btCollisionObject queryObject;
+  queryObject.setCollisionShape(shape->getShape().get());
+  btTransform transform;
+  transform.setIdentity();
+  for (size_t i = 0; i < count; i++) {
+    transform.setOrigin(readVector(positions.data() + i * POSITION_STRIDE));
+    queryObject.setWorldTransform(transform);
+    DeepestContactsCallback callback(&queryObject);
+    dynamicsWorld->contactTest(&queryObject, callback);
+
+    for (const DeepestContactsCallback::Contact& contact : callback.contacts) {
+      contacts.insert(contacts.end(), {static_cast<double>(i), static_cast<double>(contact.object->getUserIndex()), contact.distance,
+                                       contact.point.x(), contact.point.y(), contact.point.z(), contact.normal.x(), contact.normal.y(),
+                                       contact.normal.z()});
+    }
+  }
+  return std::make_shared<TypedArray<double>>(std::move(contacts));
+}
+
+} // namespace margelo
@@ -0,0 +1,170 @@
+#include "RNFDiscreteDynamicWorldWrapper.h"
+
+#include <cstring>
+
+namespace margelo {
+
+// Snapshot layout: A header followed by one BodyRecord per body, in slot order. Scalars are stored as btScalar
+// (float unless Bullet is built with double precision), so a restored body is bit-identical to the snapshotted one.
+// The buffer is only meant to be restored by the same build, it isn't a portable file format.
+namespace {
+  struct SnapshotHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t scalarSize;
+    uint32_t bodiesCount;
+  };
+
+  struct BodyRecord {
+    int32_t bodyId;
+    int32_t activationState;
+    // The full basis instead of a quaternion, converting it back would not restore the exact same matrix
+    btScalar basis[9];
+    btScalar origin[3];
+    btScalar linearVelocity[3];
+    btScalar angularVelocity[3];
+    btScalar deactivationTime;
+    btScalar linearDamping;
+    btScalar angularDamping;
+    btScalar friction;
+  };
+
+  constexpr uint32_t SNAPSHOT_MAGIC = 0x50534652; // "RFSP"
+  constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+  void writeVector(btScalar* values, const btVector3& vector) {
+    values[0] = vector.x();
+    values[1] = vector.y();
+    values[2] = vector.z();
+  }
+
+  btVector3 readVector(const btScalar* values) {
+    return btVector3(values[0], values[1], values[2]);
+  }
+} // namespace
+
+std::shared_ptr<TypedArray<uint8_t>> DiscreteDynamicWorldWrapper::snapshot() {
+  std::unique_lock lock(*simulationMutex);
+  SnapshotHeader header{.magic = SNAPSHOT_MAGIC,
+                        .version = SNAPSHOT_VERSION,
+                        .scalarSize = sizeof(btScalar),
+                        .bodiesCount = static_cast<uint32_t>(rigidBodies.size())};
+  auto buffer = std::make_shared<TypedArray<uint8_t>>(sizeof(SnapshotHeader) + header.bodiesCount * sizeof(BodyRecord));
+  uint8_t* data = buffer->elements();
+  std::memcpy(data, &header, sizeof(SnapshotHeader));
+  data += sizeof(SnapshotHeader);
+
+  rigidBodies.forEach([&data](int bodyId, const std::shared_ptr<RigidBodyWrapper>& rigidBody) {
+    const btRigidBody* body = rigidBody->getRigidBody().get();
+    const btTransform& transform = body->getCenterOfMassTransform();
+    BodyRecord record{};
+    record.bodyId = bodyId;
+    record.activationState = body->getActivationState();
+    for (int row = 0; row < 3; row++) {
+      writeVector(record.basis + row * 3, transform.getBasis()[row]);
+    }
+    writeVector(record.origin, transform.getOrigin());
+    writeVector(record.linearVelocity, body->getLinearVelocity());
+    writeVector(record.angularVelocity, body->getAngularVelocity());
+    record.deactivationTime = body->getDeactivationTime();
+    record.linearDamping = body->getLinearDamping();
+    record.angularDamping = body->getAngularDamping();
+    record.friction = body->getFriction();
+    // The buffer has no alignment guarantees
+    std::memcpy(data, &record, sizeof(BodyRecord));
+    data += sizeof(BodyRecord);
+  });
+  return buffer;
+}
+
+int DiscreteDynamicWorldWrapper::restore(TypedArrayView<uint8_t> snapshot) {
+  SnapshotHeader header;
+  if (snapshot.size() < sizeof(SnapshotHeader)) {
+    [[unlikely]];
+    throw std::invalid_argument("restore: The snapshot is too small (" + std::to_string(snapshot.size()) + " bytes)!");
+  }
+  std::memcpy(&header, snapshot.data(), sizeof(SnapshotHeader));
+  if (header.magic != SNAPSHOT_MAGIC || header.version != SNAPSHOT_VERSION) {
+    [[unlikely]];
+    throw std::invalid_argument("restore: The buffer is not a snapshot of this version of react-native-filament!");
+  }
+  if (header.scalarSize != sizeof(btScalar)) {
+    [[unlikely]];
+    throw std::invalid_argument("restore: The snapshot was taken with " + std::to_string(header.scalarSize * 8) +
+                                " bit scalars, but Bullet uses " + std::to_string(sizeof(btScalar) * 8) + " bit scalars!");
+  }
+  if (snapshot.size() != sizeof(SnapshotHeader) + header.bodiesCount * sizeof(BodyRecord)) {
+    [[unlikely]];
+    throw std::invalid_argument("restore: Expected " + std::to_string(header.bodiesCount) + " bodies (" +
+                                std::to_string(sizeof(SnapshotHeader) + header.bodiesCount * sizeof(BodyRecord)) +
+                                " bytes), but the snapshot has " + std::to_string(snapshot.size()) + " bytes!");
+  }
+
+  std::unique_lock lock(*simulationMutex);
+  // Re-adding the bodies resets the activation state of static bodies, so the states are applied afterwards
+  rebuildDynamicsWorld();
+
+  const uint8_t* data = snapshot.data() + sizeof(SnapshotHeader);
+  int restoredCount = 0;
+  for (uint32_t i = 0; i < header.bodiesCount; i++) {
+    BodyRecord record;
+    std::memcpy(&record, data + i * sizeof(BodyRecord), sizeof(BodyRecord));
+    std::shared_ptr<RigidBodyWrapper>* storedBody = rigidBodies.get(record.bodyId);
+    if (storedBody == nullptr) {
+      // Removed since the snapshot was taken
+      continue;
+    }
+    btRigidBody* body = (*storedBody)->getRigidBody().get();
+    btTransform transform(btMatrix3x3(record.basis[0], record.basis[1], record.basis[2], record.basis[3], record.basis[4],
+                                      record.basis[5], record.basis[6], record.basis[7], record.basis[8]),
+                          readVector(record.origin));
+    // The velocities first, setCenterOfMassTransform also resets the interpolation velocities to them
+    body->setLinearVelocity(readVector(record.linearVelocity));
+    body->setAngularVelocity(readVector(record.angularVelocity));
+    body->setCenterOfMassTransform(transform);
+    if (body->getMotionState() != nullptr) {
+      body->getMotionState()->setWorldTransform(transform);
+    }
+    body->clearForces();
+    body->forceActivationState(record.activationState);
+    body->setDeactivationTime(record.deactivationTime);
+    body->setDamping(record.linearDamping, record.angularDamping);
+    body->setFriction(record.friction);
+    bodyChanges.markChanged(body);
+    restoredCount++;
+  }
+
+  // Contacts of the previous state are gone, pairs that still touch are reported as beginning again
+  contactEvents.reset();
+  // Bodies that are restored asleep would never be synced to their entities
+  transformSync.invalidate();
+  return restoredCount;
+}
+
+void DiscreteDynamicWorldWrapper::rebuildDynamicsWorld() {
+  // Bullet keeps state outside of the bodies: The broadphase tree and pair order, the contact manifolds (warm starting the
+  // solver with the previous impulses), the solver's random seed and the time accumulated for substeps. Restarting with
+  // a fresh pipeline and re-adding the bodies in slot order makes the next steps independent of what happened before.
+  btVector3 gravity = dynamicsWorld->getGravity();
+  std::vector<btRigidBody*> bodies;
+  bodies.reserve(rigidBodies.size());
+  rigidBodies.forEach(
+      [&bodies](int, const std::shared_ptr<RigidBodyWrapper>& rigidBody) { bodies.push_back(rigidBody->getRigidBody().get()); });
+  // Destroying a world with bodies in it removes their pairs one body at a time
+  removeFromDynamicsWorld(bodies);
+
+  dynamicsWorld = nullptr;
+  solver = nullptr;
+  solverPool = nullptr;
+  dispatcher = nullptr;
+  collisionConfiguration = nullptr;
+  broadphase = nullptr;
+  createDynamicsWorld();
+  dynamicsWorld->setGravity(gravity);
+
+  for (btRigidBody* body : bodies) {
+    dynamicsWorld->addRigidBody(body);
+  }
+}
+
+} // namespace margelo
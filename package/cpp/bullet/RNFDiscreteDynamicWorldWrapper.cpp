@@ -4,53 +4,464 @@
 
 #include "RNFDiscreteDynamicWorldWrapper.h"
 
+#include <BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h>
+#include <BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h>
+#include <BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h>
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+#include <utility>
+
 namespace margelo {
-DiscreteDynamicWorldWrapper::DiscreteDynamicWorldWrapper(double gravityX, double gravityY, double gravityZ)
-    : HybridObject("DiscreteDynamicWorldWrapper") {
-  broadphase = std::make_unique<btDbvtBroadphase>();
+DiscreteDynamicWorldWrapper::DiscreteDynamicWorldWrapper(double gravityX, double gravityY, double gravityZ, std::optional<int> threadsCount,
+                                                         std::shared_ptr<ShapeCache> shapeCache)
+    : HybridObject("DiscreteDynamicWorldWrapper"), shapeCache(shapeCache) {
+  if (threadsCount.has_value()) {
+#if BT_THREADSAFE
+    taskScheduler = BulletTaskScheduler::getShared(threadsCount.value());
+#else
+    // The prebuilt Bullet libraries (Android) don't contain the multithreaded world
+    Logger::log("DiscreteDynamicWorldWrapper", "Bullet was built without BT_THREADSAFE, creating a single-threaded world.");
+#endif
+  }
+  createDynamicsWorld();
+  dynamicsWorld->setGravity(btVector3(gravityX, gravityY, gravityZ));
+}
 
+void DiscreteDynamicWorldWrapper::createDynamicsWorld() {
+  broadphase = std::make_unique<btDbvtBroadphase>();
   collisionConfiguration = std::make_unique<btDefaultCollisionConfiguration>();
-  dispatcher = std::make_unique<btCollisionDispatcher>(collisionConfiguration.get());
 
-  solver = std::make_unique<btSequentialImpulseConstraintSolver>();
+  if (taskScheduler != nullptr) {
+    createMultithreadedWorld();
+  } else {
+    dispatcher = std::make_unique<btCollisionDispatcher>(collisionConfiguration.get());
 
-  dynamicsWorld = std::make_unique<btDiscreteDynamicsWorld>(dispatcher.get(), broadphase.get(), solver.get(), collisionConfiguration.get());
-  dynamicsWorld->setGravity(btVector3(gravityX, gravityY, gravityZ));
+    solver = std::make_unique<btSequentialImpulseConstraintSolver>();
+
+    dynamicsWorld =
+        std::make_unique<btDiscreteDynamicsWorld>(dispatcher.get(), broadphase.get(), solver.get(), collisionConfiguration.get());
+  }
+  dynamicsWorld->setInternalTickCallback(&DiscreteDynamicWorldWrapper::onInternalTick, this);
+}
+
+void DiscreteDynamicWorldWrapper::onInternalTick(btDynamicsWorld* world, btScalar timeStep) {
+  // Called by stepSimulation after every internal (fixed) step, while simulationMutex is held
+  auto* self = static_cast<DiscreteDynamicWorldWrapper*>(world->getWorldUserInfo());
+  if (self->contactEventsCallback.has_value()) {
+    self->contactEvents.collectTick(world->getDispatcher());
+  }
+}
+
+void DiscreteDynamicWorldWrapper::createMultithreadedWorld() {
+#if BT_THREADSAFE
+  // The Mt dispatcher sizes its per-thread storage by the scheduler that is installed while it is created
+  std::unique_lock lock(BulletTaskScheduler::getGlobalMutex());
+  taskScheduler->install();
+
+  dispatcher = std::make_unique<btCollisionDispatcherMt>(collisionConfiguration.get());
+
+  solverPool = std::make_unique<btConstraintSolverPoolMt>(taskScheduler->getNumThreads());
+  // Solves large islands (like a pile of bodies that all touch each other) by splitting their constraints into batches
+  solver = std::make_unique<btSequentialImpulseConstraintSolverMt>();
+
+  dynamicsWorld = std::make_unique<btDiscreteDynamicsWorldMt>(dispatcher.get(), broadphase.get(),
+                                                              static_cast<btConstraintSolverPoolMt*>(solverPool.get()), solver.get(),
+                                                              collisionConfiguration.get());
+#endif
 }
 
 void DiscreteDynamicWorldWrapper::loadHybridMethods() {
-  registerHybridMethod("addRigidBody", &DiscreteDynamicWorldWrapper::addRigidBody, this);
-  registerHybridMethod("removeRigidBody", &DiscreteDynamicWorldWrapper::removeRigidBody, this);
-  registerHybridMethod("stepSimulation", &DiscreteDynamicWorldWrapper::stepSimulation, this);
+  registerHybridMethod("addRigidBody", &DiscreteDynamicWorldWrapper::addRigidBody);
+  registerHybridMethod("removeRigidBody", &DiscreteDynamicWorldWrapper::removeRigidBody);
+  registerHybridMethod("addRigidBodies", &DiscreteDynamicWorldWrapper::addRigidBodies);
+  registerHybridMethod("createRigidBodies", &DiscreteDynamicWorldWrapper::createRigidBodies);
+  registerHybridMethod("removeRigidBodies", &DiscreteDynamicWorldWrapper::removeRigidBodies);
+  registerHybridMethod("stepSimulation", &DiscreteDynamicWorldWrapper::stepSimulation);
+  registerHybridMethod("setContactEventsCallback", &DiscreteDynamicWorldWrapper::setContactEventsCallback);
+  registerHybridMethod("getBodyId", &DiscreteDynamicWorldWrapper::getBodyId);
+  registerHybridMethod("getRigidBody", &DiscreteDynamicWorldWrapper::getRigidBody);
+  registerHybridMethod("bindEntity", &DiscreteDynamicWorldWrapper::bindEntity);
+  registerHybridMethod("unbindEntity", &DiscreteDynamicWorldWrapper::unbindEntity);
+  registerHybridMethod("takeChangedBodies", &DiscreteDynamicWorldWrapper::takeChangedBodies);
+  registerHybridMethod("getSimulationStats", &DiscreteDynamicWorldWrapper::getSimulationStats);
+  registerHybridMethod("rayTest", &DiscreteDynamicWorldWrapper::rayTest);
+  registerHybridMethod("rayTestAll", &DiscreteDynamicWorldWrapper::rayTestAll);
+  registerHybridMethod("convexSweepTest", &DiscreteDynamicWorldWrapper::convexSweepTest);
+  registerHybridMethod("contactTest", &DiscreteDynamicWorldWrapper::contactTest);
+  registerHybridMethod("snapshot", &DiscreteDynamicWorldWrapper::snapshot);
+  registerHybridMethod("restore", &DiscreteDynamicWorldWrapper::restore);
 }
 
 void DiscreteDynamicWorldWrapper::addRigidBody(std::shared_ptr<RigidBodyWrapper> rigidBody) {
+  std::unique_lock lock(*simulationMutex);
   if (!rigidBody) {
     throw std::runtime_error("RigidBody is null");
   }
-  btRigidBody* body = rigidBody->getRigidBody().get();
-  dynamicsWorld->addRigidBody(body);
-  rigidBodies->push_back(rigidBody);
+  insertRigidBody(rigidBody);
 }
 
 void DiscreteDynamicWorldWrapper::removeRigidBody(std::shared_ptr<RigidBodyWrapper> rigidBody) {
+  std::unique_lock lock(*simulationMutex);
   if (!rigidBody) {
     throw std::runtime_error("RigidBody is null");
   }
   btRigidBody* body = rigidBody->getRigidBody().get();
   dynamicsWorld->removeRigidBody(body);
-  rigidBodies->erase(std::remove(rigidBodies->begin(), rigidBodies->end(), rigidBody), rigidBodies->end());
+  int bodyId = body->getUserIndex();
+  std::shared_ptr<RigidBodyWrapper>* storedBody = rigidBodies.get(bodyId);
+  if (storedBody != nullptr && *storedBody == rigidBody) {
+    eraseRigidBody(bodyId, body);
+  }
+}
+
+std::shared_ptr<TypedArray<int32_t>>
+DiscreteDynamicWorldWrapper::addRigidBodies(std::vector<std::shared_ptr<RigidBodyWrapper>> rigidBodiesToAdd) {
+  std::unique_lock lock(*simulationMutex);
+  for (size_t i = 0; i < rigidBodiesToAdd.size(); i++) {
+    if (!rigidBodiesToAdd[i]) {
+      [[unlikely]];
+      throw std::invalid_argument("RigidBody at index " + std::to_string(i) + " is null");
+    }
+  }
+
+  auto bodyIds = std::make_shared<TypedArray<int32_t>>(rigidBodiesToAdd.size());
+  for (size_t i = 0; i < rigidBodiesToAdd.size(); i++) {
+    bodyIds->elements()[i] = insertRigidBody(rigidBodiesToAdd[i]);
+  }
+  return bodyIds;
+}
+
+std::shared_ptr<TypedArray<int32_t>> DiscreteDynamicWorldWrapper::createRigidBodies(TypedArrayView<double> bodies,
+                                                                                   std::vector<std::shared_ptr<ShapeWrapper>> shapes) {
+  if (bodies.size() % RIGID_BODY_STRIDE != 0) {
+    [[unlikely]];
+    throw std::invalid_argument("createRigidBodies: Expected " + std::to_string(RIGID_BODY_STRIDE) + " values per body, but received " +
+                                std::to_string(bodies.size()) + " values!");
+  }
+  std::vector<std::shared_ptr<btCollisionShape>> collisionShapes;
+  collisionShapes.reserve(shapes.size());
+  for (const std::shared_ptr<ShapeWrapper>& shape : shapes) {
+    if (shape == nullptr || shape->getShape() == nullptr) {
+      [[unlikely]];
+      throw std::invalid_argument("createRigidBodies: Shape is null");
+    }
+    collisionShapes.push_back(shape->getShape());
+  }
+
+  // Create all bodies before adding any, so invalid input doesn't leave half of the bodies in the world
+  size_t count = bodies.size() / RIGID_BODY_STRIDE;
+  std::vector<std::shared_ptr<RigidBodyWrapper>> rigidBodiesToAdd;
+  rigidBodiesToAdd.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    const double* values = bodies.data() + i * RIGID_BODY_STRIDE;
+    double shapeIndex = values[4];
+    if (shapeIndex < 0 || shapeIndex >= collisionShapes.size() || std::floor(shapeIndex) != shapeIndex) {
+      [[unlikely]];
+      throw std::invalid_argument("createRigidBodies: Body " + std::to_string(i) + " has an invalid shape index " +
+                                  std::to_string(shapeIndex) + ", there are " + std::to_string(collisionShapes.size()) + " shapes!");
+    }
+    rigidBodiesToAdd.push_back(RigidBodyWrapper::create(values[0], values[1], values[2], values[3],
+                                                        collisionShapes[static_cast<size_t>(shapeIndex)], "", std::nullopt, shapeCache));
+  }
+  return addRigidBodies(std::move(rigidBodiesToAdd));
+}
+
+void DiscreteDynamicWorldWrapper::removeRigidBodies(TypedArrayView<int32_t> bodyIds) {
+  std::unique_lock lock(*simulationMutex);
+  // Keeps the wrappers, and with them the bodies, alive until they are out of the world
+  std::vector<std::shared_ptr<RigidBodyWrapper>> removedBodies;
+  std::vector<btRigidBody*> bodies;
+  removedBodies.reserve(bodyIds.size());
+  bodies.reserve(bodyIds.size());
+  for (int32_t bodyId : bodyIds) {
+    std::shared_ptr<RigidBodyWrapper>* storedBody = rigidBodies.get(bodyId);
+    if (storedBody == nullptr) {
+      // Already removed, or listed twice
+      continue;
+    }
+    removedBodies.push_back(*storedBody);
+    btRigidBody* body = removedBodies.back()->getRigidBody().get();
+    bodies.push_back(body);
+    eraseRigidBody(bodyId, body);
+  }
+  removeFromDynamicsWorld(bodies);
+}
+
+int DiscreteDynamicWorldWrapper::insertRigidBody(const std::shared_ptr<RigidBodyWrapper>& rigidBody) {
+  btRigidBody* body = rigidBody->getRigidBody().get();
+  int bodyId = rigidBodies.insert(rigidBody);
+  // Back-pointer to find the wrapper of a colliding body in stepSimulation, the wrapper is kept alive by rigidBodies
+  body->setUserPointer(rigidBody.get());
+  body->setUserIndex(bodyId);
+  rigidBody->setWorldMutex(simulationMutex);
+  dynamicsWorld->addRigidBody(body);
+  bodyChanges.markChanged(body);
+  return bodyId;
+}
+
+void DiscreteDynamicWorldWrapper::eraseRigidBody(int bodyId, btRigidBody* body) {
+  transformSync.unbind(bodyId);
+  if (transformSync.size() == 0) {
+    transformManager = nullptr;
+  }
+  bodyChanges.forget(body);
+  static_cast<RigidBodyWrapper*>(body->getUserPointer())->setWorldMutex(nullptr);
+  body->setUserPointer(nullptr);
+  body->setUserIndex(-1);
+  rigidBodies.erase(bodyId);
+}
+
+namespace {
+  // Selects all pairs that contain one of the given proxies
+  class ProxiesPairCallback : public btOverlapCallback {
+  public:
+    explicit ProxiesPairCallback(const std::unordered_set<const btBroadphaseProxy*>& proxies) : _proxies(proxies) {}
+
+    bool processOverlap(btBroadphasePair& pair) override {
+      return _proxies.count(pair.m_pProxy0) != 0 || _proxies.count(pair.m_pProxy1) != 0;
+    }
+
+  private:
+    const std::unordered_set<const btBroadphaseProxy*>& _proxies;
+  };
+} // namespace
+
+void DiscreteDynamicWorldWrapper::removeFromDynamicsWorld(const std::vector<btRigidBody*>& bodies) {
+  if (bodies.empty()) {
+    return;
+  }
+  // Removing a single body searches the list of dynamic bodies and all overlapping pairs, which makes removing many bodies
+  // quadratic. Instead, filter both once for all bodies, then remove the collision objects, which is constant time per body.
+  std::unordered_set<const btRigidBody*> removedBodies(bodies.begin(), bodies.end());
+  btAlignedObjectArray<btRigidBody*>& nonStaticBodies = dynamicsWorld->getNonStaticRigidBodies();
+  int keptCount = 0;
+  for (int i = 0; i < nonStaticBodies.size(); i++) {
+    if (removedBodies.count(nonStaticBodies[i]) == 0) {
+      nonStaticBodies[keptCount++] = nonStaticBodies[i];
+    }
+  }
+  nonStaticBodies.resize(keptCount);
+
+  std::unordered_set<const btBroadphaseProxy*> proxies;
+  proxies.reserve(bodies.size());
+  for (btRigidBody* body : bodies) {
+    if (body->getBroadphaseHandle() != nullptr) {
+      proxies.insert(body->getBroadphaseHandle());
+    }
+  }
+  // Removes the pairs and frees their contact manifolds
+  ProxiesPairCallback removedPairs(proxies);
+  broadphase->m_paircache->processAllOverlappingPairs(&removedPairs, dynamicsWorld->getDispatcher());
+
+  // removeCollisionObject calls cleanProxyFromPairs and the broadphase's destroyProxy calls removeOverlappingPairsContainingProxy,
+  // both scan every pair in the cache, once per body. Cleaning each proxy from the pairs like that is what makes removing many
+  // bodies quadratic. Swapping in an empty cache for the loop is safe because:
+  // - The pairs of all removed proxies are already gone, removed above on the real cache in a single pass. That pass also freed
+  //   their manifolds and notified the cache's ghost pair callback, so the per-proxy scans have nothing left to find.
+  // - Besides these scans, removing a collision object doesn't access the pair cache.
+  // - Nothing else can observe the swap. The world is locked by simulationMutex, and the real cache is restored right after.
+  btHashedOverlappingPairCache emptyPairCache;
+  btOverlappingPairCache* pairCache = std::exchange(broadphase->m_paircache, &emptyPairCache);
+  for (btRigidBody* body : bodies) {
+    // Skips btDiscreteDynamicsWorld::removeRigidBody, the body is already out of the dynamic bodies
+    dynamicsWorld->btCollisionWorld::removeCollisionObject(body);
+  }
+  broadphase->m_paircache = pairCache;
 }
 
 void DiscreteDynamicWorldWrapper::stepSimulation(double timeStep, double maxSubSteps, double fixedTimeStep) {
-  dynamicsWorld->stepSimulation(timeStep, maxSubSteps, fixedTimeStep);
+  std::unique_lock lock(*simulationMutex);
+  if (isDrivenByClock) {
+    [[unlikely]];
+    throw std::runtime_error("The world is stepped by a PhysicsClock, stop the clock before calling stepSimulation!");
+  }
 
+  step(timeStep, static_cast<int>(maxSubSteps), fixedTimeStep);
+  if (transformSync.size() > 0) {
+    transformManager->syncRigidBodies(transformSync);
+  }
+  dispatchStepCallbacks();
+}
+
+void DiscreteDynamicWorldWrapper::step(double timeStep, int maxSubSteps, double fixedTimeStep) {
+  if (taskScheduler != nullptr) {
+#if BT_THREADSAFE
+    // The scheduler's Threads are shared with the other multithreaded worlds
+    std::unique_lock lock(BulletTaskScheduler::getGlobalMutex());
+    taskScheduler->install();
+    dynamicsWorld->stepSimulation(timeStep, maxSubSteps, fixedTimeStep);
+#endif
+  } else {
+    dynamicsWorld->stepSimulation(timeStep, maxSubSteps, fixedTimeStep);
+  }
+  bodyChanges.collect(dynamicsWorld->getNonStaticRigidBodies());
+}
+
+void DiscreteDynamicWorldWrapper::setIsDrivenByClock(bool isDriven) {
+  std::unique_lock lock(*simulationMutex);
+  if (isDriven && isDrivenByClock) {
+    [[unlikely]];
+    throw std::runtime_error("The world is already stepped by another PhysicsClock!");
+  }
+  isDrivenByClock = isDriven;
+}
+
+std::shared_ptr<TransformManagerImpl> DiscreteDynamicWorldWrapper::stepFixed(double timeStep,
+                                                                             std::vector<RigidBodyTransformSync::Pose>& poses) {
+  std::unique_lock lock(*simulationMutex);
+  // Without substeps Bullet steps exactly by timeStep, instead of accumulating time and interpolating the motion states
+  step(timeStep, 0, timeStep);
+  transformSync.capture(poses);
+  return transformManager;
+}
+
+void DiscreteDynamicWorldWrapper::dispatchStepCallbacks() {
+  std::unique_lock lock(*simulationMutex);
+  if (contactEventsCallback.has_value()) {
+    // All events of the internal steps since the previous dispatch at once
+    std::shared_ptr<TypedArray<double>> events = contactEvents.takeEvents();
+    if (events != nullptr) {
+      contactEventsCallback.value()(events);
+    }
+  }
+  dispatchCollisionCallbacks();
+}
+
+void DiscreteDynamicWorldWrapper::setContactEventsCallback(std::optional<ContactEventsCallback> callback) {
+  std::unique_lock lock(*simulationMutex);
+  contactEventsCallback = std::move(callback);
+  // Pairs that were touching before aren't tracked while no one listens, the next callback starts fresh
+  contactEvents.reset();
+}
+
+int DiscreteDynamicWorldWrapper::getBodyId(std::shared_ptr<RigidBodyWrapper> rigidBody) {
+  std::unique_lock lock(*simulationMutex);
+  if (!rigidBody) {
+    throw std::runtime_error("RigidBody is null");
+  }
+  int bodyId = rigidBody->getRigidBody()->getUserIndex();
+  std::shared_ptr<RigidBodyWrapper>* storedBody = rigidBodies.get(bodyId);
+  if (storedBody == nullptr || *storedBody != rigidBody) {
+    [[unlikely]];
+    throw std::runtime_error("RigidBody \"" + rigidBody->getId() + "\" has not been added to this world!");
+  }
+  return bodyId;
+}
+
+std::optional<std::shared_ptr<RigidBodyWrapper>> DiscreteDynamicWorldWrapper::getRigidBody(int bodyId) {
+  std::unique_lock lock(*simulationMutex);
+  std::shared_ptr<RigidBodyWrapper>* storedBody = rigidBodies.get(bodyId);
+  if (storedBody == nullptr) {
+    return std::nullopt;
+  }
+  return *storedBody;
+}
+
+void DiscreteDynamicWorldWrapper::bindEntity(std::shared_ptr<RigidBodyWrapper> rigidBody, std::shared_ptr<EntityWrapper> entityWrapper,
+                                             std::shared_ptr<TransformManagerWrapper> transformManagerWrapper) {
+  std::unique_lock lock(*simulationMutex);
+  if (!entityWrapper) {
+    throw std::invalid_argument("Entity is null");
+  }
+  if (!transformManagerWrapper) {
+    throw std::invalid_argument("TransformManager is null");
+  }
+  int bodyId = getBodyId(rigidBody);
+  // Each TransformManager wrapper of an engine accesses the same components, the last one is used for syncing
+  transformManager = transformManagerWrapper->getTransformManager();
+  transformManager->bindRigidBody(transformSync, bodyId, rigidBody->getRigidBody().get(), entityWrapper->getEntity());
+  // The next sync (or capture of a clock) includes every bound body once, also the ones that are asleep
+  transformSync.invalidate();
+}
+
+void DiscreteDynamicWorldWrapper::unbindEntity(std::shared_ptr<RigidBodyWrapper> rigidBody) {
+  std::unique_lock lock(*simulationMutex);
+  if (!rigidBody) {
+    throw std::runtime_error("RigidBody is null");
+  }
+  transformSync.unbind(rigidBody->getRigidBody()->getUserIndex());
+  if (transformSync.size() == 0) {
+    transformManager = nullptr;
+  }
+}
+
+std::shared_ptr<TypedArray<double>> DiscreteDynamicWorldWrapper::takeChangedBodies() {
+  std::unique_lock lock(*simulationMutex);
+  return bodyChanges.takeChanges();
+}
+
+std::unordered_map<std::string, double> DiscreteDynamicWorldWrapper::getSimulationStats() {
+  std::unique_lock lock(*simulationMutex);
+  size_t activeBodies = 0;
+  size_t sleepingBodies = 0;
+  size_t alwaysActiveBodies = 0;
+  size_t disabledBodies = 0;
+  // The island of every dynamic body is assigned in each step, static and kinematic bodies don't belong to an island
+  struct Island {
+    size_t bodiesCount = 0;
+    bool isSleeping = true;
+  };
+  std::unordered_map<int, Island> islands;
+  btAlignedObjectArray<btRigidBody*>& nonStaticBodies = dynamicsWorld->getNonStaticRigidBodies();
+  for (int i = 0; i < nonStaticBodies.size(); i++) {
+    const btRigidBody* body = nonStaticBodies[i];
+    switch (body->getActivationState()) {
+      case ISLAND_SLEEPING:
+        sleepingBodies++;
+        break;
+      case DISABLE_DEACTIVATION:
+        alwaysActiveBodies++;
+        break;
+      case DISABLE_SIMULATION:
+        disabledBodies++;
+        break;
+      default:
+        activeBodies++;
+        break;
+    }
+    if (body->getIslandTag() >= 0) {
+      Island& island = islands[body->getIslandTag()];
+      island.bodiesCount++;
+      island.isSleeping = island.isSleeping && body->getActivationState() == ISLAND_SLEEPING;
+    }
+  }
+
+  size_t sleepingIslands = 0;
+  size_t largestIsland = 0;
+  for (const auto& [tag, island] : islands) {
+    sleepingIslands += island.isSleeping ? 1 : 0;
+    largestIsland = std::max(largestIsland, island.bodiesCount);
+  }
+  return {{"bodies", static_cast<double>(rigidBodies.size())},
+          {"activeBodies", static_cast<double>(activeBodies)},
+          {"sleepingBodies", static_cast<double>(sleepingBodies)},
+          {"alwaysActiveBodies", static_cast<double>(alwaysActiveBodies)},
+          {"disabledBodies", static_cast<double>(disabledBodies)},
+          {"islands", static_cast<double>(islands.size())},
+          {"sleepingIslands", static_cast<double>(sleepingIslands)},
+          {"largestIsland", static_cast<double>(largestIsland)},
+          {"pendingChangedBodies", static_cast<double>(bodyChanges.getPendingCount())}};
+}
+
+void DiscreteDynamicWorldWrapper::dispatchCollisionCallbacks() {
   // Check for collisions
-  int numManifolds = dynamicsWorld->getDispatcher()->getNumManifolds();
+  btDispatcher* collisionDispatcher = dynamicsWorld->getDispatcher();
+  int numManifolds = collisionDispatcher->getNumManifolds();
   for (int i = 0; i < numManifolds; i++) {
-    btPersistentManifold* contactManifold = dynamicsWorld->getDispatcher()->getManifoldByIndexInternal(i);
-    const btCollisionObject* obA = contactManifold->getBody0();
-    const btCollisionObject* obB = contactManifold->getBody1();
+    btPersistentManifold* contactManifold = collisionDispatcher->getManifoldByIndexInternal(i);
+    // Set in addRigidBody, so this is null for collision objects that weren't added as a RigidBodyWrapper (e.g. ghost objects).
+    // Those are expected and can't have a collision callback, so they are skipped silently.
+    auto* wrapperA = static_cast<RigidBodyWrapper*>(contactManifold->getBody0()->getUserPointer());
+    auto* wrapperB = static_cast<RigidBodyWrapper*>(contactManifold->getBody1()->getUserPointer());
+    if (wrapperA == nullptr || wrapperB == nullptr) {
+      continue;
+    }
+    if (!wrapperA->hasCollisionCallback() && !wrapperB->hasCollisionCallback()) {
+      // No one is listening, skip checking the contacts
+      continue;
+    }
 
     bool isColliding = false;
     int numContacts = contactManifold->getNumContacts();
@@ -66,29 +477,8 @@ void DiscreteDynamicWorldWrapper::stepSimulation(double timeStep, double maxSubS
       continue;
     }
 
-    // Upcast to rigid bodies
-    const btRigidBody* bodyA = btRigidBody::upcast(obA);
-    const btRigidBody* bodyB = btRigidBody::upcast(obB);
-    if (!bodyA || !bodyB) {
-      Logger::log("DiscreteDynamicWorldWrapper", "Collision object is not a rigid body");
-      continue;
-    }
-    // Find the RigidBodyWrapper ptrs from the list of rigid bodies
-    std::shared_ptr<RigidBodyWrapper> rigidBodyA = nullptr;
-    std::shared_ptr<RigidBodyWrapper> rigidBodyB = nullptr;
-    for (auto& rb : *rigidBodies) {
-      if (rb->getRigidBody().get() == bodyA) {
-        rigidBodyA = rb;
-      }
-      if (rb->getRigidBody().get() == bodyB) {
-        rigidBodyB = rb;
-      }
-    }
-
-    if (!rigidBodyA || !rigidBodyB) {
-      Logger::log("DiscreteDynamicWorldWrapper", "RigidBodyWrapper not found for collision object");
-      continue;
-    }
+    std::shared_ptr<RigidBodyWrapper> rigidBodyA = wrapperA->shared<RigidBodyWrapper>();
+    std::shared_ptr<RigidBodyWrapper> rigidBodyB = wrapperB->shared<RigidBodyWrapper>();
 
     // Call the collision callback
     std::optional<CollisionCallback> collisionCallbackA = rigidBodyA->getCollisionCallback();
@@ -100,7 +490,6 @@ void DiscreteDynamicWorldWrapper::stepSimulation(double timeStep, double maxSubS
     std::optional<CollisionCallback> collisionCallbackB = rigidBodyB->getCollisionCallback();
     if (collisionCallbackB.has_value()) {
       CollisionCallback callback = collisionCallbackB.value();
-      std::string id = rigidBodyA->getId();
       callback(rigidBodyB, rigidBodyA);
     }
   }
@@ -4,34 +4,182 @@
 
 #pragma once
 
+#include "RNFBodyChangeTracker.h"
+#include "RNFBulletTaskScheduler.h"
+#include "RNFContactEventBuffer.h"
 #include "RNFRigidBodyWrapper.h"
+#include "RNFShapeCache.h"
+#include "RNFShapeWrapper.h"
+#include "RNFSlotMap.h"
+#include "core/RNFRigidBodyTransformSync.h"
+#include "core/RNFTransformManagerWrapper.h"
+#include "core/utils/RNFEntityWrapper.h"
 #include "jsi/RNFHybridObject.h"
+#include "jsi/RNFTypedArray.h"
 
 #include <btBulletDynamicsCommon.h>
 
-#include <list>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace margelo {
+
+// Receives all contact events of the internal steps since the previous call at once, packed as described in ContactEventBuffer
+using ContactEventsCallback = std::function<void(std::shared_ptr<TypedArray<double>> events)>;
+
 class DiscreteDynamicWorldWrapper : public HybridObject {
 public:
-  explicit DiscreteDynamicWorldWrapper(double gravityX, double gravityY, double gravityZ);
+  /**
+   * Creates a single-threaded `btDiscreteDynamicsWorld`, or if `threadsCount` is set a `btDiscreteDynamicsWorldMt` that runs
+   * collision detection and the constraint solver in parallel on that many threads (including the one calling stepSimulation).
+   * All multithreaded worlds share the threads of the first one (see BulletTaskScheduler::getShared). Without BT_THREADSAFE
+   * (the prebuilt Android libraries) `threadsCount` is ignored.
+   * If a shape cache is given, bodies created by `createRigidBodies` memoize their inertia there.
+   */
+  explicit DiscreteDynamicWorldWrapper(double gravityX, double gravityY, double gravityZ, std::optional<int> threadsCount = std::nullopt,
+                                       std::shared_ptr<ShapeCache> shapeCache = nullptr);
 
   void loadHybridMethods() override;
 
-private:
   void addRigidBody(std::shared_ptr<RigidBodyWrapper> rigidBody);
   void removeRigidBody(std::shared_ptr<RigidBodyWrapper> rigidBody);
+  /**
+   * Adds all bodies and returns their body ids, in the same order.
+   */
+  std::shared_ptr<TypedArray<int32_t>> addRigidBodies(std::vector<std::shared_ptr<RigidBodyWrapper>> rigidBodiesToAdd);
+  /**
+   * Creates and adds one body per `RIGID_BODY_STRIDE` values `[mass, x, y, z, shapeIndex]`, where `shapeIndex` points into `shapes`.
+   * Returns the body ids, the bodies can be looked up with `getRigidBody`.
+   */
+  std::shared_ptr<TypedArray<int32_t>> createRigidBodies(TypedArrayView<double> bodies, std::vector<std::shared_ptr<ShapeWrapper>> shapes);
+  /**
+   * Removes the bodies with the given ids in a single pass over the world, ids of bodies that aren't in the world are ignored.
+   */
+  void removeRigidBodies(TypedArrayView<int32_t> bodyIds);
   void stepSimulation(double timeStep, double maxSubSteps, double fixedTimeStep);
+  void setContactEventsCallback(std::optional<ContactEventsCallback> callback);
+  int getBodyId(std::shared_ptr<RigidBodyWrapper> rigidBody);
+  std::optional<std::shared_ptr<RigidBodyWrapper>> getRigidBody(int bodyId);
+  /**
+   * Binds the entity to the body, so its local transform follows the body after every `stepSimulation`.
+   * All bound entities are synced natively in one local transform transaction, skipping sleeping bodies.
+   * The entity's scale is kept as it is when binding. All entities must belong to the same engine.
+   */
+  void bindEntity(std::shared_ptr<RigidBodyWrapper> rigidBody, std::shared_ptr<EntityWrapper> entityWrapper,
+                  std::shared_ptr<TransformManagerWrapper> transformManagerWrapper);
+  void unbindEntity(std::shared_ptr<RigidBodyWrapper> rigidBody);
+  /**
+   * Returns the bodies that were added, moved or changed their activation state since the last call, as described in
+   * BodyChangeTracker. Sleeping bodies are only reported in the step they fell asleep.
+   */
+  std::shared_ptr<TypedArray<double>> takeChangedBodies();
+  /**
+   * Counts the bodies by activation state and the simulation islands (groups of touching bodies that sleep and wake together).
+   */
+  std::unordered_map<std::string, double> getSimulationStats();
+
+  // Queries, see RNFDiscreteDynamicWorldWrapper.Queries.cpp. Bodies are reported by their body id, or -1 for other collision objects.
+  /**
+   * Casts one ray per `RAY_STRIDE` values `[fromX, fromY, fromZ, toX, toY, toZ]` and returns the closest hit of each ray,
+   * as `HIT_STRIDE` values `[bodyId, fraction, pointX, pointY, pointZ, normalX, normalY, normalZ]` (bodyId -1 and fraction 1 if it missed).
+   */
+  std::shared_ptr<TypedArray<double>> rayTest(TypedArrayView<double> rays);
+  /**
+   * Casts the rays like `rayTest`, but returns all hits as `INDEXED_HIT_STRIDE` values `[rayIndex, ...hit]`, sorted by ray and fraction.
+   */
+  std::shared_ptr<TypedArray<double>> rayTestAll(TypedArrayView<double> rays);
+  /**
+   * Sweeps the convex shape (without rotation) along each of the `RAY_STRIDE` segments, and returns the closest hit of each
+   * sweep like `rayTest`.
+   */
+  std::shared_ptr<TypedArray<double>> convexSweepTest(std::shared_ptr<ShapeWrapper> shape, TypedArrayView<double> sweeps);
+  /**
+   * Places the shape (without rotation) at each of the `POSITION_STRIDE` positions and returns the bodies it touches, as
+   * `CONTACT_STRIDE` values `[positionIndex, bodyId, distance, pointX, pointY, pointZ, normalX, normalY, normalZ]` per body.
+   * The point is the deepest one on the body, and the normal points from the body towards the shape.
+   */
+  std::shared_ptr<TypedArray<double>> contactTest(std::shared_ptr<ShapeWrapper> shape, TypedArrayView<double> positions);
+
+  // Snapshots, see RNFDiscreteDynamicWorldWrapper.Snapshot.cpp
+  /**
+   * Writes the state of all bodies (transform, velocities, activation state, damping and friction) into a binary buffer.
+   */
+  std::shared_ptr<TypedArray<uint8_t>> snapshot();
+  /**
+   * Restores the state of the bodies in the snapshot that are still in the world, and returns how many were restored.
+   * The world's broadphase, contact caches and solver are rebuilt, so stepping after a restore only depends on the snapshot
+   * and the bodies in the world, not on what happened since the snapshot was taken.
+   */
+  int restore(TypedArrayView<uint8_t> snapshot);
+
+public: // Internal API, used by PhysicsClockWrapper
+  bool isMultithreaded() {
+    return taskScheduler != nullptr;
+  }
+  /**
+   * Hands stepping over to a clock, `stepSimulation` throws while the world is driven by a clock. Only one clock may drive a world.
+   */
+  void setIsDrivenByClock(bool isDrivenByClock);
+  /**
+   * Steps the world by exactly `timeStep` and captures the poses of the bound bodies, without calling into JS.
+   * Returns the TransformManager to apply the poses with, or nullptr if no entities are bound.
+   */
+  std::shared_ptr<TransformManagerImpl> stepFixed(double timeStep, std::vector<RigidBodyTransformSync::Pose>& poses);
+  /**
+   * Delivers the contact events of the internal steps since the previous call and the collision callbacks of the current
+   * contacts to JS. Must be called on the JS Thread of the Runtime that set the callbacks.
+   */
+  void dispatchStepCallbacks();
 
 private:
-  std::unique_ptr<btBroadphaseInterface> broadphase;
+  void createDynamicsWorld();
+  void createMultithreadedWorld();
+  static void onInternalTick(btDynamicsWorld* world, btScalar timeStep);
+  void rebuildDynamicsWorld();
+  int insertRigidBody(const std::shared_ptr<RigidBodyWrapper>& rigidBody);
+  void eraseRigidBody(int bodyId, btRigidBody* body);
+  void removeFromDynamicsWorld(const std::vector<btRigidBody*>& bodies);
+  void step(double timeStep, int maxSubSteps, double fixedTimeStep);
+  void dispatchCollisionCallbacks();
+
+private:
+  // Only set for multithreaded worlds, shared by all of them
+  std::shared_ptr<BulletTaskScheduler> taskScheduler;
+  std::unique_ptr<btDbvtBroadphase> broadphase;
   std::unique_ptr<btDefaultCollisionConfiguration> collisionConfiguration;
   std::unique_ptr<btCollisionDispatcher> dispatcher;
-  std::unique_ptr<btSequentialImpulseConstraintSolver> solver;
+  std::unique_ptr<btConstraintSolver> solver;
+  // A btConstraintSolverPoolMt that solves independent islands in parallel, only set for multithreaded worlds
+  std::unique_ptr<btConstraintSolver> solverPool;
   std::unique_ptr<btDiscreteDynamicsWorld> dynamicsWorld;
 
-  // Keep track of all bodies added to the world
-  std::shared_ptr<std::list<std::shared_ptr<RigidBodyWrapper>>> rigidBodies =
-      std::make_shared<std::list<std::shared_ptr<RigidBodyWrapper>>>();
+  // Guards the world while a clock steps it on its own Thread. Recursive, as callbacks may add or remove bodies.
+  // Shared with the bodies in this world, which lock it before changing their btRigidBody.
+  std::shared_ptr<std::recursive_mutex> simulationMutex = std::make_shared<std::recursive_mutex>();
+  bool isDrivenByClock = false;
+
+  // Keep track of all bodies added to the world, by the id stored in their user index
+  SlotMap<std::shared_ptr<RigidBodyWrapper>> rigidBodies;
+  std::shared_ptr<ShapeCache> shapeCache;
+
+  // Entities following the bodies, synced through the TransformManager they were bound with
+  RigidBodyTransformSync transformSync;
+  std::shared_ptr<TransformManagerImpl> transformManager;
+
+  std::optional<ContactEventsCallback> contactEventsCallback;
+  ContactEventBuffer contactEvents;
+  BodyChangeTracker bodyChanges;
+
+public:
+  static constexpr size_t RIGID_BODY_STRIDE = 5;
+  static constexpr size_t RAY_STRIDE = 6;
+  static constexpr size_t HIT_STRIDE = 8;
+  static constexpr size_t INDEXED_HIT_STRIDE = 9;
+  static constexpr size_t POSITION_STRIDE = 3;
+  static constexpr size_t CONTACT_STRIDE = 9;
 };
 } // namespace margelo
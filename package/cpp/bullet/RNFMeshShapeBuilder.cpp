@@ -0,0 +1,107 @@
+#include "RNFMeshShapeBuilder.h"
+
+#include <BulletCollision/CollisionShapes/btShapeHull.h>
+
+#include <stdexcept>
+
+namespace margelo {
+
+// A hull needs at least a tetrahedron
+static constexpr size_t MIN_HULL_POINTS = 4;
+
+std::shared_ptr<btCollisionShape> MeshShapeBuilder::createConvexHull(const std::vector<GltfGeometryReader::Primitive>& primitives) {
+  std::vector<btVector3> points;
+  for (const GltfGeometryReader::Primitive& primitive : primitives) {
+    for (const math::float3& position : primitive.positions) {
+      points.emplace_back(position.x, position.y, position.z);
+    }
+  }
+  if (points.size() < MIN_HULL_POINTS) {
+    [[unlikely]];
+    throw std::invalid_argument("A convex hull needs at least " + std::to_string(MIN_HULL_POINTS) + " vertices, but the mesh has " +
+                                std::to_string(points.size()) + "!");
+  }
+  return createReducedHull(points);
+}
+
+std::shared_ptr<btCollisionShape> MeshShapeBuilder::createTriangleMesh(const std::vector<GltfGeometryReader::Primitive>& primitives) {
+  auto mesh = std::make_shared<btTriangleMesh>();
+  size_t verticesCount = 0;
+  size_t indicesCount = 0;
+  for (const GltfGeometryReader::Primitive& primitive : primitives) {
+    if (!primitive.triangleIndices.empty()) {
+      verticesCount += primitive.positions.size();
+      indicesCount += primitive.triangleIndices.size();
+    }
+  }
+  mesh->preallocateVertices(static_cast<int>(verticesCount));
+  mesh->preallocateIndices(static_cast<int>(indicesCount));
+
+  int baseIndex = 0;
+  for (const GltfGeometryReader::Primitive& primitive : primitives) {
+    if (primitive.triangleIndices.empty()) {
+      continue;
+    }
+    // Copies the vertices once and references them by index, instead of storing three vertices per triangle
+    for (const math::float3& position : primitive.positions) {
+      mesh->findOrAddVertex(btVector3(position.x, position.y, position.z), false);
+    }
+    for (size_t i = 0; i < primitive.triangleIndices.size(); i += 3) {
+      mesh->addTriangleIndices(baseIndex + static_cast<int>(primitive.triangleIndices[i]),
+                               baseIndex + static_cast<int>(primitive.triangleIndices[i + 1]),
+                               baseIndex + static_cast<int>(primitive.triangleIndices[i + 2]));
+    }
+    baseIndex += static_cast<int>(primitive.positions.size());
+  }
+  if (mesh->getNumTriangles() == 0) {
+    [[unlikely]];
+    throw std::invalid_argument("The mesh has no triangles!");
+  }
+
+  // The shape only references the mesh, so the deleter keeps it alive as long as the shape
+  auto* shape = new btBvhTriangleMeshShape(mesh.get(), true);
+  return std::shared_ptr<btCollisionShape>(shape, [mesh](btCollisionShape* shape) { delete shape; });
+}
+
+std::shared_ptr<btCollisionShape> MeshShapeBuilder::createCompound(const std::vector<GltfGeometryReader::Primitive>& primitives) {
+  auto children = std::make_shared<std::vector<std::unique_ptr<btConvexHullShape>>>();
+  std::vector<btVector3> points;
+  for (const GltfGeometryReader::Primitive& primitive : primitives) {
+    if (primitive.positions.size() < MIN_HULL_POINTS) {
+      continue;
+    }
+    points.clear();
+    for (const math::float3& position : primitive.positions) {
+      points.emplace_back(position.x, position.y, position.z);
+    }
+    children->push_back(createReducedHull(points));
+  }
+  if (children->empty()) {
+    [[unlikely]];
+    throw std::invalid_argument("The mesh has no primitive with enough vertices for a convex hull!");
+  }
+
+  auto* shape = new btCompoundShape(true, static_cast<int>(children->size()));
+  btTransform identity;
+  identity.setIdentity();
+  for (const std::unique_ptr<btConvexHullShape>& child : *children) {
+    // The vertices are already in the compound's space
+    shape->addChildShape(identity, child.get());
+  }
+  // The compound only references its children, so the deleter keeps them alive as long as the compound
+  return std::shared_ptr<btCollisionShape>(shape, [children](btCollisionShape* shape) { delete shape; });
+}
+
+std::unique_ptr<btConvexHullShape> MeshShapeBuilder::createReducedHull(const std::vector<btVector3>& points) {
+  btConvexHullShape hull(reinterpret_cast<const btScalar*>(points.data()), static_cast<int>(points.size()), sizeof(btVector3));
+  // Samples the hull's support points in a fixed set of directions, a detailed mesh collapses to a few dozen vertices
+  btShapeHull reduction(&hull);
+  if (!reduction.buildHull(hull.getMargin())) {
+    [[unlikely]];
+    throw std::runtime_error("Failed to build a convex hull, are all vertices on a plane?");
+  }
+  return std::make_unique<btConvexHullShape>(reinterpret_cast<const btScalar*>(reduction.getVertexPointer()), reduction.numVertices(),
+                                             sizeof(btVector3));
+}
+
+} // namespace margelo
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "core/RNFGltfGeometryReader.h"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <memory>
+#include <vector>
+
+namespace margelo {
+
+// Builds collision shapes from mesh geometry, as read by GltfGeometryReader.
+// The returned shapes own everything they reference (triangle meshes, child shapes), so they can be shared like primitive shapes.
+class MeshShapeBuilder {
+public:
+  /**
+   * A convex hull around the vertices of all primitives, reduced to the few (at most 42) vertices that shape it the most.
+   */
+  static std::shared_ptr<btCollisionShape> createConvexHull(const std::vector<GltfGeometryReader::Primitive>& primitives);
+
+  /**
+   * The exact triangles of all primitives, in a bounding volume hierarchy. Only usable for static (mass 0) bodies.
+   */
+  static std::shared_ptr<btCollisionShape> createTriangleMesh(const std::vector<GltfGeometryReader::Primitive>& primitives);
+
+  /**
+   * One reduced convex hull per primitive, for dynamic bodies of concave objects that are made of convex parts.
+   */
+  static std::shared_ptr<btCollisionShape> createCompound(const std::vector<GltfGeometryReader::Primitive>& primitives);
+
+private:
+  static std::unique_ptr<btConvexHullShape> createReducedHull(const std::vector<btVector3>& points);
+};
+
+} // namespace margelo
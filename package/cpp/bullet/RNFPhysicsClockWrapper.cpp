@@ -0,0 +1,181 @@
+#include "RNFPhysicsClockWrapper.h"
+#include "RNFLogger.h"
+
+#include <algorithm>
+#include <pthread.h>
+
+namespace margelo {
+
+PhysicsClockWrapper::PhysicsClockWrapper(std::shared_ptr<DiscreteDynamicWorldWrapper> world, std::shared_ptr<Choreographer> choreographer,
+                                         double fixedTimeStep, int maxCatchUpSteps)
+    : HybridObject(TAG), _world(world), _choreographer(choreographer),
+      _fixedTimeStep(std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(fixedTimeStep))),
+      _fixedTimeStepSeconds(fixedTimeStep), _maxCatchUpSteps(maxCatchUpSteps) {
+  if (fixedTimeStep <= 0) {
+    [[unlikely]];
+    throw std::invalid_argument("fixedTimeStep must be greater than 0, but was " + std::to_string(fixedTimeStep) + "!");
+  }
+  if (maxCatchUpSteps < 1) {
+    [[unlikely]];
+    throw std::invalid_argument("maxCatchUpSteps must be at least 1, but was " + std::to_string(maxCatchUpSteps) + "!");
+  }
+  if (world->isMultithreaded()) {
+    [[unlikely]];
+    // Bullet's task scheduler can only be installed from the Thread that used it first
+    throw std::invalid_argument("Multithreaded worlds can't be stepped by a PhysicsClock!");
+  }
+}
+
+PhysicsClockWrapper::~PhysicsClockWrapper() {
+  stop();
+}
+
+void PhysicsClockWrapper::loadHybridMethods() {
+  registerHybridMethod("start", &PhysicsClockWrapper::start);
+  registerHybridMethod("stop", &PhysicsClockWrapper::stop);
+  registerHybridGetter("isRunning", &PhysicsClockWrapper::getIsRunning);
+  registerHybridGetter("stepsCount", &PhysicsClockWrapper::getStepsCount);
+}
+
+jsi::Value PhysicsClockWrapper::start(jsi::Runtime& runtime, const jsi::Value&, const jsi::Value*, size_t) {
+  std::unique_lock lock(_mutex);
+  if (_isRunning) {
+    return jsi::Value::undefined();
+  }
+
+  _jsDispatcher = Dispatcher::getRuntimeGlobalDispatcher(runtime);
+  _world->setIsDrivenByClock(true);
+  _isRunning = true;
+  _thread = std::thread([this]() { runLoop(); });
+
+  std::weak_ptr<PhysicsClockWrapper> weakThis = shared<PhysicsClockWrapper>();
+  _frameListener = _choreographer->addOnFrameListener([weakThis](double) {
+    auto sharedThis = weakThis.lock();
+    if (sharedThis) {
+      sharedThis->onFrame();
+    }
+  });
+  Logger::log(TAG, "Started stepping every %f seconds", _fixedTimeStepSeconds);
+  return jsi::Value::undefined();
+}
+
+void PhysicsClockWrapper::stop() {
+  std::unique_lock lock(_mutex);
+  if (!_isRunning) {
+    return;
+  }
+
+  _isRunning = false;
+  lock.unlock();
+  _stopCondition.notify_all();
+  _thread.join();
+  lock.lock();
+
+  if (_frameListener != nullptr) {
+    _frameListener->remove();
+    _frameListener = nullptr;
+  }
+  _world->setIsDrivenByClock(false);
+  Logger::log(TAG, "Stopped after %zu steps", _stepsCount);
+}
+
+bool PhysicsClockWrapper::getIsRunning() {
+  std::unique_lock lock(_mutex);
+  return _isRunning;
+}
+
+double PhysicsClockWrapper::getStepsCount() {
+  std::unique_lock lock(_posesMutex);
+  return static_cast<double>(_stepsCount);
+}
+
+void PhysicsClockWrapper::runLoop() {
+#if defined(__APPLE__)
+  pthread_setname_np("RNF.Physics");
+#else
+  pthread_setname_np(pthread_self(), "RNF.Physics");
+#endif
+
+  std::vector<RigidBodyTransformSync::Pose> poses;
+  auto stepTime = std::chrono::steady_clock::now();
+  std::unique_lock lock(_mutex);
+  while (_isRunning) {
+    lock.unlock();
+    std::shared_ptr<TransformManagerImpl> transformManager;
+    try {
+      transformManager = _world->stepFixed(_fixedTimeStepSeconds, poses);
+    } catch (const std::exception& exception) {
+      Logger::log(TAG, "Failed to step the world: %s", exception.what());
+    }
+    {
+      std::unique_lock posesLock(_posesMutex);
+      std::swap(_previousPoses, _currentPoses);
+      // The captured poses become the current ones, and the now unused buffer is reused by the next capture
+      std::swap(_currentPoses, poses);
+      _currentPosesTime = stepTime;
+      _transformManager = std::move(transformManager);
+      _stepsCount++;
+    }
+
+    stepTime += _fixedTimeStep;
+    auto now = std::chrono::steady_clock::now();
+    if (now - stepTime > _fixedTimeStep * _maxCatchUpSteps) {
+      [[unlikely]];
+      // Fell too far behind (e.g. the app was in the background), skip the time instead of stepping in a burst
+      stepTime = now;
+    }
+    lock.lock();
+    _stopCondition.wait_until(lock, stepTime, [this]() { return !_isRunning; });
+  }
+}
+
+void PhysicsClockWrapper::onFrame() {
+  std::shared_ptr<TransformManagerImpl> transformManager;
+  std::chrono::steady_clock::time_point currentPosesTime;
+  size_t stepsCount;
+  {
+    std::unique_lock lock(_posesMutex);
+    if (_stepsCount == 0) {
+      return;
+    }
+    // Copy the poses, so the physics Thread doesn't wait for us to apply them
+    _renderPreviousPoses.assign(_previousPoses.begin(), _previousPoses.end());
+    _renderCurrentPoses.assign(_currentPoses.begin(), _currentPoses.end());
+    currentPosesTime = _currentPosesTime;
+    transformManager = _transformManager;
+    stepsCount = _stepsCount;
+  }
+
+  if (transformManager != nullptr) {
+    // We render one step behind, so the time since the current step is how far we are between the previous and current step
+    std::chrono::duration<double> timeSinceStep = std::chrono::steady_clock::now() - currentPosesTime;
+    float alpha = static_cast<float>(std::clamp(timeSinceStep.count() / _fixedTimeStepSeconds, 0.0, 1.0));
+    transformManager->syncRigidBodies(_renderPreviousPoses, _renderCurrentPoses, alpha);
+  }
+
+  if (stepsCount != _renderedStepsCount) {
+    _renderedStepsCount = stepsCount;
+    // The events are collected when the dispatch runs, so while one is still queued (e.g. the JS Thread is busy) it will
+    // deliver the events of the new steps as well
+    if (!_isDispatchPending.exchange(true)) {
+      std::weak_ptr<PhysicsClockWrapper> weakThis = shared<PhysicsClockWrapper>();
+      _jsDispatcher->runAsync([weakThis]() {
+        auto sharedThis = weakThis.lock();
+        if (sharedThis) {
+          sharedThis->dispatchStepCallbacks();
+        }
+      });
+    }
+  }
+}
+
+void PhysicsClockWrapper::dispatchStepCallbacks() {
+  _isDispatchPending = false;
+  try {
+    _world->dispatchStepCallbacks();
+  } catch (const std::exception& exception) {
+    Logger::log(TAG, "A contact or collision callback threw an error: %s", exception.what());
+  }
+}
+
+} // namespace margelo
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "RNFChoreographer.h"
+#include "RNFDiscreteDynamicWorldWrapper.h"
+#include "RNFListener.h"
+#include "core/RNFRigidBodyTransformSync.h"
+#include "jsi/RNFHybridObject.h"
+#include "threading/RNFDispatcher.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace margelo {
+
+// Steps a world with a fixed time step on its own Thread, decoupled from the JS Thread and the frame rate.
+// After every step the poses of the world's bound entities (see DiscreteDynamicWorldWrapper::bindEntity) are captured into
+// a double buffer. On every frame of the Choreographer, the entities are set to the poses interpolated between the last two
+// steps. The contact events and collision callbacks of the steps since the previous frame are then delivered on the JS Thread of
+// the Runtime that started the clock.
+// Rendering is one step behind the simulation, so the interpolation never has to extrapolate.
+class PhysicsClockWrapper : public HybridObject {
+public:
+  static constexpr double DEFAULT_FIXED_TIME_STEP = 1.0 / 60.0;
+  static constexpr int DEFAULT_MAX_CATCH_UP_STEPS = 5;
+
+  explicit PhysicsClockWrapper(std::shared_ptr<DiscreteDynamicWorldWrapper> world, std::shared_ptr<Choreographer> choreographer,
+                               double fixedTimeStep, int maxCatchUpSteps);
+  ~PhysicsClockWrapper() override;
+
+  void loadHybridMethods() override;
+
+private: // Exposed JS API
+  jsi::Value start(jsi::Runtime& runtime, const jsi::Value&, const jsi::Value*, size_t);
+  void stop();
+  bool getIsRunning();
+  double getStepsCount();
+
+private:
+  void runLoop();
+  void onFrame();
+  void dispatchStepCallbacks();
+
+private:
+  std::shared_ptr<DiscreteDynamicWorldWrapper> _world;
+  std::shared_ptr<Choreographer> _choreographer;
+  std::chrono::steady_clock::duration _fixedTimeStep;
+  double _fixedTimeStepSeconds;
+  int _maxCatchUpSteps;
+
+  std::mutex _mutex;
+  std::condition_variable _stopCondition;
+  bool _isRunning = false;
+  std::thread _thread;
+  std::shared_ptr<Listener> _frameListener;
+
+  // Written by the physics Thread after every step
+  std::mutex _posesMutex;
+  std::vector<RigidBodyTransformSync::Pose> _previousPoses;
+  std::vector<RigidBodyTransformSync::Pose> _currentPoses;
+  // The time the current poses belong to, the previous ones are one step older
+  std::chrono::steady_clock::time_point _currentPosesTime;
+  std::shared_ptr<TransformManagerImpl> _transformManager;
+  size_t _stepsCount = 0;
+
+  // Only accessed on the render Thread
+  std::vector<RigidBodyTransformSync::Pose> _renderPreviousPoses;
+  std::vector<RigidBodyTransformSync::Pose> _renderCurrentPoses;
+  size_t _renderedStepsCount = 0;
+
+  // The callbacks hold JS functions, so they are only called on the Thread of the Runtime that started the clock
+  std::shared_ptr<Dispatcher> _jsDispatcher;
+  std::atomic<bool> _isDispatchPending = false;
+
+private:
+  static constexpr auto TAG = "PhysicsClockWrapper";
+};
+
+} // namespace margelo
@@ -8,7 +8,8 @@
 
 namespace margelo {
 RigidBodyWrapper::RigidBodyWrapper(double mass, std::shared_ptr<btCollisionShape> shape, std::unique_ptr<btMotionState> motionState,
-                                   std::string id, std::optional<CollisionCallback> collisionCallback)
+                                   std::string id, std::optional<CollisionCallback> collisionCallback,
+                                   const std::shared_ptr<ShapeCache>& shapeCache)
     : HybridObject("RigidBodyWrapper") {
   _shape = shape;
   _motionState = std::move(motionState);
@@ -18,7 +19,11 @@ RigidBodyWrapper::RigidBodyWrapper(double mass, std::shared_ptr<btCollisionShape
 
   btVector3 localInertia(0, 0, 0);
   if (mass != 0.0) {
-    _shape->calculateLocalInertia(mass, localInertia);
+    if (shapeCache != nullptr) {
+      localInertia = shapeCache->calculateLocalInertia(_shape, mass);
+    } else {
+      _shape->calculateLocalInertia(mass, localInertia);
+    }
   }
 
   btRigidBody::btRigidBodyConstructionInfo rigidBodyCI(mass, _motionState.get(), _shape.get(), localInertia);
@@ -27,17 +32,19 @@ RigidBodyWrapper::RigidBodyWrapper(double mass, std::shared_ptr<btCollisionShape
 
 std::shared_ptr<RigidBodyWrapper> RigidBodyWrapper::create(double mass, double x, double y, double z,
                                                            std::shared_ptr<btCollisionShape> shape, std::string id,
-                                                           std::optional<CollisionCallback> collisionCallback) {
+                                                           std::optional<CollisionCallback> collisionCallback,
+                                                           const std::shared_ptr<ShapeCache>& shapeCache) {
   btTransform transform;
   transform.setIdentity();
   transform.setOrigin(btVector3(x, y, z));
   auto motionState = std::make_unique<btDefaultMotionState>(transform);
-  return std::make_shared<RigidBodyWrapper>(mass, shape, std::move(motionState), id, collisionCallback);
+  return std::make_shared<RigidBodyWrapper>(mass, shape, std::move(motionState), id, collisionCallback, shapeCache);
 }
 
 std::shared_ptr<RigidBodyWrapper> RigidBodyWrapper::create(double mass, std::shared_ptr<TMat44Wrapper> entityTransform,
                                                            std::shared_ptr<btCollisionShape> shape, std::string id,
-                                                           std::optional<CollisionCallback> collisionCallback) {
+                                                           std::optional<CollisionCallback> collisionCallback,
+                                                           const std::shared_ptr<ShapeCache>& shapeCache) {
   // EntityTransform to openGL matrix:
   const filament::math::mat4f& mat = entityTransform->getMat();
 
@@ -66,29 +73,49 @@ std::shared_ptr<RigidBodyWrapper> RigidBodyWrapper::create(double mass, std::sha
 
   // Set the transform to the motion state and make a new RigidBodyWrapper:
   auto motionState = std::make_unique<btDefaultMotionState>(transform);
-  return std::make_shared<RigidBodyWrapper>(mass, shape, std::move(motionState), id, collisionCallback);
+  return std::make_shared<RigidBodyWrapper>(mass, shape, std::move(motionState), id, collisionCallback, shapeCache);
 }
 
 void RigidBodyWrapper::loadHybridMethods() {
-  registerHybridMethod("setDamping", &RigidBodyWrapper::setDamping, this);
-  registerHybridSetter("friction", &RigidBodyWrapper::setFriction, this);
-  registerHybridGetter("friction", &RigidBodyWrapper::getFriction, this);
-  registerHybridSetter("activationState", &RigidBodyWrapper::setActivationState, this);
-  registerHybridGetter("activationState", &RigidBodyWrapper::getActivationState, this);
-  registerHybridGetter("id", &RigidBodyWrapper::getId, this);
-  registerHybridSetter("id", &RigidBodyWrapper::setId, this);
-  registerHybridMethod("setCollisionCallback", &RigidBodyWrapper::setCollisionCallback, this);
+  registerHybridMethod("setDamping", &RigidBodyWrapper::setDamping);
+  registerHybridSetter("friction", &RigidBodyWrapper::setFriction);
+  registerHybridGetter("friction", &RigidBodyWrapper::getFriction);
+  registerHybridSetter("activationState", &RigidBodyWrapper::setActivationState);
+  registerHybridGetter("activationState", &RigidBodyWrapper::getActivationState);
+  registerHybridGetter("id", &RigidBodyWrapper::getId);
+  registerHybridSetter("id", &RigidBodyWrapper::setId);
+  registerHybridMethod("setCollisionCallback", &RigidBodyWrapper::setCollisionCallback);
+}
+
+void RigidBodyWrapper::setWorldMutex(std::shared_ptr<std::recursive_mutex> worldMutex) {
+  std::unique_lock lock(_worldMutexGuard);
+  _worldMutex = std::move(worldMutex);
+}
+
+RigidBodyWrapper::WorldLock RigidBodyWrapper::lockWorld() {
+  WorldLock worldLock;
+  {
+    std::unique_lock lock(_worldMutexGuard);
+    worldLock.mutex = _worldMutex;
+  }
+  if (worldLock.mutex != nullptr) {
+    worldLock.lock = std::unique_lock(*worldLock.mutex);
+  }
+  return worldLock;
 }
 
 void RigidBodyWrapper::setDamping(double linearDamping, double angularDamping) {
+  WorldLock lock = lockWorld();
   _rigidBody->setDamping(linearDamping, angularDamping);
 }
 
 void RigidBodyWrapper::setFriction(double friction) {
+  WorldLock lock = lockWorld();
   _rigidBody->setFriction(friction);
 }
 
 double RigidBodyWrapper::getFriction() {
+  WorldLock lock = lockWorld();
   return _rigidBody->getFriction();
 }
 
@@ -96,10 +123,12 @@ void RigidBodyWrapper::setActivationState(std::string activationState) {
   ActivationState state;
   EnumMapper::convertJSUnionToEnum(activationState, &state);
 
+  WorldLock lock = lockWorld();
   _rigidBody->setActivationState(static_cast<int>(state));
 }
 
 std::string RigidBodyWrapper::getActivationState() {
+  WorldLock lock = lockWorld();
   ActivationState state = static_cast<ActivationState>(_rigidBody->getActivationState());
   std::string stateString;
   EnumMapper::convertEnumToJSUnion(state, &stateString);
@@ -115,6 +144,8 @@ std::string RigidBodyWrapper::getId() {
 }
 
 void RigidBodyWrapper::setCollisionCallback(std::optional<CollisionCallback> callback) {
+  // The world reads it while dispatching collisions
+  WorldLock lock = lockWorld();
   _collisionCallback = std::move(callback);
 }
 std::optional<CollisionCallback> RigidBodyWrapper::getCollisionCallback() {
@@ -5,11 +5,14 @@
 #pragma once
 
 #include "RNFActivationStateEnum.h"
+#include "RNFShapeCache.h"
 #include "core/RNFFilamentAssetWrapper.h"
 #include "core/math/RNFTMat44Wrapper.h"
 #include "jsi/RNFHybridObject.h"
 
 #include <btBulletDynamicsCommon.h>
+#include <memory>
+#include <mutex>
 
 namespace margelo {
 
@@ -21,17 +24,25 @@ class RigidBodyWrapper;
  */
 using CollisionCallback = std::function<void(std::shared_ptr<RigidBodyWrapper>&, const std::shared_ptr<RigidBodyWrapper>)>;
 
+/**
+ * Wraps a btRigidBody for JS. Once the body has been added to a world, every change (and read) from JS locks that world's
+ * simulation mutex, as a PhysicsClock might be stepping the world on its own Thread at the same time.
+ */
 class RigidBodyWrapper : public HybridObject {
 public:
+  // If a shape cache is given, the local inertia of cached shapes is memoized there
   explicit RigidBodyWrapper(double mass, std::shared_ptr<btCollisionShape> shape, std::unique_ptr<btMotionState> motionState,
-                            std::string id, std::optional<CollisionCallback> collisionCallback);
+                            std::string id, std::optional<CollisionCallback> collisionCallback,
+                            const std::shared_ptr<ShapeCache>& shapeCache = nullptr);
 
   // These create functions are wrapper around the constructor and will create the motion state and then construct the RigidBodyWrapper
   static std::shared_ptr<RigidBodyWrapper> create(double mass, double x, double y, double z, std::shared_ptr<btCollisionShape> shape,
-                                                  std::string id, std::optional<CollisionCallback> collisionCallback);
+                                                  std::string id, std::optional<CollisionCallback> collisionCallback,
+                                                  const std::shared_ptr<ShapeCache>& shapeCache = nullptr);
   static std::shared_ptr<RigidBodyWrapper> create(double mass, std::shared_ptr<TMat44Wrapper> entityTransform,
                                                   std::shared_ptr<btCollisionShape> shape, std::string id,
-                                                  std::optional<CollisionCallback> collisionCallback);
+                                                  std::optional<CollisionCallback> collisionCallback,
+                                                  const std::shared_ptr<ShapeCache>& shapeCache = nullptr);
 
   void loadHybridMethods() override;
   std::shared_ptr<btRigidBody> getRigidBody() {
@@ -42,6 +53,23 @@ public:
   std::string getId();
   void setCollisionCallback(std::optional<CollisionCallback> callback);
   std::optional<CollisionCallback> getCollisionCallback();
+  bool hasCollisionCallback() {
+    return _collisionCallback.has_value();
+  }
+  /**
+   * Sets the simulation mutex of the world this body has been added to, or `nullptr` once it has been removed again.
+   * Called by the world while it holds that mutex.
+   */
+  void setWorldMutex(std::shared_ptr<std::recursive_mutex> worldMutex);
+
+private:
+  struct WorldLock {
+    // Keeps the mutex alive while it is locked, the world might be destroyed meanwhile
+    std::shared_ptr<std::recursive_mutex> mutex;
+    std::unique_lock<std::recursive_mutex> lock;
+  };
+  // Locks the world this body is in, or nothing if it is not in a world
+  WorldLock lockWorld();
 
 private:
   void setDamping(double linearDamping, double angularDamping);
@@ -56,6 +84,9 @@ private:
   std::shared_ptr<btRigidBody> _rigidBody;
   std::shared_ptr<btCollisionShape> _shape;
   std::unique_ptr<btMotionState> _motionState;
+  // Guards _worldMutex itself, which is set by the world's Thread while JS might read it
+  std::mutex _worldMutexGuard;
+  std::shared_ptr<std::recursive_mutex> _worldMutex;
 };
 
 } // namespace margelo
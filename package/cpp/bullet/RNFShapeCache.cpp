@@ -0,0 +1,116 @@
+#include "RNFShapeCache.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace margelo {
+
+size_t ShapeCache::KeyHasher::operator()(const Key& key) const {
+  size_t hash = std::hash<int>()(static_cast<int>(key.type));
+  auto combine = [&hash](double value) { hash ^= std::hash<double>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+  std::for_each(key.dimensions.begin(), key.dimensions.end(), combine);
+  std::for_each(key.localScaling.begin(), key.localScaling.end(), combine);
+  combine(key.margin.value_or(-1));
+  return hash;
+}
+
+std::shared_ptr<btCollisionShape> ShapeCache::acquire(const Key& key) {
+  std::unique_lock lock(_mutex);
+  auto iterator = _entries.find(key);
+  if (iterator != _entries.end()) {
+    std::shared_ptr<btCollisionShape> shape = iterator->second.shape.lock();
+    if (shape != nullptr) {
+      _shapeHits++;
+      return shape;
+    }
+    // The shape was destroyed, its address might already be used by another shape
+    auto keyByShape = _keysByShape.find(iterator->second.address);
+    if (keyByShape != _keysByShape.end() && keyByShape->second == key) {
+      _keysByShape.erase(keyByShape);
+    }
+  }
+
+  _shapeMisses++;
+  pruneIfNeeded();
+  std::shared_ptr<btCollisionShape> shape = createShape(key);
+  _entries[key] = Entry{shape, shape.get()};
+  _keysByShape[shape.get()] = key;
+  return shape;
+}
+
+btVector3 ShapeCache::calculateLocalInertia(const std::shared_ptr<btCollisionShape>& shape, btScalar mass) {
+  btVector3 localInertia(0, 0, 0);
+  std::unique_lock lock(_mutex);
+  auto keyIterator = _keysByShape.find(shape.get());
+  auto entryIterator = keyIterator != _keysByShape.end() ? _entries.find(keyIterator->second) : _entries.end();
+  // The address could also belong to a new shape that isn't cached, if the cached one was destroyed
+  if (entryIterator == _entries.end() || entryIterator->second.shape.lock() != shape) {
+    lock.unlock();
+    shape->calculateLocalInertia(mass, localInertia);
+    return localInertia;
+  }
+
+  std::vector<std::pair<btScalar, btVector3>>& inertias = entryIterator->second.inertias;
+  auto inertia = std::find_if(inertias.begin(), inertias.end(), [mass](const auto& inertia) { return inertia.first == mass; });
+  if (inertia != inertias.end()) {
+    _inertiaHits++;
+    return inertia->second;
+  }
+
+  _inertiaMisses++;
+  shape->calculateLocalInertia(mass, localInertia);
+  inertias.emplace_back(mass, localInertia);
+  return localInertia;
+}
+
+ShapeCache::Stats ShapeCache::getStats() {
+  std::unique_lock lock(_mutex);
+  size_t residentShapes = std::count_if(_entries.begin(), _entries.end(), [](const auto& entry) { return !entry.second.shape.expired(); });
+  return Stats{_shapeHits, _shapeMisses, residentShapes, _inertiaHits, _inertiaMisses};
+}
+
+void ShapeCache::pruneIfNeeded() {
+  if (_entries.size() < _pruneThreshold) {
+    return;
+  }
+  for (auto iterator = _keysByShape.begin(); iterator != _keysByShape.end();) {
+    iterator = _entries.at(iterator->second).shape.expired() ? _keysByShape.erase(iterator) : std::next(iterator);
+  }
+  for (auto iterator = _entries.begin(); iterator != _entries.end();) {
+    iterator = iterator->second.shape.expired() ? _entries.erase(iterator) : std::next(iterator);
+  }
+  // Grow with the number of live shapes, so pruning stays amortized constant per created shape
+  _pruneThreshold = std::max(MIN_PRUNE_THRESHOLD, _entries.size() * 2);
+}
+
+std::shared_ptr<btCollisionShape> ShapeCache::createShape(const Key& key) {
+  const std::array<double, 4>& d = key.dimensions;
+  std::shared_ptr<btCollisionShape> shape;
+  switch (key.type) {
+    case ShapeType::Box:
+      shape = std::make_shared<btBoxShape>(btVector3(d[0], d[1], d[2]));
+      break;
+    case ShapeType::Cylinder:
+      shape = std::make_shared<btCylinderShape>(btVector3(d[0], d[1], d[2]));
+      break;
+    case ShapeType::CylinderX:
+      shape = std::make_shared<btCylinderShapeX>(btVector3(d[0], d[1], d[2]));
+      break;
+    case ShapeType::CylinderZ:
+      shape = std::make_shared<btCylinderShapeZ>(btVector3(d[0], d[1], d[2]));
+      break;
+    case ShapeType::StaticPlane:
+      shape = std::make_shared<btStaticPlaneShape>(btVector3(d[0], d[1], d[2]), d[3]);
+      break;
+    case ShapeType::Sphere:
+      shape = std::make_shared<btSphereShape>(d[0]);
+      break;
+  }
+  shape->setLocalScaling(btVector3(key.localScaling[0], key.localScaling[1], key.localScaling[2]));
+  if (key.margin.has_value()) {
+    shape->setMargin(key.margin.value());
+  }
+  return shape;
+}
+
+} // namespace margelo
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <btBulletDynamicsCommon.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace margelo {
+
+// Shares one btCollisionShape between all primitive shapes with the same type, dimensions, scaling and margin,
+// and memoizes their local inertia per mass. Spawning many identical bodies then only creates one shape.
+// Cached shapes are never mutated, as bodies may be using them while a world steps: Changing the scaling or margin
+// of a ShapeWrapper switches it to the (cached) shape with the new values instead.
+// Shapes are held weakly, once no ShapeWrapper or body uses a shape anymore it is destroyed.
+class ShapeCache {
+public:
+  enum class ShapeType { Box, Cylinder, CylinderX, CylinderZ, StaticPlane, Sphere };
+
+  struct Key {
+    ShapeType type;
+    // Half extents, normal and constant or radius, depending on the type
+    std::array<double, 4> dimensions;
+    std::array<double, 3> localScaling = {1, 1, 1};
+    // The shape type's default margin if not set
+    std::optional<double> margin = std::nullopt;
+
+    bool operator==(const Key& other) const {
+      return type == other.type && dimensions == other.dimensions && localScaling == other.localScaling && margin == other.margin;
+    }
+  };
+
+  struct Stats {
+    size_t shapeHits;
+    size_t shapeMisses;
+    size_t residentShapes;
+    size_t inertiaHits;
+    size_t inertiaMisses;
+  };
+
+  /**
+   * Returns the shape for the given key, creating it if no shape with that key is alive.
+   */
+  std::shared_ptr<btCollisionShape> acquire(const Key& key);
+
+  /**
+   * Calculates the local inertia of the given shape for the given mass, memoized if the shape is a cached one.
+   */
+  btVector3 calculateLocalInertia(const std::shared_ptr<btCollisionShape>& shape, btScalar mass);
+
+  Stats getStats();
+
+private:
+  struct KeyHasher {
+    size_t operator()(const Key& key) const;
+  };
+  struct Entry {
+    std::weak_ptr<btCollisionShape> shape;
+    const btCollisionShape* address;
+    // Few bodies of the same shape have different masses, so this is searched linearly
+    std::vector<std::pair<btScalar, btVector3>> inertias;
+  };
+
+private:
+  static std::shared_ptr<btCollisionShape> createShape(const Key& key);
+  void pruneIfNeeded();
+
+private:
+  std::mutex _mutex;
+  std::unordered_map<Key, Entry, KeyHasher> _entries;
+  // To find the memoized inertias of a shape
+  std::unordered_map<const btCollisionShape*, Key> _keysByShape;
+  size_t _pruneThreshold = MIN_PRUNE_THRESHOLD;
+  size_t _shapeHits = 0;
+  size_t _shapeMisses = 0;
+  size_t _inertiaHits = 0;
+  size_t _inertiaMisses = 0;
+
+private:
+  // Expired entries are only dropped once the cache grew past this, so creating shapes stays cheap
+  static constexpr size_t MIN_PRUNE_THRESHOLD = 64;
+};
+
+} // namespace margelo
@@ -7,10 +7,10 @@
 namespace margelo {
 
 void margelo::ShapeWrapper::loadHybridMethods() {
-  registerHybridGetter("localScaling", &ShapeWrapper::getLocalScaling, this);
-  registerHybridSetter("localScaling", &ShapeWrapper::setLocalScaling, this);
-  registerHybridGetter("margin", &ShapeWrapper::getMargin, this);
-  registerHybridSetter("margin", &ShapeWrapper::setMargin, this);
+  registerHybridGetter("localScaling", &ShapeWrapper::getLocalScaling);
+  registerHybridSetter("localScaling", &ShapeWrapper::setLocalScaling);
+  registerHybridGetter("margin", &ShapeWrapper::getMargin);
+  registerHybridSetter("margin", &ShapeWrapper::setMargin);
 }
 
 std::vector<double> ShapeWrapper::getLocalScaling() {
@@ -19,6 +19,12 @@ std::vector<double> ShapeWrapper::getLocalScaling() {
 }
 
 void ShapeWrapper::setLocalScaling(const std::vector<double>& scaling) {
+  if (_shapeCache != nullptr) {
+    // Bodies created with the old shape keep it
+    _key->localScaling = {scaling[0], scaling[1], scaling[2]};
+    _shape = _shapeCache->acquire(_key.value());
+    return;
+  }
   _shape->setLocalScaling(btVector3(scaling[0], scaling[1], scaling[2]));
 }
 
@@ -27,6 +33,11 @@ double ShapeWrapper::getMargin() {
 }
 
 void ShapeWrapper::setMargin(double margin) {
+  if (_shapeCache != nullptr) {
+    _key->margin = margin;
+    _shape = _shapeCache->acquire(_key.value());
+    return;
+  }
   _shape->setMargin(margin);
 }
 } // namespace margelo
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "RNFShapeCache.h"
 #include "jsi/RNFHybridObject.h"
 #include <btBulletDynamicsCommon.h>
 
@@ -16,6 +17,9 @@ namespace margelo {
 class ShapeWrapper : public HybridObject {
 public:
   explicit ShapeWrapper(const char* name, std::shared_ptr<btCollisionShape> shape) : HybridObject(name), _shape(shape) {};
+  // A shape shared through the cache, see ShapeCache
+  explicit ShapeWrapper(const char* name, std::shared_ptr<ShapeCache> shapeCache, const ShapeCache::Key& key)
+      : HybridObject(name), _shape(shapeCache->acquire(key)), _shapeCache(shapeCache), _key(key) {};
 
   void loadHybridMethods() override;
 
@@ -31,5 +35,8 @@ private: // Public API
 
 private:
   std::shared_ptr<btCollisionShape> _shape;
+  // Only set for cached shapes, which are replaced instead of mutated
+  std::shared_ptr<ShapeCache> _shapeCache;
+  std::optional<ShapeCache::Key> _key;
 };
 } // namespace margelo
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace margelo {
+
+// Stores values in reusable slots, addressed by ids that combine the slot's index with a generation.
+// Inserting, looking up and erasing are O(1) without hashing, and the ids of erased values stay invalid even after
+// their slot is reused (until the generation wraps around, after 2048 reuses of the same slot).
+// Ids are non-negative ints, so they fit into a btCollisionObject's user index.
+template <typename T> class SlotMap {
+public:
+  /**
+   * Stores the value and returns its id.
+   */
+  int insert(T value) {
+    uint32_t index;
+    if (!_freeIndices.empty()) {
+      index = _freeIndices.back();
+      _freeIndices.pop_back();
+    } else {
+      if (_slots.size() > INDEX_MASK) {
+        [[unlikely]];
+        throw std::runtime_error("Cannot store more than " + std::to_string(INDEX_MASK + 1) + " values!");
+      }
+      index = static_cast<uint32_t>(_slots.size());
+      _slots.emplace_back();
+    }
+    Slot& slot = _slots[index];
+    slot.value = std::move(value);
+    slot.isOccupied = true;
+    _size++;
+    return static_cast<int>((slot.generation << INDEX_BITS) | index);
+  }
+
+  /**
+   * Returns the value with the given id, or nullptr if it has been erased (or the id is invalid).
+   */
+  T* get(int id) {
+    Slot* slot = find(id);
+    return slot != nullptr ? &slot->value : nullptr;
+  }
+
+  /**
+   * Erases the value with the given id and returns whether it existed.
+   */
+  bool erase(int id) {
+    Slot* slot = find(id);
+    if (slot == nullptr) {
+      return false;
+    }
+    slot->value = T();
+    slot->isOccupied = false;
+    slot->generation = (slot->generation + 1) & GENERATION_MASK;
+    _freeIndices.push_back(static_cast<uint32_t>(id) & INDEX_MASK);
+    _size--;
+    return true;
+  }
+
+  /**
+   * Calls `function(id, value)` for every stored value, in slot order.
+   */
+  template <typename Function> void forEach(Function&& function) {
+    for (uint32_t index = 0; index < _slots.size(); index++) {
+      Slot& slot = _slots[index];
+      if (slot.isOccupied) {
+        function(static_cast<int>((slot.generation << INDEX_BITS) | index), slot.value);
+      }
+    }
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  void reserve(size_t count) {
+    _slots.reserve(count);
+  }
+
+private:
+  struct Slot {
+    T value;
+    uint32_t generation = 0;
+    bool isOccupied = false;
+  };
+
+  Slot* find(int id) {
+    if (id < 0) {
+      return nullptr;
+    }
+    uint32_t index = static_cast<uint32_t>(id) & INDEX_MASK;
+    uint32_t generation = static_cast<uint32_t>(id) >> INDEX_BITS;
+    if (index >= _slots.size()) {
+      return nullptr;
+    }
+    Slot& slot = _slots[index];
+    return slot.isOccupied && slot.generation == generation ? &slot : nullptr;
+  }
+
+private:
+  std::vector<Slot> _slots;
+  std::vector<uint32_t> _freeIndices;
+  size_t _size = 0;
+
+private:
+  // 20 index bits for about a million values, and 11 generation bits to keep ids positive
+  static constexpr uint32_t INDEX_BITS = 20;
+  static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+  static constexpr uint32_t GENERATION_MASK = (1u << (31 - INDEX_BITS)) - 1;
+};
+
+} // namespace margelo
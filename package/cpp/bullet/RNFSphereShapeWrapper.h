@@ -10,7 +10,8 @@ namespace margelo {
 
 class SphereShapeWrapper : public ShapeWrapper {
 public:
-  explicit SphereShapeWrapper(double radius) : ShapeWrapper("SphereShapeWrapper", std::make_shared<btSphereShape>(radius)) {}
+  explicit SphereShapeWrapper(std::shared_ptr<ShapeCache> shapeCache, double radius)
+      : ShapeWrapper("SphereShapeWrapper", shapeCache, ShapeCache::Key{ShapeCache::ShapeType::Sphere, {radius, 0, 0, 0}}) {}
 };
 
 } // namespace margelo
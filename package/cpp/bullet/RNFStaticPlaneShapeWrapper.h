@@ -10,8 +10,9 @@ namespace margelo {
 
 class StaticPlaneShapeWrapper : public ShapeWrapper {
 public:
-  explicit StaticPlaneShapeWrapper(double x, double y, double z, double planeConstant)
-      : ShapeWrapper("StaticPlaneShapeWrapper", std::make_shared<btStaticPlaneShape>(btVector3(x, y, z), planeConstant)) {}
+  explicit StaticPlaneShapeWrapper(std::shared_ptr<ShapeCache> shapeCache, double x, double y, double z, double planeConstant)
+      : ShapeWrapper("StaticPlaneShapeWrapper", shapeCache,
+                     ShapeCache::Key{ShapeCache::ShapeType::StaticPlane, {x, y, z, planeConstant}}) {}
 };
 
 } // namespace margelo
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "RNFShapeWrapper.h"
+
+namespace margelo {
+
+// The exact triangles of a mesh, only for static bodies, see MeshShapeBuilder::createTriangleMesh
+class TriangleMeshShapeWrapper : public ShapeWrapper {
+public:
+  explicit TriangleMeshShapeWrapper(std::shared_ptr<btCollisionShape> shape) : ShapeWrapper("TriangleMeshShapeWrapper", shape) {}
+};
+
+} // namespace margelo
@@ -6,10 +6,10 @@
 
 namespace margelo {
 void AABBWrapper::loadHybridMethods() {
-  registerHybridGetter("center", &AABBWrapper::getCenter, this);
-  registerHybridGetter("halfExtent", &AABBWrapper::getHalfExtent, this);
-  registerHybridGetter("min", &AABBWrapper::getMin, this);
-  registerHybridGetter("max", &AABBWrapper::getMax, this);
+  registerHybridGetter("center", &AABBWrapper::getCenter);
+  registerHybridGetter("halfExtent", &AABBWrapper::getHalfExtent);
+  registerHybridGetter("min", &AABBWrapper::getMin);
+  registerHybridGetter("max", &AABBWrapper::getMax);
 }
 
 std::vector<double> AABBWrapper::getCenter() {
@@ -19,30 +19,30 @@ public:
       : HybridObject("AmbientOcclusionOptionsWrapper"), AmbientOcclusionOptions(options) {}
 
   void loadHybridMethods() override {
-    registerHybridGetter("radius", &AmbientOcclusionOptionsWrapper::getRadius, this);
-    registerHybridSetter("radius", &AmbientOcclusionOptionsWrapper::setRadius, this);
-    registerHybridGetter("power", &AmbientOcclusionOptionsWrapper::getPower, this);
-    registerHybridSetter("power", &AmbientOcclusionOptionsWrapper::setPower, this);
-    registerHybridGetter("bias", &AmbientOcclusionOptionsWrapper::getBias, this);
-    registerHybridSetter("bias", &AmbientOcclusionOptionsWrapper::setBias, this);
-    registerHybridGetter("resolution", &AmbientOcclusionOptionsWrapper::getResolution, this);
-    registerHybridSetter("resolution", &AmbientOcclusionOptionsWrapper::setResolution, this);
-    registerHybridGetter("intensity", &AmbientOcclusionOptionsWrapper::getIntensity, this);
-    registerHybridSetter("intensity", &AmbientOcclusionOptionsWrapper::setIntensity, this);
-    registerHybridGetter("bilateralThreshold", &AmbientOcclusionOptionsWrapper::getBilateralThreshold, this);
-    registerHybridSetter("bilateralThreshold", &AmbientOcclusionOptionsWrapper::setBilateralThreshold, this);
-    registerHybridGetter("quality", &AmbientOcclusionOptionsWrapper::getQuality, this);
-    registerHybridSetter("quality", &AmbientOcclusionOptionsWrapper::setQuality, this);
-    registerHybridGetter("lowPassFilter", &AmbientOcclusionOptionsWrapper::getLowPassFilter, this);
-    registerHybridSetter("lowPassFilter", &AmbientOcclusionOptionsWrapper::setLowPassFilter, this);
-    registerHybridGetter("upsampling", &AmbientOcclusionOptionsWrapper::getUpsampling, this);
-    registerHybridSetter("upsampling", &AmbientOcclusionOptionsWrapper::setUpsampling, this);
-    registerHybridGetter("enabled", &AmbientOcclusionOptionsWrapper::getEnabled, this);
-    registerHybridSetter("enabled", &AmbientOcclusionOptionsWrapper::setEnabled, this);
-    registerHybridGetter("bentNormals", &AmbientOcclusionOptionsWrapper::getBentNormals, this);
-    registerHybridSetter("bentNormals", &AmbientOcclusionOptionsWrapper::setBentNormals, this);
-    registerHybridGetter("minHorizonAngleRad", &AmbientOcclusionOptionsWrapper::getMinHorizonAngleRad, this);
-    registerHybridSetter("minHorizonAngleRad", &AmbientOcclusionOptionsWrapper::setMinHorizonAngleRad, this);
+    registerHybridGetter("radius", &AmbientOcclusionOptionsWrapper::getRadius);
+    registerHybridSetter("radius", &AmbientOcclusionOptionsWrapper::setRadius);
+    registerHybridGetter("power", &AmbientOcclusionOptionsWrapper::getPower);
+    registerHybridSetter("power", &AmbientOcclusionOptionsWrapper::setPower);
+    registerHybridGetter("bias", &AmbientOcclusionOptionsWrapper::getBias);
+    registerHybridSetter("bias", &AmbientOcclusionOptionsWrapper::setBias);
+    registerHybridGetter("resolution", &AmbientOcclusionOptionsWrapper::getResolution);
+    registerHybridSetter("resolution", &AmbientOcclusionOptionsWrapper::setResolution);
+    registerHybridGetter("intensity", &AmbientOcclusionOptionsWrapper::getIntensity);
+    registerHybridSetter("intensity", &AmbientOcclusionOptionsWrapper::setIntensity);
+    registerHybridGetter("bilateralThreshold", &AmbientOcclusionOptionsWrapper::getBilateralThreshold);
+    registerHybridSetter("bilateralThreshold", &AmbientOcclusionOptionsWrapper::setBilateralThreshold);
+    registerHybridGetter("quality", &AmbientOcclusionOptionsWrapper::getQuality);
+    registerHybridSetter("quality", &AmbientOcclusionOptionsWrapper::setQuality);
+    registerHybridGetter("lowPassFilter", &AmbientOcclusionOptionsWrapper::getLowPassFilter);
+    registerHybridSetter("lowPassFilter", &AmbientOcclusionOptionsWrapper::setLowPassFilter);
+    registerHybridGetter("upsampling", &AmbientOcclusionOptionsWrapper::getUpsampling);
+    registerHybridSetter("upsampling", &AmbientOcclusionOptionsWrapper::setUpsampling);
+    registerHybridGetter("enabled", &AmbientOcclusionOptionsWrapper::getEnabled);
+    registerHybridSetter("enabled", &AmbientOcclusionOptionsWrapper::setEnabled);
+    registerHybridGetter("bentNormals", &AmbientOcclusionOptionsWrapper::getBentNormals);
+    registerHybridSetter("bentNormals", &AmbientOcclusionOptionsWrapper::setBentNormals);
+    registerHybridGetter("minHorizonAngleRad", &AmbientOcclusionOptionsWrapper::getMinHorizonAngleRad);
+    registerHybridSetter("minHorizonAngleRad", &AmbientOcclusionOptionsWrapper::setMinHorizonAngleRad);
   }
 
 private:
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "jsi/RNFEnumMapper.h"
+
+namespace margelo {
+
+enum class AnimationLoopMode : uint8_t {
+  // Starts over from the beginning when reaching the end
+  REPEAT,
+  // Stops at (and holds) the last frame
+  ONCE,
+  // Plays backwards when reaching the end, and forwards again when reaching the beginning
+  PING_PONG
+};
+
+namespace EnumMapper {
+  static void convertJSUnionToEnum(const std::string& inUnion, AnimationLoopMode* outEnum) {
+    if (inUnion == "repeat")
+      *outEnum = AnimationLoopMode::REPEAT;
+    else if (inUnion == "once")
+      *outEnum = AnimationLoopMode::ONCE;
+    else if (inUnion == "pingPong")
+      *outEnum = AnimationLoopMode::PING_PONG;
+    else
+      throw invalidUnion(inUnion);
+  }
+  static void convertEnumToJSUnion(AnimationLoopMode inEnum, std::string* outUnion) {
+    switch (inEnum) {
+      case AnimationLoopMode::REPEAT:
+        *outUnion = "repeat";
+        break;
+      case AnimationLoopMode::ONCE:
+        *outUnion = "once";
+        break;
+      case AnimationLoopMode::PING_PONG:
+        *outUnion = "pingPong";
+        break;
+      default:
+        throw invalidEnum(inEnum);
+    }
+  }
+} // namespace EnumMapper
+} // namespace margelo
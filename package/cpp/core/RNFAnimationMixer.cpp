@@ -0,0 +1,330 @@
+#include "RNFAnimationMixer.h"
+#include "RNFLogger.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace margelo {
+
+AnimationMixer::AnimationMixer(std::shared_ptr<WorkerPool> workerPool) : _workerPool(workerPool) {}
+
+int AnimationMixer::addAnimator(std::shared_ptr<AnimatorWrapper> animator) {
+  if (animator == nullptr) {
+    [[unlikely]];
+    throw std::invalid_argument("Animator must not be null!");
+  }
+  std::vector<double> durations = animator->getAnimationDurations();
+  bool hasMorphTargets = animator->hasMorphTargets();
+  const FilamentAsset* asset = animator->getAsset();
+
+  std::unique_lock lock(_mutex);
+  // Instances of an asset that already has baked animations play them as well
+  std::vector<std::shared_ptr<BakedAnimation>> bakedAnimations(durations.size());
+  for (const auto& [otherId, other] : _states) {
+    if (other.asset == asset) {
+      bakedAnimations = other.bakedAnimations;
+      break;
+    }
+  }
+  int id = _nextId++;
+  _states.emplace(id, AnimatorState{.animator = animator,
+                                    .durations = std::move(durations),
+                                    .hasMorphTargets = hasMorphTargets,
+                                    .asset = asset,
+                                    .bakedAnimations = std::move(bakedAnimations)});
+  Logger::log(TAG, "Added animator with id %d", id);
+  return id;
+}
+
+void AnimationMixer::removeAnimator(int id) {
+  std::unique_lock lock(_mutex);
+  if (_states.erase(id) == 0) {
+    [[unlikely]];
+    throw std::invalid_argument("Animator with id " + std::to_string(id) + " not found in the mixer!");
+  }
+  Logger::log(TAG, "Removed animator with id %d", id);
+}
+
+void AnimationMixer::play(int id, int animationIndex, const PlayOptions& options) {
+  std::unique_lock lock(_mutex);
+  AnimatorState& state = getState(id);
+  state.queue.clear();
+  startClip(state, makeClip(state, animationIndex, options), options.fadeDuration);
+}
+
+void AnimationMixer::queue(int id, int animationIndex, const PlayOptions& options) {
+  std::unique_lock lock(_mutex);
+  AnimatorState& state = getState(id);
+  Clip clip = makeClip(state, animationIndex, options);
+  if (!state.current.has_value()) {
+    startClip(state, std::move(clip), options.fadeDuration);
+    return;
+  }
+  state.queue.push_back(QueuedClip{.clip = std::move(clip), .fadeDuration = options.fadeDuration});
+}
+
+void AnimationMixer::setPaused(int id, bool isPaused) {
+  std::unique_lock lock(_mutex);
+  getState(id).isPaused = isPaused;
+}
+
+void AnimationMixer::setSpeed(int id, double speed) {
+  std::unique_lock lock(_mutex);
+  AnimatorState& state = getState(id);
+  if (state.current.has_value()) {
+    state.current->speed = speed;
+  }
+}
+
+void AnimationMixer::setTime(int id, double time) {
+  std::unique_lock lock(_mutex);
+  AnimatorState& state = getState(id);
+  if (state.current.has_value()) {
+    state.current->time = time;
+  }
+}
+
+void AnimationMixer::bakeAnimation(int id, int animationIndex, double frameRate) {
+  std::shared_ptr<AnimatorWrapper> animator;
+  const FilamentAsset* asset;
+  {
+    std::unique_lock lock(_mutex);
+    AnimatorState& state = getState(id);
+    animator = state.animator;
+    asset = state.asset;
+  }
+
+  // Baking samples the whole animation, don't block the other animators meanwhile
+  std::shared_ptr<BakedAnimation> bakedAnimation = animator->bakeAnimation(animationIndex, frameRate);
+  Logger::log(TAG, "Baked animation %d of animator with id %d: %zu tracks, %zu frames (%zu bytes)", animationIndex, id,
+              bakedAnimation->getTrackCount(), bakedAnimation->getFrameCount(), bakedAnimation->getByteSize());
+
+  std::unique_lock lock(_mutex);
+  for (auto& [otherId, state] : _states) {
+    if (state.asset == asset) {
+      state.bakedAnimations[animationIndex] = bakedAnimation;
+    }
+  }
+}
+
+std::optional<int> AnimationMixer::getAnimationIndex(int id) {
+  std::unique_lock lock(_mutex);
+  AnimatorState& state = getState(id);
+  if (!state.current.has_value()) {
+    return std::nullopt;
+  }
+  return state.current->animationIndex;
+}
+
+double AnimationMixer::getTime(int id) {
+  std::unique_lock lock(_mutex);
+  AnimatorState& state = getState(id);
+  return state.current.has_value() ? state.current->getSampleTime() : 0;
+}
+
+void AnimationMixer::update(double timestamp) {
+  std::unique_lock lock(_mutex);
+
+  // Timestamps are in nanoseconds. The first frame (and a clock going backwards) does not advance anything.
+  double deltaSeconds = _lastTimestamp.has_value() ? std::max(0.0, (timestamp - _lastTimestamp.value()) / 1e9) : 0;
+  _lastTimestamp = timestamp;
+
+  _parallelJobs.clear();
+  _serialJobs.clear();
+  _bakedPosesCount = 0;
+  _bakedPoseIndices.clear();
+  for (auto& [id, state] : _states) {
+    advance(state, deltaSeconds);
+    if (!state.current.has_value()) {
+      continue;
+    }
+
+    FrameJob job{.id = id, .state = &state, .animationIndex = state.current->animationIndex, .time = state.current->getSampleTime()};
+    if (state.previous.has_value()) {
+      double alpha = std::min(state.fadeElapsed / state.fadeDuration, 1.0);
+      job.crossFade = AnimatorWrapper::CrossFade{
+          .animationIndex = state.previous->animationIndex, .time = state.previous->getSampleTime(), .alpha = alpha};
+    }
+    const std::shared_ptr<BakedAnimation>& bakedAnimation = state.bakedAnimations[job.animationIndex];
+    if (bakedAnimation != nullptr && !job.crossFade.has_value()) {
+      // Baked poses only write transforms, so they can always run in parallel
+      job.bakedPoseIndex = acquireBakedPose(bakedAnimation.get(), job.time);
+      _parallelJobs.push_back(job);
+    } else if (state.hasMorphTargets) {
+      _serialJobs.push_back(job);
+    } else {
+      _parallelJobs.push_back(job);
+    }
+    if (state.previous.has_value() && state.fadeElapsed >= state.fadeDuration) {
+      state.previous = std::nullopt;
+    }
+  }
+
+  if (_parallelJobs.empty() && _serialJobs.empty()) {
+    return;
+  }
+
+  // 1. Decode every distinct baked pose once, then apply the animations.
+  //    Outside of a transaction, setTransform() also updates the world transforms of all children in the shared
+  //    hierarchy. Inside of one it only writes the instance's own local transform, so the animators can run concurrently.
+  //    All animators of a mixer belong to the same Engine.
+  FrameJob& firstJob = _parallelJobs.empty() ? _serialJobs.front() : _parallelJobs.front();
+  TransformManager& transformManager = firstJob.state->animator->_transformManager;
+  transformManager.openLocalTransformTransaction();
+  _workerPool->parallelFor(_bakedPosesCount, [this](size_t index) {
+    BakedPose& pose = _bakedPoses[index];
+    pose.animation->samplePose(pose.time, pose.transforms.data());
+  });
+  _workerPool->parallelFor(_parallelJobs.size(), [this](size_t index) { applyAnimation(_parallelJobs[index]); });
+  for (FrameJob& job : _serialJobs) {
+    applyAnimation(job);
+  }
+  // Computes the world transforms of all written entities at once, the bone matrices are derived from them.
+  transformManager.commitLocalTransformTransaction();
+
+  // 2. Update the bone matrices (and sync the instances), which uploads them through Filament's command stream.
+  for (std::vector<FrameJob>* jobs : {&_parallelJobs, &_serialJobs}) {
+    for (FrameJob& job : *jobs) {
+      if (job.didFail) {
+        continue;
+      }
+      try {
+        job.state->animator->updateBoneMatrices();
+      } catch (const std::exception& exception) {
+        Logger::log(TAG, "Failed to update bone matrices of animator with id %d: %s", job.id, exception.what());
+      }
+    }
+  }
+}
+
+size_t AnimationMixer::acquireBakedPose(const BakedAnimation* animation, double time) {
+  auto [iterator, isNew] = _bakedPoseIndices.try_emplace(BakedPoseKey{.animation = animation, .time = time}, _bakedPosesCount);
+  if (isNew) {
+    if (_bakedPosesCount == _bakedPoses.size()) {
+      _bakedPoses.emplace_back();
+    }
+    BakedPose& pose = _bakedPoses[_bakedPosesCount++];
+    pose.animation = animation;
+    pose.time = time;
+    pose.transforms.resize(animation->getTrackCount());
+  }
+  return iterator->second;
+}
+
+void AnimationMixer::applyAnimation(FrameJob& job) {
+  try {
+    if (job.bakedPoseIndex.has_value()) {
+      const BakedPose& pose = _bakedPoses[job.bakedPoseIndex.value()];
+      job.state->animator->applyBakedPose(*pose.animation, pose.transforms.data());
+      return;
+    }
+    job.state->animator->applyMixedAnimation(job.animationIndex, job.time, job.crossFade);
+  } catch (const std::exception& exception) {
+    // One released animator should not stop all others from animating
+    Logger::log(TAG, "Failed to update animator with id %d: %s", job.id, exception.what());
+    job.didFail = true;
+  }
+}
+
+AnimationMixer::AnimatorState& AnimationMixer::getState(int id) {
+  auto iterator = _states.find(id);
+  if (iterator == _states.end()) {
+    [[unlikely]];
+    throw std::invalid_argument("Animator with id " + std::to_string(id) + " not found in the mixer!");
+  }
+  return iterator->second;
+}
+
+AnimationMixer::Clip AnimationMixer::makeClip(const AnimatorState& state, int animationIndex, const PlayOptions& options) {
+  if (animationIndex < 0 || static_cast<size_t>(animationIndex) >= state.durations.size()) {
+    [[unlikely]];
+    throw std::invalid_argument("Animation index out of range! Expected <" + std::to_string(state.durations.size()) + ", received " +
+                                std::to_string(animationIndex));
+  }
+  if (options.fadeDuration < 0) {
+    [[unlikely]];
+    throw std::invalid_argument("fadeDuration must not be negative, but was " + std::to_string(options.fadeDuration) + "!");
+  }
+
+  double duration = state.durations[animationIndex];
+  // Clips that play backwards start at their end
+  double time = options.speed < 0 && options.loopMode == AnimationLoopMode::ONCE ? duration : 0;
+  return Clip{.animationIndex = animationIndex, .duration = duration, .time = time, .speed = options.speed, .loopMode = options.loopMode};
+}
+
+void AnimationMixer::startClip(AnimatorState& state, Clip&& clip, double fadeDuration) {
+  if (fadeDuration > 0 && state.current.has_value()) {
+    // Filament can only blend two animations, so a cross-fade that is still running is cut short
+    state.previous = std::move(state.current);
+    state.fadeDuration = fadeDuration;
+    state.fadeElapsed = 0;
+  } else {
+    state.previous = std::nullopt;
+  }
+  state.current = std::move(clip);
+}
+
+void AnimationMixer::advance(AnimatorState& state, double deltaSeconds) {
+  if (!state.current.has_value() || state.isPaused) {
+    return;
+  }
+
+  Clip& current = state.current.value();
+  double cycleBefore = current.getCycle();
+  current.time += deltaSeconds * current.speed;
+  if (state.previous.has_value()) {
+    state.previous->time += deltaSeconds * state.previous->speed;
+    state.fadeElapsed += deltaSeconds;
+  }
+
+  // Continue with the next queued clip once the current one has finished, or completed its current cycle
+  bool didCompleteCycle = current.loopMode != AnimationLoopMode::ONCE && current.getCycle() != cycleBefore;
+  if (!state.queue.empty() && (current.isFinished() || didCompleteCycle)) {
+    QueuedClip next = std::move(state.queue.front());
+    state.queue.pop_front();
+    startClip(state, std::move(next.clip), next.fadeDuration);
+  }
+}
+
+double AnimationMixer::Clip::getSampleTime() const {
+  if (duration <= 0) {
+    [[unlikely]];
+    return 0;
+  }
+
+  switch (loopMode) {
+    case AnimationLoopMode::REPEAT: {
+      double sampleTime = std::fmod(time, duration);
+      return sampleTime < 0 ? sampleTime + duration : sampleTime;
+    }
+    case AnimationLoopMode::ONCE:
+      return std::clamp(time, 0.0, duration);
+    case AnimationLoopMode::PING_PONG: {
+      double period = duration * 2;
+      double periodTime = std::fmod(time, period);
+      if (periodTime < 0) {
+        periodTime += period;
+      }
+      return periodTime <= duration ? periodTime : period - periodTime;
+    }
+  }
+  return 0;
+}
+
+double AnimationMixer::Clip::getCycle() const {
+  if (duration <= 0) {
+    [[unlikely]];
+    return 0;
+  }
+  double cycleLength = loopMode == AnimationLoopMode::PING_PONG ? duration * 2 : duration;
+  return std::floor(time / cycleLength);
+}
+
+bool AnimationMixer::Clip::isFinished() const {
+  if (loopMode != AnimationLoopMode::ONCE) {
+    return false;
+  }
+  return speed >= 0 ? time >= duration : time <= 0;
+}
+
+} // namespace margelo
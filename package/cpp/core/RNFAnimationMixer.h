@@ -0,0 +1,171 @@
+#pragma once
+
+#include "RNFAnimationLoopModeEnum.h"
+#include "RNFAnimatorWrapper.h"
+#include "RNFBakedAnimation.h"
+#include "threading/RNFWorkerPool.h"
+
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace margelo {
+
+// Owns the playback state of any number of animators and advances all of them in a single call per frame.
+// Every animator plays one clip at a time (with its own time, speed and loop mode), can cross-fade from the
+// previously playing clip, and has a queue of clips that start (cross-fading) once the current clip finishes.
+// JS only issues state changes (play, queue, pause, ..), all per-frame time and blend weight math happens here.
+// The animations of all animators are evaluated in parallel on the worker pool inside of one local transform transaction,
+// as every animator only writes the local transforms of its own instance. Bone matrices are uploaded afterwards on the
+// calling Thread, as that goes through Filament's command stream, which must only be used from one Thread.
+// Animations can be baked (see BakedAnimation) for crowds of instances of the same asset: Those play back by interpolating
+// the baked poses, and all instances that play the same baked animation at the same time share one decoded pose per frame.
+class AnimationMixer {
+public:
+  struct PlayOptions {
+    // Seconds to cross-fade from the current clip to the new one, 0 switches immediately
+    double fadeDuration = 0;
+    double speed = 1;
+    AnimationLoopMode loopMode = AnimationLoopMode::REPEAT;
+  };
+
+  explicit AnimationMixer(std::shared_ptr<WorkerPool> workerPool);
+
+  /**
+   * Registers the animator and returns its id. The animator does not play anything until `play` is called.
+   * The animator (and its asset) must stay alive until it is removed again.
+   */
+  int addAnimator(std::shared_ptr<AnimatorWrapper> animator);
+  void removeAnimator(int id);
+
+  /**
+   * Plays the given animation from the start, cross-fading from the current one if `fadeDuration` is greater than 0.
+   * Clears the queue.
+   */
+  void play(int id, int animationIndex, const PlayOptions& options);
+  /**
+   * Plays the given animation once the current one has finished: For looping animations that is the end of the current cycle.
+   * If nothing is playing, it starts right away.
+   */
+  void queue(int id, int animationIndex, const PlayOptions& options);
+  void setPaused(int id, bool isPaused);
+  void setSpeed(int id, double speed);
+  void setTime(int id, double time);
+  /**
+   * Bakes the animation at the given frame rate, using the animator's instance. From then on all animators of the same asset
+   * play it from the baked poses, unless they cross-fade. Blocks the animator for the duration of the bake.
+   */
+  void bakeAnimation(int id, int animationIndex, double frameRate);
+  /**
+   * Returns the index of the playing animation, or std::nullopt if none is playing.
+   */
+  std::optional<int> getAnimationIndex(int id);
+  /**
+   * Returns the time of the playing animation, within [0, duration].
+   */
+  double getTime(int id);
+
+  /**
+   * Advances all animators to the given frame timestamp (in nanoseconds, as passed by the Choreographer),
+   * then applies their animations (in parallel) and updates their bone matrices. Must be called on the render Thread.
+   */
+  void update(double timestamp);
+
+private:
+  struct Clip {
+    int animationIndex;
+    double duration;
+    // Unbounded playback time, see `getSampleTime`
+    double time = 0;
+    double speed;
+    AnimationLoopMode loopMode;
+
+    // The time to sample the animation at, within [0, duration]
+    double getSampleTime() const;
+    // The number of completed loops (or ping-pong round trips)
+    double getCycle() const;
+    // Whether a clip that plays once has reached its end
+    bool isFinished() const;
+  };
+  struct QueuedClip {
+    Clip clip;
+    double fadeDuration;
+  };
+  struct AnimatorState {
+    std::shared_ptr<AnimatorWrapper> animator;
+    std::vector<double> durations;
+    std::optional<Clip> current;
+    // The clip that is being faded out
+    std::optional<Clip> previous;
+    double fadeDuration = 0;
+    double fadeElapsed = 0;
+    std::deque<QueuedClip> queue;
+    bool isPaused = false;
+    // Morph weights are uploaded while applying the animation, so those animators can't run on the worker pool
+    bool hasMorphTargets = false;
+    const FilamentAsset* asset;
+    // Indexed by the animation index, nullptr for animations that are not baked
+    std::vector<std::shared_ptr<BakedAnimation>> bakedAnimations;
+  };
+  // A baked animation decoded at a time, shared by all animators that play it at that time in the current frame
+  struct BakedPose {
+    const BakedAnimation* animation;
+    double time;
+    std::vector<math::mat4f> transforms;
+  };
+  struct BakedPoseKey {
+    const BakedAnimation* animation;
+    double time;
+
+    bool operator==(const BakedPoseKey& other) const {
+      return animation == other.animation && time == other.time;
+    }
+  };
+  struct BakedPoseKeyHasher {
+    size_t operator()(const BakedPoseKey& key) const {
+      return std::hash<const BakedAnimation*>()(key.animation) ^ (std::hash<double>()(key.time) << 1);
+    }
+  };
+  // An animator to apply in the current frame
+  struct FrameJob {
+    int id;
+    AnimatorState* state;
+    int animationIndex;
+    double time;
+    std::optional<AnimatorWrapper::CrossFade> crossFade;
+    // Index into `_bakedPoses` if the animation is played from a baked pose
+    std::optional<size_t> bakedPoseIndex;
+    bool didFail = false;
+  };
+
+private:
+  AnimatorState& getState(int id);
+  Clip makeClip(const AnimatorState& state, int animationIndex, const PlayOptions& options);
+  void startClip(AnimatorState& state, Clip&& clip, double fadeDuration);
+  void advance(AnimatorState& state, double deltaSeconds);
+  size_t acquireBakedPose(const BakedAnimation* animation, double time);
+  void applyAnimation(FrameJob& job);
+
+private:
+  std::shared_ptr<WorkerPool> _workerPool;
+  std::mutex _mutex;
+  std::unordered_map<int, AnimatorState> _states;
+  int _nextId = 0;
+  std::optional<double> _lastTimestamp;
+  // Reused every frame to avoid allocations
+  std::vector<FrameJob> _parallelJobs;
+  std::vector<FrameJob> _serialJobs;
+  // The first `_bakedPosesCount` entries are used in the current frame, the others are kept to reuse their transform buffers
+  std::vector<BakedPose> _bakedPoses;
+  size_t _bakedPosesCount = 0;
+  std::unordered_map<BakedPoseKey, size_t, BakedPoseKeyHasher> _bakedPoseIndices;
+
+private:
+  static constexpr auto TAG = "AnimationMixer";
+};
+
+} // namespace margelo
@@ -0,0 +1,77 @@
+#include "RNFAnimationMixerWrapper.h"
+
+namespace margelo {
+
+void AnimationMixerWrapper::loadHybridMethods() {
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("addAnimator", &AnimationMixerWrapper::addAnimator);
+  registerHybridMethod("removeAnimator", &AnimationMixerWrapper::removeAnimator);
+  registerHybridMethod("play", &AnimationMixerWrapper::play);
+  registerHybridMethod("queue", &AnimationMixerWrapper::queue);
+  registerHybridMethod("setPaused", &AnimationMixerWrapper::setPaused);
+  registerHybridMethod("setSpeed", &AnimationMixerWrapper::setSpeed);
+  registerHybridMethod("setTime", &AnimationMixerWrapper::setTime);
+  registerHybridMethod("bakeAnimation", &AnimationMixerWrapper::bakeAnimation);
+  registerHybridMethod("getAnimationIndex", &AnimationMixerWrapper::getAnimationIndex);
+  registerHybridMethod("getTime", &AnimationMixerWrapper::getTime);
+  registerHybridMethod("update", &AnimationMixerWrapper::update);
+}
+
+int AnimationMixerWrapper::addAnimator(std::shared_ptr<AnimatorWrapper> animator) {
+  return pointee()->addAnimator(animator);
+}
+
+void AnimationMixerWrapper::removeAnimator(int id) {
+  pointee()->removeAnimator(id);
+}
+
+void AnimationMixerWrapper::play(int id, int animationIndex, std::optional<double> fadeDuration, std::optional<double> speed,
+                                 std::optional<std::string> loopMode) {
+  pointee()->play(id, animationIndex, makePlayOptions(fadeDuration, speed, loopMode));
+}
+
+void AnimationMixerWrapper::queue(int id, int animationIndex, std::optional<double> fadeDuration, std::optional<double> speed,
+                                  std::optional<std::string> loopMode) {
+  pointee()->queue(id, animationIndex, makePlayOptions(fadeDuration, speed, loopMode));
+}
+
+void AnimationMixerWrapper::setPaused(int id, bool isPaused) {
+  pointee()->setPaused(id, isPaused);
+}
+
+void AnimationMixerWrapper::setSpeed(int id, double speed) {
+  pointee()->setSpeed(id, speed);
+}
+
+void AnimationMixerWrapper::setTime(int id, double time) {
+  pointee()->setTime(id, time);
+}
+
+void AnimationMixerWrapper::bakeAnimation(int id, int animationIndex, std::optional<double> frameRate) {
+  pointee()->bakeAnimation(id, animationIndex, frameRate.value_or(BakedAnimation::DEFAULT_FRAME_RATE));
+}
+
+std::optional<int> AnimationMixerWrapper::getAnimationIndex(int id) {
+  return pointee()->getAnimationIndex(id);
+}
+
+double AnimationMixerWrapper::getTime(int id) {
+  return pointee()->getTime(id);
+}
+
+void AnimationMixerWrapper::update(double timestamp) {
+  pointee()->update(timestamp);
+}
+
+AnimationMixer::PlayOptions AnimationMixerWrapper::makePlayOptions(std::optional<double> fadeDuration, std::optional<double> speed,
+                                                                   std::optional<std::string> loopMode) {
+  AnimationMixer::PlayOptions options;
+  options.fadeDuration = fadeDuration.value_or(options.fadeDuration);
+  options.speed = speed.value_or(options.speed);
+  if (loopMode.has_value()) {
+    EnumMapper::convertJSUnionToEnum(loopMode.value(), &options.loopMode);
+  }
+  return options;
+}
+
+} // namespace margelo
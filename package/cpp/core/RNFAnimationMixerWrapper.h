@@ -0,0 +1,38 @@
+#pragma once
+
+#include "RNFAnimationMixer.h"
+#include "jsi/RNFPointerHolder.h"
+
+#include <optional>
+#include <string>
+
+namespace margelo {
+
+class AnimationMixerWrapper : public PointerHolder<AnimationMixer> {
+public:
+  explicit AnimationMixerWrapper(std::shared_ptr<AnimationMixer> mixer) : PointerHolder(TAG, mixer) {}
+
+  void loadHybridMethods() override;
+
+private: // Exposed JS API
+  int addAnimator(std::shared_ptr<AnimatorWrapper> animator);
+  void removeAnimator(int id);
+  void play(int id, int animationIndex, std::optional<double> fadeDuration, std::optional<double> speed, std::optional<std::string> loopMode);
+  void queue(int id, int animationIndex, std::optional<double> fadeDuration, std::optional<double> speed, std::optional<std::string> loopMode);
+  void setPaused(int id, bool isPaused);
+  void setSpeed(int id, double speed);
+  void setTime(int id, double time);
+  void bakeAnimation(int id, int animationIndex, std::optional<double> frameRate);
+  std::optional<int> getAnimationIndex(int id);
+  double getTime(int id);
+  void update(double timestamp);
+
+private: // Internal
+  static AnimationMixer::PlayOptions makePlayOptions(std::optional<double> fadeDuration, std::optional<double> speed,
+                                                     std::optional<std::string> loopMode);
+
+private:
+  static constexpr auto TAG = "AnimationMixerWrapper";
+};
+
+} // namespace margelo
@@ -4,20 +4,23 @@
 
 #include "RNFAnimatorWrapper.h"
 #include <filament/Engine.h>
+#include <filament/RenderableManager.h>
 #include <filament/TransformManager.h>
 #include <utils/NameComponentManager.h>
 
+#include <cmath>
+
 namespace margelo {
 void AnimatorWrapper::loadHybridMethods() {
-  registerHybridMethod("applyAnimation", &AnimatorWrapper::applyAnimation, this);
-  registerHybridMethod("updateBoneMatrices", &AnimatorWrapper::updateBoneMatrices, this);
-  registerHybridMethod("applyCrossFade", &AnimatorWrapper::applyCrossFade, this);
-  registerHybridMethod("resetBoneMatrices", &AnimatorWrapper::resetBoneMatrices, this);
-  registerHybridMethod("getAnimationCount", &AnimatorWrapper::getAnimationCount, this);
-  registerHybridMethod("getAnimationDuration", &AnimatorWrapper::getAnimationDuration, this);
-  registerHybridMethod("getAnimationName", &AnimatorWrapper::getAnimationName, this);
-  registerHybridMethod("addToSyncList", &AnimatorWrapper::addToSyncList, this);
-  registerHybridMethod("removeFromSyncList", &AnimatorWrapper::removeFromSyncList, this);
+  registerHybridMethod("applyAnimation", &AnimatorWrapper::applyAnimation);
+  registerHybridMethod("updateBoneMatrices", &AnimatorWrapper::updateBoneMatrices);
+  registerHybridMethod("applyCrossFade", &AnimatorWrapper::applyCrossFade);
+  registerHybridMethod("resetBoneMatrices", &AnimatorWrapper::resetBoneMatrices);
+  registerHybridMethod("getAnimationCount", &AnimatorWrapper::getAnimationCount);
+  registerHybridMethod("getAnimationDuration", &AnimatorWrapper::getAnimationDuration);
+  registerHybridMethod("getAnimationName", &AnimatorWrapper::getAnimationName);
+  registerHybridMethod("addToSyncList", &AnimatorWrapper::addToSyncList);
+  registerHybridMethod("removeFromSyncList", &AnimatorWrapper::removeFromSyncList);
 }
 
 inline void assertAnimationIndexSmallerThan(int animationIndex, int max) {
@@ -65,6 +68,113 @@ void AnimatorWrapper::applyCrossFade(int previousAnimationIndex, double previous
   _animator->applyCrossFade(previousAnimationIndex, previousAnimationTime, alpha);
 }
 
+void AnimatorWrapper::applyMixedAnimation(int animationIndex, double time, std::optional<CrossFade> crossFade) {
+  std::unique_lock lock(_mutex);
+  assertAnimatorNotNull(_animator);
+  _animator->applyAnimation(animationIndex, time);
+  if (crossFade.has_value()) {
+    _animator->applyCrossFade(crossFade->animationIndex, crossFade->time, crossFade->alpha);
+  }
+}
+
+bool AnimatorWrapper::hasMorphTargets() {
+  std::unique_lock lock(_mutex);
+  assertInstanceNotNull(_instance);
+  RenderableManager& renderableManager = _instance->getAsset()->getEngine()->getRenderableManager();
+  const Entity* entities = _instance->getEntities();
+  for (size_t i = 0; i < _instance->getEntityCount(); i++) {
+    RenderableManager::Instance renderable = renderableManager.getInstance(entities[i]);
+    if (renderable.isValid() && renderableManager.getMorphTargetCount(renderable) > 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::shared_ptr<BakedAnimation> AnimatorWrapper::bakeAnimation(int animationIndex, double frameRate) {
+  if (frameRate <= 0) {
+    [[unlikely]];
+    throw std::invalid_argument("frameRate must be greater than 0, but was " + std::to_string(frameRate) + "!");
+  }
+  std::unique_lock lock(_mutex);
+  assertAnimatorNotNull(_animator);
+  assertAnimationIndexSmallerThan(animationIndex, _animator->getAnimationCount());
+
+  const Entity* entities = _instance->getEntities();
+  size_t entityCount = _instance->getEntityCount();
+  std::vector<TransformManager::Instance> transforms(entityCount);
+  std::vector<math::mat4f> restPose(entityCount);
+  for (size_t i = 0; i < entityCount; i++) {
+    transforms[i] = _transformManager.getInstance(entities[i]);
+    if (transforms[i].isValid()) {
+      restPose[i] = _transformManager.getTransform(transforms[i]);
+    }
+  }
+
+  double duration = _animator->getAnimationDuration(animationIndex);
+  size_t frameCount = static_cast<size_t>(std::ceil(duration * frameRate)) + 1;
+  std::vector<math::mat4f> samples(frameCount * entityCount);
+  std::vector<math::mat4f> currentPose(entityCount);
+  for (size_t frame = 0; frame < frameCount; frame++) {
+    if (frame > 0) {
+      // Sampling poses the instance, so the lock is only held for one frame at a time. Otherwise a long clip would block
+      // the AnimationMixer's update (and with it the render Thread) until the whole clip is baked.
+      lock.lock();
+      assertAnimatorNotNull(_animator);
+    }
+    // The pose may have been changed by others since the last frame, every frame is sampled from the rest pose and the
+    // current pose is restored afterwards, so others never see a sampled pose.
+    for (size_t i = 0; i < entityCount; i++) {
+      if (transforms[i].isValid()) {
+        currentPose[i] = _transformManager.getTransform(transforms[i]);
+        _transformManager.setTransform(transforms[i], restPose[i]);
+      }
+    }
+    // Evenly spaced, so the last frame is exactly at the end of the animation
+    double time = frameCount > 1 ? duration * static_cast<double>(frame) / static_cast<double>(frameCount - 1) : 0;
+    _animator->applyAnimation(animationIndex, static_cast<float>(time));
+    for (size_t i = 0; i < entityCount; i++) {
+      if (transforms[i].isValid()) {
+        samples[frame * entityCount + i] = _transformManager.getTransform(transforms[i]);
+        _transformManager.setTransform(transforms[i], currentPose[i]);
+      }
+    }
+    lock.unlock();
+  }
+
+  return std::make_shared<BakedAnimation>(duration, frameCount, entityCount, samples, restPose);
+}
+
+void AnimatorWrapper::applyBakedPose(const BakedAnimation& animation, const math::mat4f* transforms) {
+  std::unique_lock lock(_mutex);
+  assertInstanceNotNull(_instance);
+  const Entity* entities = _instance->getEntities();
+  const std::vector<uint32_t>& entityIndices = animation.getTrackEntityIndices();
+  for (size_t track = 0; track < entityIndices.size(); track++) {
+    TransformManager::Instance transform = _transformManager.getInstance(entities[entityIndices[track]]);
+    if (transform.isValid()) {
+      _transformManager.setTransform(transform, transforms[track]);
+    }
+  }
+}
+
+const FilamentAsset* AnimatorWrapper::getAsset() {
+  std::unique_lock lock(_mutex);
+  assertInstanceNotNull(_instance);
+  return _instance->getAsset();
+}
+
+std::vector<double> AnimatorWrapper::getAnimationDurations() {
+  std::unique_lock lock(_mutex);
+  assertAnimatorNotNull(_animator);
+  size_t animationCount = _animator->getAnimationCount();
+  std::vector<double> durations(animationCount);
+  for (size_t i = 0; i < animationCount; i++) {
+    durations[i] = _animator->getAnimationDuration(i);
+  }
+  return durations;
+}
+
 void AnimatorWrapper::resetBoneMatrices() {
   std::unique_lock lock(_mutex);
   assertAnimatorNotNull(_animator);
@@ -100,11 +210,10 @@ int AnimatorWrapper::addToSyncList(std::shared_ptr<FilamentInstanceWrapper> inst
 
   int id = _syncId++;
   FilamentInstance* instance = instanceWrapper->getInstance();
-  std::map<std::string, Entity> entityMap = createEntityNameMap(instance);
-  _syncMap.insert({id, instance});
-  _instanceEntityMap.insert({id, entityMap});
+  TransformSyncList syncList = createSyncList(instance);
+  Logger::log(TAG, "Added instance with id %d and %zu synced entities to sync list", id, syncList.size());
+  _syncMap.insert({id, SyncedInstance{.instance = instance, .syncList = std::move(syncList)}});
 
-  Logger::log(TAG, "Added instance with id %d to sync list", id);
   return id;
 }
 
@@ -118,7 +227,6 @@ void AnimatorWrapper::removeFromSyncList(int instanceId) {
 
   Logger::log(TAG, "Removed instance with id %d from sync list", instanceId);
   _syncMap.erase(instanceId);
-  _instanceEntityMap.erase(instanceId);
 }
 
 EntityNameMap AnimatorWrapper::createEntityNameMap(FilamentInstance* instance) {
@@ -143,50 +251,34 @@ EntityNameMap AnimatorWrapper::createEntityNameMap(FilamentInstance* instance) {
   return entityMap;
 }
 
-void AnimatorWrapper::applyAnimationTo(EntityNameMap entitiesNameMap) {
+TransformSyncList AnimatorWrapper::createSyncList(FilamentInstance* instance) {
   assertInstanceNotNull(_instance);
 
-  // Syncing the entities
   // TODO: we are not syncing the morph weights here yet
-
-  // Sync the same named entities:
+  EntityNameMap instanceEntityMap = createEntityNameMap(instance);
+  TransformSyncList syncList;
   for (auto const& [name, masterEntity] : _entityMap) {
-    auto instanceEntity = entitiesNameMap[name];
-    if (instanceEntity.isNull()) {
-      [[unlikely]];
+    auto instanceEntity = instanceEntityMap.find(name);
+    if (instanceEntity == instanceEntityMap.end()) {
       continue;
     }
-
-    // Sync the transform
-    TransformManager::Instance masterTransformInstance = _transformManager.getInstance(masterEntity);
-    TransformManager::Instance instanceTransformInstance = _transformManager.getInstance(instanceEntity);
-
-    if (!masterTransformInstance.isValid() || !instanceTransformInstance.isValid()) {
+    if (!syncList.add(_transformManager, masterEntity, instanceEntity->second)) {
       [[unlikely]];
       Logger::log(TAG, "Transform instanceToSync is for entity named %s is invalid", name.c_str());
-      continue;
     }
-
-    math::mat4f masterTransform = _transformManager.getTransform(masterTransformInstance);
-    _transformManager.setTransform(instanceTransformInstance, masterTransform);
   }
+  return syncList;
 }
 
 void AnimatorWrapper::syncInstances() {
   _transformManager.openLocalTransformTransaction();
 
-  for (auto const& [id, instanceToSync] : _syncMap) {
-    EntityNameMap entityNameMap = _instanceEntityMap[id];
-    if (entityNameMap.empty()) {
-      [[unlikely]];
-      continue;
-    }
-
-    applyAnimationTo(entityNameMap);
+  for (auto& [id, syncedInstance] : _syncMap) {
+    syncedInstance.syncList.sync(_transformManager);
 
 #if HAS_FILAMENT_ANIMATOR_PATCH
     Animator* masterAnimator = _instance->getAnimator();
-    masterAnimator->updateBoneMatricesForInstance(instanceToSync);
+    masterAnimator->updateBoneMatricesForInstance(syncedInstance.instance);
 #endif
   }
 
@@ -4,13 +4,17 @@
 
 #pragma once
 
+#include "RNFBakedAnimation.h"
 #include "RNFFilamentAssetWrapper.h"
 #include "RNFFilamentInstanceWrapper.h"
+#include "RNFTransformSyncList.h"
 #include "jsi/RNFHybridObject.h"
 #include <gltfio/Animator.h>
 #include <utils/NameComponentManager.h>
 
 #include <map>
+#include <optional>
+#include <vector>
 
 namespace margelo {
 
@@ -25,6 +29,45 @@ public:
 
   void loadHybridMethods() override;
 
+public: // Internal API
+  struct CrossFade {
+    int animationIndex;
+    double time;
+    // 0 shows only this (previous) animation, 1 only the current one
+    double alpha;
+  };
+  /**
+   * Applies the animation, optionally cross-faded with a previous animation. Used by the AnimationMixer once per frame,
+   * which updates the bone matrices afterwards.
+   * Only writes the transforms of this animator's instance, so different animators may run this in parallel -
+   * unless they have morph targets, see `hasMorphTargets`.
+   */
+  void applyMixedAnimation(int animationIndex, double time, std::optional<CrossFade> crossFade);
+  /**
+   * Whether any renderable of the instance has morph targets. Animating their weights uploads them to the GPU,
+   * which must only happen on the render Thread.
+   */
+  bool hasMorphTargets();
+  /**
+   * Samples the animation at the given rate by applying it to this animator's instance, and bakes the local transforms
+   * of the instance's entities. The instance's transforms are restored after every sampled frame, and the animator
+   * is only locked while sampling one frame, so animating this instance (e.g. by the AnimationMixer) continues meanwhile.
+   */
+  std::shared_ptr<BakedAnimation> bakeAnimation(int animationIndex, double frameRate);
+  /**
+   * Sets the local transforms of the baked animation's tracks, as decoded by `BakedAnimation::samplePose`.
+   * Like `applyMixedAnimation`, this only writes this animator's instance's transforms.
+   */
+  void applyBakedPose(const BakedAnimation& animation, const math::mat4f* transforms);
+  /**
+   * The asset of this animator's instance. All instances of the same asset can share baked animations.
+   */
+  const FilamentAsset* getAsset();
+  /**
+   * Returns the duration of every animation, indexed by the animation index.
+   */
+  std::vector<double> getAnimationDurations();
+
 private: // Exposed JS API
   void applyAnimation(int animationIndex, double time);
   void applyCrossFade(int previousAnimationIndex, double previousAnimationTime, double alpha);
@@ -42,12 +85,12 @@ private: // Internal
    */
   EntityNameMap createEntityNameMap(FilamentInstance* instance);
   /**
-   * Will take all entities associates with this animator instance and apply it to the provided entities
+   * Pairs all entities of this animator's instance with the same named entities of the given instance.
    */
-  void applyAnimationTo(EntityNameMap entitiesNameMap);
+  TransformSyncList createSyncList(FilamentInstance* instance);
   /**
-   * Loops through all instances in the sync list and applies the current transform of all entities to the instance
-   * using `applyAnimationTo`, then updates the bone matrices of the instance using `instanceAnimator->updateBoneMatrices`.
+   * Loops through all instances in the sync list and copies the current transforms of all entities to the instance
+   * using its TransformSyncList, then updates the bone matrices of the instance using `instanceAnimator->updateBoneMatrices`.
    */
   void syncInstances();
 
@@ -61,11 +104,15 @@ protected:
   // The entity map of this class's FilamentInstance
   EntityNameMap _entityMap;
   int _syncId = 0;
-  std::map<int, FilamentInstance*> _syncMap;
-  std::map<int, EntityNameMap> _instanceEntityMap;
+  struct SyncedInstance {
+    FilamentInstance* instance;
+    TransformSyncList syncList;
+  };
+  std::map<int, SyncedInstance> _syncMap;
   TransformManager& _transformManager = getTransformManager();
 
 private:
+  friend class AnimationMixer; // Updates the bone matrices after applying the animations of all its animators
   static auto constexpr TAG = "AnimatorWrapper";
 };
 
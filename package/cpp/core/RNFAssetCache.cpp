@@ -0,0 +1,166 @@
+#include "RNFAssetCache.h"
+
+#include "RNFLogger.h"
+#include "RNFReferences.h"
+
+#include <filament/TransformManager.h>
+#include <gltfio/FilamentInstance.h>
+
+#include <cstring>
+
+namespace margelo {
+
+AssetCache::AssetCache(std::shared_ptr<Engine> engine, std::shared_ptr<gltfio::AssetLoader> assetLoader, std::shared_ptr<Scene> scene,
+                       std::shared_ptr<Dispatcher> rendererDispatcher, CreateAssetFunction&& createAsset)
+    : _engine(engine), _assetLoader(assetLoader), _scene(scene), _rendererDispatcher(rendererDispatcher),
+      _createAsset(std::move(createAsset)) {}
+
+std::shared_ptr<FilamentAssetWrapper> AssetCache::acquire(const std::shared_ptr<FilamentBuffer>& buffer) {
+  std::shared_ptr<ManagedBuffer> managedBuffer = buffer->getBuffer();
+  const uint8_t* data = managedBuffer->getData();
+  size_t size = managedBuffer->getSize();
+  Key key{.hash = hashContent(data, size), .size = size};
+
+  std::unique_lock lock(_mutex);
+  auto iterator = _entries.find(key);
+  if (iterator != _entries.end()) {
+    Entry& entry = iterator->second;
+    if (size > 0 && std::memcmp(entry.source.data(), data, size) != 0) {
+      [[unlikely]];
+      // Different content with the same hash. The key is taken, so this one can't be shared.
+      lock.unlock();
+      Logger::log(TAG, "Hash collision between two different assets (%zu bytes), loading it uncached...", size);
+      return createUncached(buffer);
+    }
+
+    // Hit: Hand out another instance of the resident asset
+    gltfio::FilamentInstance* instance;
+    if (!entry.freeInstances.empty()) {
+      instance = entry.freeInstances.back();
+      entry.freeInstances.pop_back();
+      resetTransforms(entry, instance);
+    } else {
+      instance = _assetLoader->createInstance(entry.asset.get());
+      if (instance == nullptr) {
+        [[unlikely]];
+        throw std::runtime_error("Failed to create a new instance of a cached asset!");
+      }
+    }
+    entry.leases++;
+    _hits++;
+    _activeInstances++;
+    return makeLease(key, entry.asset, instance);
+  }
+
+  // Miss: Load the asset. Only the render Thread acquires, so no one else can insert the same key meanwhile.
+  lock.unlock();
+  // Copied before loading, the buffer's memory might be released once it has been loaded.
+  std::vector<uint8_t> source(data, data + size);
+  std::shared_ptr<gltfio::FilamentAsset> asset = _createAsset(buffer);
+  gltfio::FilamentInstance* instance = asset->getInstance();
+
+  Entry entry{.asset = asset, .leases = 1};
+  entry.source = std::move(source);
+  TransformManager& transformManager = _engine->getTransformManager();
+  const Entity* entities = instance->getEntities();
+  size_t entityCount = instance->getEntityCount();
+  entry.initialTransforms.reserve(entityCount);
+  for (size_t i = 0; i < entityCount; i++) {
+    TransformManager::Instance transform = transformManager.getInstance(entities[i]);
+    entry.initialTransforms.push_back(transform.isValid() ? transformManager.getTransform(transform) : math::mat4f());
+  }
+
+  lock.lock();
+  _misses++;
+  _residentBytes += key.size;
+  _activeInstances++;
+  _entries.emplace(key, std::move(entry));
+  return makeLease(key, asset, instance);
+}
+
+AssetCache::Stats AssetCache::getStats() {
+  std::unique_lock lock(_mutex);
+  return Stats{.hits = _hits,
+               .misses = _misses,
+               .residentBytes = _residentBytes,
+               .residentAssets = _entries.size(),
+               .activeInstances = _activeInstances};
+}
+
+std::shared_ptr<FilamentAssetWrapper> AssetCache::makeLease(const Key& key, const std::shared_ptr<gltfio::FilamentAsset>& asset,
+                                                            gltfio::FilamentInstance* instance) {
+  // The lease points to the shared asset, but its deleter only returns the instance to the cache.
+  // It holds on to the shared asset until then, the last lease's recycle() drops the cache's reference.
+  std::shared_ptr<AssetCache> self = shared_from_this();
+  std::shared_ptr<gltfio::FilamentAsset> lease =
+      References<gltfio::FilamentAsset>::adoptRef(asset.get(), [self, key, instance, asset](gltfio::FilamentAsset*) {
+        self->_rendererDispatcher->runAsync([self, key, instance, asset]() { self->recycle(key, instance); });
+      });
+  return std::make_shared<FilamentAssetWrapper>(lease, instance);
+}
+
+void AssetCache::recycle(const Key& key, gltfio::FilamentInstance* instance) {
+  std::unique_lock lock(_mutex);
+  auto iterator = _entries.find(key);
+  if (iterator == _entries.end()) {
+    [[unlikely]];
+    Logger::log(TAG, "Cannot recycle instance, its asset is not resident anymore!");
+    return;
+  }
+
+  // The instance can't be destroyed on its own, so take it out of the scene until it gets handed out again
+  _scene->removeEntities(instance->getEntities(), instance->getEntityCount());
+  Entry& entry = iterator->second;
+  entry.freeInstances.push_back(instance);
+  _activeInstances--;
+
+  if (--entry.leases == 0) {
+    Logger::log(TAG, "Last instance released, evicting asset (%zu bytes)...", key.size);
+    _residentBytes -= key.size;
+    // Destroys the asset with all of its instances once the last reference (held by the caller's closure) is gone
+    _entries.erase(iterator);
+  }
+}
+
+std::shared_ptr<FilamentAssetWrapper> AssetCache::createUncached(const std::shared_ptr<FilamentBuffer>& buffer) {
+  {
+    std::unique_lock lock(_mutex);
+    _misses++;
+  }
+  // Not leased, so the asset is destroyed with its wrapper like any other asset.
+  std::shared_ptr<gltfio::FilamentAsset> asset = _createAsset(buffer);
+  return std::make_shared<FilamentAssetWrapper>(asset, asset->getInstance());
+}
+
+void AssetCache::resetTransforms(const Entry& entry, gltfio::FilamentInstance* instance) {
+  // The previous owner might have moved or animated the instance. All instances share the same entity layout.
+  TransformManager& transformManager = _engine->getTransformManager();
+  const Entity* entities = instance->getEntities();
+  size_t entityCount = std::min(instance->getEntityCount(), entry.initialTransforms.size());
+  for (size_t i = 0; i < entityCount; i++) {
+    TransformManager::Instance transform = transformManager.getInstance(entities[i]);
+    if (transform.isValid()) {
+      transformManager.setTransform(transform, entry.initialTransforms[i]);
+    }
+  }
+}
+
+uint64_t AssetCache::hashContent(const uint8_t* data, size_t size) {
+  // A fast, non-cryptographic 64-bit hash that consumes 8 bytes per step. The size is part of the key as well.
+  constexpr uint64_t MULTIPLIER = 0x9E3779B97F4A7C15ull;
+  uint64_t hash = 0xCBF29CE484222325ull ^ (size * MULTIPLIER);
+  size_t offset = 0;
+  for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+    uint64_t word;
+    std::memcpy(&word, data + offset, sizeof(uint64_t));
+    hash = (hash ^ (word * MULTIPLIER)) * MULTIPLIER;
+    hash ^= hash >> 29;
+  }
+  for (; offset < size; offset++) {
+    hash = (hash ^ data[offset]) * 0x100000001B3ull;
+  }
+  hash ^= hash >> 32;
+  return hash;
+}
+
+} // namespace margelo
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "RNFFilamentAssetWrapper.h"
+#include "RNFFilamentBuffer.h"
+#include "threading/RNFDispatcher.h"
+
+#include <filament/Engine.h>
+#include <filament/Scene.h>
+#include <gltfio/AssetLoader.h>
+#include <gltfio/FilamentAsset.h>
+#include <math/mat4.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace margelo {
+
+using namespace filament;
+
+// Shares one FilamentAsset between all loads of the same glTF content, keyed by a hash of its bytes.
+// The hash is not cryptographic, so hits are confirmed by comparing against a copy of the bytes the asset was loaded from.
+// Every load gets its own FilamentInstance of the shared asset, so textures, materials and vertex buffers only exist once.
+// Releasing a load's FilamentAssetWrapper returns its instance to the cache (gltfio cannot destroy single instances),
+// and once no load references the asset anymore it is destroyed.
+class AssetCache : public std::enable_shared_from_this<AssetCache> {
+public:
+  // Creates an instanced FilamentAsset with a single instance and loads its resources. Called on the render Thread.
+  using CreateAssetFunction = std::function<std::shared_ptr<gltfio::FilamentAsset>(const std::shared_ptr<FilamentBuffer>& buffer)>;
+
+  struct Stats {
+    size_t hits;
+    size_t misses;
+    // Size of the glTF sources of all resident assets
+    size_t residentBytes;
+    size_t residentAssets;
+    size_t activeInstances;
+  };
+
+  explicit AssetCache(std::shared_ptr<Engine> engine, std::shared_ptr<gltfio::AssetLoader> assetLoader, std::shared_ptr<Scene> scene,
+                      std::shared_ptr<Dispatcher> rendererDispatcher, CreateAssetFunction&& createAsset);
+
+  /**
+   * Returns a new instance of the asset with the given content, creating the asset if it is not resident yet.
+   * Must be called on the render Thread.
+   */
+  std::shared_ptr<FilamentAssetWrapper> acquire(const std::shared_ptr<FilamentBuffer>& buffer);
+
+  Stats getStats();
+
+  /**
+   * A fast, non-cryptographic hash of the given bytes. Also used to key other caches by glTF content.
+   */
+  static uint64_t hashContent(const uint8_t* data, size_t size);
+
+private:
+  struct Key {
+    uint64_t hash;
+    size_t size;
+
+    bool operator==(const Key& other) const {
+      return hash == other.hash && size == other.size;
+    }
+  };
+  struct KeyHasher {
+    size_t operator()(const Key& key) const {
+      return static_cast<size_t>(key.hash);
+    }
+  };
+  struct Entry {
+    std::shared_ptr<gltfio::FilamentAsset> asset;
+    size_t leases = 0;
+    // Instances of released loads, ready to be handed out again
+    std::vector<gltfio::FilamentInstance*> freeInstances;
+    // Local transforms of the instance entities as loaded, to reset recycled instances
+    std::vector<math::mat4f> initialTransforms;
+    // The glTF source the asset was loaded from, to tell hash collisions apart from hits
+    std::vector<uint8_t> source;
+  };
+
+private:
+  std::shared_ptr<FilamentAssetWrapper> makeLease(const Key& key, const std::shared_ptr<gltfio::FilamentAsset>& asset,
+                                                  gltfio::FilamentInstance* instance);
+  void recycle(const Key& key, gltfio::FilamentInstance* instance);
+  void resetTransforms(const Entry& entry, gltfio::FilamentInstance* instance);
+  std::shared_ptr<FilamentAssetWrapper> createUncached(const std::shared_ptr<FilamentBuffer>& buffer);
+
+private:
+  std::shared_ptr<Engine> _engine;
+  std::shared_ptr<gltfio::AssetLoader> _assetLoader;
+  std::shared_ptr<Scene> _scene;
+  std::shared_ptr<Dispatcher> _rendererDispatcher;
+  CreateAssetFunction _createAsset;
+
+  std::mutex _mutex;
+  std::unordered_map<Key, Entry, KeyHasher> _entries;
+  size_t _hits = 0;
+  size_t _misses = 0;
+  size_t _residentBytes = 0;
+  size_t _activeInstances = 0;
+
+private:
+  static constexpr auto TAG = "AssetCache";
+};
+
+} // namespace margelo
@@ -0,0 +1,150 @@
+#include "RNFAsyncAssetLoader.h"
+
+#include "RNFLogger.h"
+#include "RNFReferences.h"
+#include "threading/RNFCompletionReactor.h"
+
+#include <gltfio/TextureProvider.h>
+
+namespace margelo {
+
+AsyncAssetLoader::AsyncAssetLoader(std::shared_ptr<Engine> engine, CreateAssetFunction&& createAsset)
+    : _engine(engine), _createAsset(std::move(createAsset)) {
+  gltfio::ResourceConfiguration resourceConfig{.engine = engine.get(), .normalizeSkinningWeights = true};
+  auto* resourceLoaderPtr = new gltfio::ResourceLoader(resourceConfig);
+  // Texture providers queue their decoding jobs per ResourceLoader, so we need our own ones
+  auto* stbProvider = gltfio::createStbProvider(engine.get());
+  auto* ktx2Provider = gltfio::createKtx2Provider(engine.get());
+  resourceLoaderPtr->addTextureProvider("image/jpeg", stbProvider);
+  resourceLoaderPtr->addTextureProvider("image/png", stbProvider);
+  resourceLoaderPtr->addTextureProvider("image/ktx2", ktx2Provider);
+
+  _resourceLoader = References<gltfio::ResourceLoader>::adoptEngineRef(
+      engine, resourceLoaderPtr, [stbProvider, ktx2Provider](std::shared_ptr<Engine> engine, gltfio::ResourceLoader* resourceLoader) {
+        Logger::log(TAG, "Destroying async resource loader...");
+        resourceLoader->evictResourceData();
+        delete resourceLoader;
+        delete stbProvider;
+        delete ktx2Provider;
+      });
+}
+
+AsyncAssetLoader::~AsyncAssetLoader() {
+  auto error = std::make_exception_ptr(std::runtime_error("The Engine was destroyed before the asset finished loading!"));
+  if (_activeLoad.has_value()) {
+    _resourceLoader->asyncCancelLoad();
+    finishLoad(_activeLoad.value(), error);
+    _activeLoad.reset();
+  }
+
+  std::unique_lock lock(_mutex);
+  for (PendingLoad& pendingLoad : _queue) {
+    pendingLoad.promise->set_exception(error);
+  }
+  _queue.clear();
+  CompletionReactor::notify();
+}
+
+std::future<std::shared_ptr<FilamentAssetWrapper>> AsyncAssetLoader::loadAsset(std::shared_ptr<FilamentBuffer> buffer,
+                                                                               std::optional<int> instanceCount,
+                                                                               std::optional<OnProgress> onProgress) {
+  if (instanceCount.has_value() && instanceCount.value() < 1) {
+    [[unlikely]];
+    throw std::invalid_argument("instanceCount must be greater than 0, but was " + std::to_string(instanceCount.value()) + "!");
+  }
+
+  auto promise = std::make_shared<std::promise<std::shared_ptr<FilamentAssetWrapper>>>();
+  auto future = promise->get_future();
+
+  std::unique_lock lock(_mutex);
+  _queue.push_back(
+      PendingLoad{.buffer = std::move(buffer), .instanceCount = instanceCount, .onProgress = std::move(onProgress), .promise = promise});
+  _pendingLoadsCount.fetch_add(1, std::memory_order_release);
+  return future;
+}
+
+void AsyncAssetLoader::setFrameBudget(std::chrono::microseconds budget) {
+  if (budget.count() <= 0) {
+    [[unlikely]];
+    throw std::invalid_argument("The frame budget for loading assets has to be greater than 0!");
+  }
+  _frameBudgetUs.store(budget.count(), std::memory_order_relaxed);
+}
+
+void AsyncAssetLoader::update() {
+  if (!hasPendingLoads()) {
+    return;
+  }
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(_frameBudgetUs.load(std::memory_order_relaxed));
+  while (std::chrono::steady_clock::now() < deadline) {
+    if (!_activeLoad.has_value()) {
+      if (!beginNextLoad()) {
+        // Nothing left to load
+        return;
+      }
+      continue;
+    }
+
+    ActiveLoad& activeLoad = _activeLoad.value();
+    // Uploads all textures that finished decoding since the last call
+    _resourceLoader->asyncUpdateLoad();
+    float progress = _resourceLoader->asyncGetLoadProgress();
+    if (progress != activeLoad.lastProgress && activeLoad.load.onProgress.has_value()) {
+      activeLoad.lastProgress = progress;
+      try {
+        activeLoad.load.onProgress.value()(static_cast<double>(progress));
+      } catch (const std::exception& exception) {
+        Logger::log(TAG, "onProgress callback threw an error: %s", exception.what());
+      }
+    }
+
+    if (progress < 1.0f) {
+      // The remaining textures are still being decoded on the JobSystem, check again next frame.
+      return;
+    }
+    finishLoad(activeLoad, nullptr);
+    _activeLoad.reset();
+  }
+}
+
+bool AsyncAssetLoader::beginNextLoad() {
+  PendingLoad pendingLoad;
+  {
+    std::unique_lock lock(_mutex);
+    if (_queue.empty()) {
+      return false;
+    }
+    pendingLoad = std::move(_queue.front());
+    _queue.pop_front();
+  }
+
+  ActiveLoad activeLoad{.load = std::move(pendingLoad)};
+  try {
+    activeLoad.asset = _createAsset(activeLoad.load.buffer, activeLoad.load.instanceCount);
+    if (!_resourceLoader->asyncBeginLoad(activeLoad.asset.get())) {
+      [[unlikely]];
+      throw std::runtime_error("Failed to start loading the asset's resources!");
+    }
+  } catch (...) {
+    finishLoad(activeLoad, std::current_exception());
+    return true;
+  }
+
+  _activeLoad = std::move(activeLoad);
+  return true;
+}
+
+void AsyncAssetLoader::finishLoad(ActiveLoad& activeLoad, std::exception_ptr error) {
+  if (error != nullptr) {
+    activeLoad.load.promise->set_exception(error);
+  } else {
+    activeLoad.load.promise->set_value(std::make_shared<FilamentAssetWrapper>(activeLoad.asset));
+  }
+  _pendingLoadsCount.fetch_sub(1, std::memory_order_release);
+  // The buffer is no longer needed by us, the caller may release it now
+  activeLoad.load.buffer = nullptr;
+  CompletionReactor::notify();
+}
+
+} // namespace margelo
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "RNFFilamentAssetWrapper.h"
+#include "RNFFilamentBuffer.h"
+
+#include <filament/Engine.h>
+#include <gltfio/FilamentAsset.h>
+#include <gltfio/ResourceLoader.h>
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace margelo {
+
+using namespace filament;
+
+// Loads glTF assets without blocking the render loop for longer than a per-frame budget.
+// Loads are queued from any Thread, and advanced by calling `update()` once per frame on the render Thread:
+// The asset gets created, its textures are decoded on Filament's JobSystem (gltfio's asyncBeginLoad), and the
+// decoded textures are uploaded over the following frames (asyncUpdateLoad) until the load completes.
+// It uses its own ResourceLoader, because gltfio only supports one asynchronous load per ResourceLoader and
+// synchronous loads (EngineImpl::loadAsset) must not interfere with it.
+class AsyncAssetLoader {
+public:
+  using OnProgress = std::function<void(double progress)>;
+  // Creates the FilamentAsset (without loading its resources) on the render Thread.
+  using CreateAssetFunction =
+      std::function<std::shared_ptr<gltfio::FilamentAsset>(const std::shared_ptr<FilamentBuffer>& buffer, std::optional<int> instanceCount)>;
+
+  static constexpr auto DEFAULT_FRAME_BUDGET = std::chrono::milliseconds(2);
+
+  explicit AsyncAssetLoader(std::shared_ptr<Engine> engine, CreateAssetFunction&& createAsset);
+  ~AsyncAssetLoader();
+
+  /**
+   * Queues the given glTF buffer for loading. The returned future resolves once all resources of the asset are loaded.
+   * `onProgress` is called with the load progress in [0, 1] on the render Thread whenever it changes.
+   */
+  std::future<std::shared_ptr<FilamentAssetWrapper>> loadAsset(std::shared_ptr<FilamentBuffer> buffer, std::optional<int> instanceCount,
+                                                               std::optional<OnProgress> onProgress);
+
+  /**
+   * Sets the maximum time `update()` spends on loading per frame.
+   * Single steps (creating one asset, uploading the textures that finished decoding) are not split, so a frame may exceed it once.
+   */
+  void setFrameBudget(std::chrono::microseconds budget);
+
+  /**
+   * Advances all pending loads until the frame budget is used up. Must be called on the render Thread.
+   */
+  void update();
+
+  bool hasPendingLoads() const {
+    return _pendingLoadsCount.load(std::memory_order_acquire) > 0;
+  }
+
+private:
+  struct PendingLoad {
+    std::shared_ptr<FilamentBuffer> buffer;
+    std::optional<int> instanceCount;
+    std::optional<OnProgress> onProgress;
+    std::shared_ptr<std::promise<std::shared_ptr<FilamentAssetWrapper>>> promise;
+  };
+  struct ActiveLoad {
+    PendingLoad load;
+    std::shared_ptr<gltfio::FilamentAsset> asset;
+    float lastProgress = -1;
+  };
+
+private:
+  bool beginNextLoad();
+  void finishLoad(ActiveLoad& activeLoad, std::exception_ptr error);
+
+private:
+  std::shared_ptr<Engine> _engine;
+  CreateAssetFunction _createAsset;
+  std::shared_ptr<gltfio::ResourceLoader> _resourceLoader;
+  std::atomic<int64_t> _frameBudgetUs{std::chrono::duration_cast<std::chrono::microseconds>(DEFAULT_FRAME_BUDGET).count()};
+
+  std::mutex _mutex;
+  std::deque<PendingLoad> _queue;
+  std::atomic<size_t> _pendingLoadsCount{0};
+
+  // Only accessed on the render Thread
+  std::optional<ActiveLoad> _activeLoad;
+
+private:
+  static constexpr auto TAG = "AsyncAssetLoader";
+};
+
+} // namespace margelo
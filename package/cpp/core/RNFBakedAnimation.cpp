@@ -0,0 +1,144 @@
+#include "RNFBakedAnimation.h"
+
+#include <math/mat3.h>
+#include <math/norm.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace margelo {
+
+BakedAnimation::BakedAnimation(double duration, size_t frameCount, size_t entityCount, const std::vector<math::mat4f>& samples,
+                               const std::vector<math::mat4f>& restPose)
+    : _duration(duration), _frameCount(frameCount) {
+  if (frameCount < 1 || samples.size() != frameCount * entityCount || restPose.size() != entityCount) {
+    [[unlikely]];
+    throw std::invalid_argument("Cannot bake " + std::to_string(samples.size()) + " samples into " + std::to_string(frameCount) +
+                                " frames of " + std::to_string(entityCount) + " entities!");
+  }
+
+  // Entities the clip leaves at their rest pose don't need a track. Comparing against the rest pose instead of the first
+  // frame keeps entities the clip holds at a constant transform, otherwise playback would leave them at the rest pose.
+  for (size_t entity = 0; entity < entityCount; entity++) {
+    for (size_t frame = 0; frame < frameCount; frame++) {
+      if (samples[frame * entityCount + entity] != restPose[entity]) {
+        _trackEntityIndices.push_back(static_cast<uint32_t>(entity));
+        break;
+      }
+    }
+  }
+
+  size_t trackCount = _trackEntityIndices.size();
+  _translationRanges.reserve(trackCount);
+  _scaleRanges.reserve(trackCount);
+  _frames.resize(frameCount * trackCount);
+  std::vector<Transform> transforms(frameCount);
+  for (size_t track = 0; track < trackCount; track++) {
+    uint32_t entity = _trackEntityIndices[track];
+    for (size_t frame = 0; frame < frameCount; frame++) {
+      transforms[frame] = decompose(samples[frame * entityCount + entity]);
+      // q and -q are the same rotation, keep neighbouring frames in the same hemisphere so they interpolate the short way
+      if (frame > 0 && dot(transforms[frame].rotation, transforms[frame - 1].rotation) < 0) {
+        transforms[frame].rotation = -transforms[frame].rotation;
+      }
+    }
+
+    Range translationRange = makeRange(transforms, &Transform::translation);
+    Range scaleRange = makeRange(transforms, &Transform::scale);
+    for (size_t frame = 0; frame < frameCount; frame++) {
+      const Transform& transform = transforms[frame];
+      QuantizedTransform& quantized = _frames[frame * trackCount + track];
+      for (size_t i = 0; i < 3; i++) {
+        quantized.translation[i] = quantize(transform.translation[i], translationRange.min[i], translationRange.extent[i]);
+        quantized.scale[i] = quantize(transform.scale[i], scaleRange.min[i], scaleRange.extent[i]);
+      }
+      for (size_t i = 0; i < 4; i++) {
+        quantized.rotation[i] = math::packSnorm16(transform.rotation[i]);
+      }
+    }
+    _translationRanges.push_back(translationRange);
+    _scaleRanges.push_back(scaleRange);
+  }
+}
+
+void BakedAnimation::samplePose(double time, math::mat4f* transforms) const {
+  double position = 0;
+  if (_frameCount > 1 && _duration > 0) {
+    position = std::clamp(time, 0.0, _duration) / _duration * static_cast<double>(_frameCount - 1);
+  }
+  size_t frame = std::min(static_cast<size_t>(position), _frameCount - 1);
+  size_t nextFrame = std::min(frame + 1, _frameCount - 1);
+  float alpha = static_cast<float>(position - static_cast<double>(frame));
+
+  for (size_t track = 0; track < _trackEntityIndices.size(); track++) {
+    Transform from = decodeTransform(frame, track);
+    Transform to = decodeTransform(nextFrame, track);
+    math::float3 translation = mix(from.translation, to.translation, alpha);
+    math::float3 scale = mix(from.scale, to.scale, alpha);
+    // Normalized lerp, the frames are close enough for it to match slerp
+    math::quatf rotation = normalize(lerp(from.rotation, to.rotation, alpha));
+    transforms[track] = math::mat4f::translation(translation) * math::mat4f(rotation) * math::mat4f::scaling(scale);
+  }
+}
+
+size_t BakedAnimation::getByteSize() const {
+  return _frames.size() * sizeof(QuantizedTransform) + _trackEntityIndices.size() * (sizeof(uint32_t) + 2 * sizeof(Range));
+}
+
+BakedAnimation::Transform BakedAnimation::decompose(const math::mat4f& matrix) {
+  math::float3 axes[3] = {matrix[0].xyz, matrix[1].xyz, matrix[2].xyz};
+  math::float3 scale = {length(axes[0]), length(axes[1]), length(axes[2])};
+  if (dot(cross(axes[0], axes[1]), axes[2]) < 0) {
+    // Mirrored, move the reflection into the scale so the remaining matrix is a rotation
+    scale.x = -scale.x;
+  }
+  for (size_t i = 0; i < 3; i++) {
+    if (scale[i] != 0) {
+      axes[i] /= scale[i];
+    }
+  }
+  math::quatf rotation = normalize(math::mat3f(axes[0], axes[1], axes[2]).toQuaternion());
+  return Transform{matrix[3].xyz, rotation, scale};
+}
+
+uint16_t BakedAnimation::quantize(float value, float min, float extent) {
+  if (extent <= 0) {
+    return 0;
+  }
+  float normalized = std::clamp((value - min) / extent, 0.0f, 1.0f);
+  return static_cast<uint16_t>(std::lround(normalized * 65535.0f));
+}
+
+float BakedAnimation::dequantize(uint16_t value, float min, float extent) {
+  return min + static_cast<float>(value) / 65535.0f * extent;
+}
+
+BakedAnimation::Range BakedAnimation::makeRange(const std::vector<Transform>& transforms, math::float3 Transform::*member) {
+  math::float3 lower = transforms[0].*member;
+  math::float3 upper = lower;
+  for (const Transform& transform : transforms) {
+    // Component-wise min/max of the vectors
+    lower = min(lower, transform.*member);
+    upper = max(upper, transform.*member);
+  }
+  return Range{lower, upper - lower};
+}
+
+BakedAnimation::Transform BakedAnimation::decodeTransform(size_t frame, size_t track) const {
+  const QuantizedTransform& quantized = _frames[frame * _trackEntityIndices.size() + track];
+  const Range& translationRange = _translationRanges[track];
+  const Range& scaleRange = _scaleRanges[track];
+  Transform transform;
+  for (size_t i = 0; i < 3; i++) {
+    transform.translation[i] = dequantize(quantized.translation[i], translationRange.min[i], translationRange.extent[i]);
+    transform.scale[i] = dequantize(quantized.scale[i], scaleRange.min[i], scaleRange.extent[i]);
+  }
+  for (size_t i = 0; i < 4; i++) {
+    transform.rotation[i] = math::unpackSnorm16(quantized.rotation[i]);
+  }
+  return transform;
+}
+
+} // namespace margelo
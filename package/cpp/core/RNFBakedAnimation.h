@@ -0,0 +1,95 @@
+#pragma once
+
+#include <math/mat4.h>
+#include <math/quat.h>
+#include <math/vec3.h>
+#include <math/vec4.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace margelo {
+
+using namespace filament;
+
+// An animation clip pre-sampled at a fixed rate into a compact pose buffer, so playing it back only interpolates
+// between two baked frames instead of evaluating the glTF channels (keyframe search and interpolation per channel).
+// Only entities whose transform differs from their rest pose in any frame get a track, which includes entities the clip
+// holds at a constant transform other than the rest pose. Every track stores one quantized TRS per frame:
+// translation and scale as 16-bit fractions of the track's range, rotation as a SNORM16 quaternion (20 bytes).
+// Entities are referenced by their index in `FilamentInstance::getEntities()`, so one baked clip plays on all
+// instances of the same asset. Morph weights are not baked.
+class BakedAnimation {
+public:
+  static constexpr double DEFAULT_FRAME_RATE = 30;
+
+  /**
+   * Bakes the given samples: `frameCount` frames (evenly spaced over `duration`, including both ends) of the
+   * local transforms of `entityCount` entities, stored frame by frame. `restPose` holds the local transform of every
+   * entity before the clip was applied.
+   */
+  explicit BakedAnimation(double duration, size_t frameCount, size_t entityCount, const std::vector<math::mat4f>& samples,
+                          const std::vector<math::mat4f>& restPose);
+
+  /**
+   * Decodes the pose at the given time (clamped to [0, duration]) into one local transform per track.
+   * `transforms` must have room for `getTrackCount()` matrices.
+   */
+  void samplePose(double time, math::mat4f* transforms) const;
+
+  /**
+   * The index (in `FilamentInstance::getEntities()`) of the entity animated by each track.
+   */
+  const std::vector<uint32_t>& getTrackEntityIndices() const {
+    return _trackEntityIndices;
+  }
+  size_t getTrackCount() const {
+    return _trackEntityIndices.size();
+  }
+  size_t getFrameCount() const {
+    return _frameCount;
+  }
+  double getDuration() const {
+    return _duration;
+  }
+  /**
+   * The size of the baked poses in bytes.
+   */
+  size_t getByteSize() const;
+
+private:
+  struct QuantizedTransform {
+    uint16_t translation[3];
+    int16_t rotation[4];
+    uint16_t scale[3];
+  };
+  struct Transform {
+    math::float3 translation;
+    math::quatf rotation;
+    math::float3 scale;
+  };
+  // Maps a track's quantized values back to its range
+  struct Range {
+    math::float3 min;
+    math::float3 extent;
+  };
+
+private:
+  static Transform decompose(const math::mat4f& matrix);
+  static uint16_t quantize(float value, float min, float extent);
+  static float dequantize(uint16_t value, float min, float extent);
+  static Range makeRange(const std::vector<Transform>& transforms, math::float3 Transform::*member);
+  Transform decodeTransform(size_t frame, size_t track) const;
+
+private:
+  double _duration;
+  size_t _frameCount;
+  std::vector<uint32_t> _trackEntityIndices;
+  std::vector<Range> _translationRanges;
+  std::vector<Range> _scaleRanges;
+  // Frame by frame, `getTrackCount()` transforms per frame
+  std::vector<QuantizedTransform> _frames;
+};
+
+} // namespace margelo
@@ -6,10 +6,10 @@
 
 namespace margelo {
 void BoxWrapper::loadHybridMethods() {
-  registerHybridGetter("center", &BoxWrapper::getCenter, this);
-  registerHybridGetter("halfExtent", &BoxWrapper::getHalfExtent, this);
-  registerHybridGetter("min", &BoxWrapper::getMin, this);
-  registerHybridGetter("max", &BoxWrapper::getMax, this);
+  registerHybridGetter("center", &BoxWrapper::getCenter);
+  registerHybridGetter("halfExtent", &BoxWrapper::getHalfExtent);
+  registerHybridGetter("min", &BoxWrapper::getMin);
+  registerHybridGetter("max", &BoxWrapper::getMax);
 }
 
 std::vector<double> BoxWrapper::getCenter() {
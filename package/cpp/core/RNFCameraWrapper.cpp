@@ -2,10 +2,11 @@
 #include "RNFCameraFovEnum.h"
 
 void margelo::CameraWrapper::loadHybridMethods() {
-  registerHybridMethod("lookAtCameraManipulator", &CameraWrapper::lookAtCameraManipulator, this);
-  registerHybridMethod("lookAt", &CameraWrapper::lookAt, this);
-  registerHybridMethod("setLensProjection", &CameraWrapper::setLensProjection, this);
-  registerHybridMethod("setProjection", &CameraWrapper::setProjection, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("lookAtCameraManipulator", &CameraWrapper::lookAtCameraManipulator);
+  registerHybridMethod("lookAt", &CameraWrapper::lookAt);
+  registerHybridMethod("setLensProjection", &CameraWrapper::setLensProjection);
+  registerHybridMethod("setProjection", &CameraWrapper::setProjection);
 }
 
 void margelo::CameraWrapper::lookAtCameraManipulator(std::shared_ptr<ManipulatorWrapper> cameraManipulator) {
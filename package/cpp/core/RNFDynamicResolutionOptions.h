@@ -19,18 +19,18 @@ public:
       : HybridObject("DynamicResolutionOptions"), DynamicResolutionOptions(options) {}
 
   void loadHybridMethods() {
-    registerHybridGetter("minScale", &DynamicResolutionOptionsWrapper::getMinScale, this);
-    registerHybridSetter("minScale", &DynamicResolutionOptionsWrapper::setMinScale, this);
-    registerHybridGetter("maxScale", &DynamicResolutionOptionsWrapper::getMaxScale, this);
-    registerHybridSetter("maxScale", &DynamicResolutionOptionsWrapper::setMaxScale, this);
-    registerHybridGetter("sharpness", &DynamicResolutionOptionsWrapper::getSharpness, this);
-    registerHybridSetter("sharpness", &DynamicResolutionOptionsWrapper::setSharpness, this);
-    registerHybridGetter("enabled", &DynamicResolutionOptionsWrapper::getEnabled, this);
-    registerHybridSetter("enabled", &DynamicResolutionOptionsWrapper::setEnabled, this);
-    registerHybridGetter("homogeneousScaling", &DynamicResolutionOptionsWrapper::getHomogeneousScaling, this);
-    registerHybridSetter("homogeneousScaling", &DynamicResolutionOptionsWrapper::setHomogeneousScaling, this);
-    registerHybridGetter("quality", &DynamicResolutionOptionsWrapper::getQuality, this);
-    registerHybridSetter("quality", &DynamicResolutionOptionsWrapper::setQuality, this);
+    registerHybridGetter("minScale", &DynamicResolutionOptionsWrapper::getMinScale);
+    registerHybridSetter("minScale", &DynamicResolutionOptionsWrapper::setMinScale);
+    registerHybridGetter("maxScale", &DynamicResolutionOptionsWrapper::getMaxScale);
+    registerHybridSetter("maxScale", &DynamicResolutionOptionsWrapper::setMaxScale);
+    registerHybridGetter("sharpness", &DynamicResolutionOptionsWrapper::getSharpness);
+    registerHybridSetter("sharpness", &DynamicResolutionOptionsWrapper::setSharpness);
+    registerHybridGetter("enabled", &DynamicResolutionOptionsWrapper::getEnabled);
+    registerHybridSetter("enabled", &DynamicResolutionOptionsWrapper::setEnabled);
+    registerHybridGetter("homogeneousScaling", &DynamicResolutionOptionsWrapper::getHomogeneousScaling);
+    registerHybridSetter("homogeneousScaling", &DynamicResolutionOptionsWrapper::setHomogeneousScaling);
+    registerHybridGetter("quality", &DynamicResolutionOptionsWrapper::getQuality);
+    registerHybridSetter("quality", &DynamicResolutionOptionsWrapper::setQuality);
   }
 
 private:
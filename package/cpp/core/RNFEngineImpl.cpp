@@ -79,6 +79,12 @@ EngineImpl::EngineImpl(std::shared_ptr<Dispatcher> rendererDispatcher, std::shar
         delete ktx2Provider;
       });
 
+  // Note: Capturing this is safe, the EngineImpl owns the AsyncAssetLoader
+  _asyncAssetLoader = std::make_shared<AsyncAssetLoader>(
+      engine, [this](const std::shared_ptr<FilamentBuffer>& modelBuffer, std::optional<int> instanceCount) {
+        return createAsset(modelBuffer, instanceCount);
+      });
+
   // Setup filament:
   _renderer = createRenderer(displayRefreshRate);
   _scene = createScene();
@@ -87,6 +93,14 @@ EngineImpl::EngineImpl(std::shared_ptr<Dispatcher> rendererDispatcher, std::shar
 
   _view->setScene(_scene.get());
   _view->setCamera(_camera.get());
+
+  // Note: Capturing this is safe, the EngineImpl owns the AssetCache. Cached assets are instanced, so they can get more instances later.
+  _assetCache = std::make_shared<AssetCache>(_engine, _assetLoader, _scene, _rendererDispatcher,
+                                             [this](const std::shared_ptr<FilamentBuffer>& modelBuffer) {
+                                               std::shared_ptr<gltfio::FilamentAsset> asset = createAsset(modelBuffer, 1);
+                                               _resourceLoader->loadResources(asset.get());
+                                               return asset;
+                                             });
 }
 
 void EngineImpl::setSurfaceProvider(std::shared_ptr<SurfaceProvider> surfaceProvider) {
@@ -230,22 +244,70 @@ std::shared_ptr<Camera> EngineImpl::createCamera() {
 
 std::shared_ptr<FilamentAssetWrapper> EngineImpl::loadAsset(std::shared_ptr<FilamentBuffer> modelBuffer) {
   std::unique_lock lock(_mutex);
-  std::shared_ptr<ManagedBuffer> buffer = modelBuffer->getBuffer();
-  gltfio::FilamentAsset* assetPtr = _assetLoader->createAsset(buffer->getData(), buffer->getSize());
+  std::shared_ptr<gltfio::FilamentAsset> asset = createAsset(modelBuffer, std::nullopt);
 
-  return makeAssetWrapper(assetPtr);
+  // TODO: When supporting loading glTF files with external resources, we need to load the resources here
+  //    const char* const* const resourceUris = asset->getResourceUris();
+  //    const size_t resourceUriCount = asset->getResourceUriCount();
+  _resourceLoader->loadResources(asset.get());
+
+  return std::make_shared<FilamentAssetWrapper>(asset);
 }
 
 std::shared_ptr<FilamentAssetWrapper> EngineImpl::loadInstancedAsset(std::shared_ptr<FilamentBuffer> modelBuffer, int instanceCount) {
   std::unique_lock lock(_mutex);
-  std::shared_ptr<ManagedBuffer> buffer = modelBuffer->getBuffer();
-  FilamentInstance* instances[instanceCount]; // Memory managed by the FilamentAsset
-  gltfio::FilamentAsset* assetPtr = _assetLoader->createInstancedAsset(buffer->getData(), buffer->getSize(), instances, instanceCount);
+  std::shared_ptr<gltfio::FilamentAsset> asset = createAsset(modelBuffer, instanceCount);
+  _resourceLoader->loadResources(asset.get());
+
+  return std::make_shared<FilamentAssetWrapper>(asset);
+}
+
+std::future<std::shared_ptr<FilamentAssetWrapper>> EngineImpl::loadAssetAsync(std::shared_ptr<FilamentBuffer> modelBuffer,
+                                                                               std::optional<int> instanceCount,
+                                                                               std::optional<AsyncAssetLoader::OnProgress> onProgress) {
+  return _asyncAssetLoader->loadAsset(modelBuffer, instanceCount, std::move(onProgress));
+}
+
+void EngineImpl::setAssetLoadingFrameBudget(double milliseconds) {
+  _asyncAssetLoader->setFrameBudget(std::chrono::microseconds(static_cast<int64_t>(milliseconds * 1'000)));
+}
+
+std::shared_ptr<FilamentAssetWrapper> EngineImpl::loadCachedAsset(std::shared_ptr<FilamentBuffer> modelBuffer) {
+  std::unique_lock lock(_mutex);
+  return _assetCache->acquire(modelBuffer);
+}
 
-  return makeAssetWrapper(assetPtr);
+AssetCache::Stats EngineImpl::getAssetCacheStats() {
+  return _assetCache->getStats();
 }
 
-std::shared_ptr<FilamentAssetWrapper> EngineImpl::makeAssetWrapper(FilamentAsset* assetPtr) {
+void EngineImpl::updateAsyncAssetLoads() {
+  if (!_asyncAssetLoader->hasPendingLoads()) {
+    // Fast path, this is called every frame
+    return;
+  }
+  std::unique_lock lock(_mutex);
+  _asyncAssetLoader->update();
+}
+
+std::shared_ptr<WorkerPool> EngineImpl::getAnimationWorkerPool() {
+  std::unique_lock lock(_mutex);
+  if (_animationWorkerPool == nullptr) {
+    _animationWorkerPool = std::make_shared<WorkerPool>("RNF.Animation", WorkerPool::getDefaultThreadsCount());
+  }
+  return _animationWorkerPool;
+}
+
+std::shared_ptr<gltfio::FilamentAsset> EngineImpl::createAsset(const std::shared_ptr<FilamentBuffer>& modelBuffer,
+                                                               std::optional<int> instanceCount) {
+  std::shared_ptr<ManagedBuffer> buffer = modelBuffer->getBuffer();
+  gltfio::FilamentAsset* assetPtr;
+  if (instanceCount.has_value()) {
+    FilamentInstance* instances[instanceCount.value()]; // Memory managed by the FilamentAsset
+    assetPtr = _assetLoader->createInstancedAsset(buffer->getData(), buffer->getSize(), instances, instanceCount.value());
+  } else {
+    assetPtr = _assetLoader->createAsset(buffer->getData(), buffer->getSize());
+  }
   if (assetPtr == nullptr) {
     throw std::runtime_error("Failed to load asset");
   }
@@ -253,23 +315,22 @@ std::shared_ptr<FilamentAssetWrapper> EngineImpl::makeAssetWrapper(FilamentAsset
   auto assetLoader = _assetLoader;
   auto dispatcher = _rendererDispatcher;
   auto scene = _scene;
-  std::shared_ptr<EngineImpl> sharedThis = shared_from_this();
-  auto asset =
-      References<gltfio::FilamentAsset>::adoptRef(assetPtr, [dispatcher, assetLoader, scene, sharedThis](gltfio::FilamentAsset* asset) {
-        dispatcher->runAsync([assetLoader, asset, scene, sharedThis]() {
-          std::unique_lock lock(sharedThis->_mutex); // Locking here, so we don't call render while destroying the asset
-          Logger::log(TAG, "Destroying asset...");
-          scene->removeEntities(asset->getEntities(), asset->getEntityCount());
-          assetLoader->destroyAsset(asset);
-        });
-      });
-
-  // TODO: When supporting loading glTF files with external resources, we need to load the resources here
-  //    const char* const* const resourceUris = asset->getResourceUris();
-  //    const size_t resourceUriCount = asset->getResourceUriCount();
-  _resourceLoader->loadResources(asset.get());
-
-  return std::make_shared<FilamentAssetWrapper>(asset);
+  // Weak, as the asset that is currently loading (and the cached ones) are owned by this EngineImpl - a strong reference would be a cycle.
+  std::weak_ptr<EngineImpl> weakThis = shared_from_this();
+  return References<gltfio::FilamentAsset>::adoptRef(assetPtr, [dispatcher, assetLoader, scene, weakThis](gltfio::FilamentAsset* asset) {
+    dispatcher->runAsync([assetLoader, asset, scene, weakThis]() {
+      // Declared before the lock, so the lock is released before this could destroy the EngineImpl (and its mutex).
+      std::shared_ptr<EngineImpl> sharedThis = weakThis.lock();
+      std::unique_lock<std::mutex> lock;
+      if (sharedThis != nullptr) {
+        // Locking here, so we don't call render while destroying the asset. Once the EngineImpl is gone nothing renders anymore.
+        lock = std::unique_lock(sharedThis->_mutex);
+      }
+      Logger::log(TAG, "Destroying asset...");
+      scene->removeEntities(asset->getEntities(), asset->getEntityCount());
+      assetLoader->destroyAsset(asset);
+    });
+  });
 }
 
 // Default light is a directional light for shadows + a default IBL
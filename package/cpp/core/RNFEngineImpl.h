@@ -6,6 +6,8 @@
 
 #include "jsi/RNFPointerHolder.h"
 
+#include "RNFAssetCache.h"
+#include "RNFAsyncAssetLoader.h"
 #include "RNFChoreographer.h"
 #include "RNFFilamentAssetWrapper.h"
 #include "RNFFilamentBuffer.h"
@@ -21,6 +23,7 @@
 #include "core/utils/RNFEntityWrapper.h"
 #include "core/utils/RNFManipulatorWrapper.h"
 #include "threading/RNFDispatcher.h"
+#include "threading/RNFWorkerPool.h"
 
 #include <camutils/Manipulator.h>
 #include <filament/Engine.h>
@@ -57,6 +60,18 @@ public:
   void setIndirectLight(std::shared_ptr<FilamentBuffer> modelBuffer, std::optional<double> intensity, std::optional<int> irradianceBands);
   std::shared_ptr<FilamentAssetWrapper> loadAsset(std::shared_ptr<FilamentBuffer> modelBuffer);
   std::shared_ptr<FilamentAssetWrapper> loadInstancedAsset(std::shared_ptr<FilamentBuffer> modelBuffer, int instanceCount);
+  // Loads the asset over the next frames, without blocking the render loop for longer than the asset loading frame budget.
+  std::future<std::shared_ptr<FilamentAssetWrapper>> loadAssetAsync(std::shared_ptr<FilamentBuffer> modelBuffer,
+                                                                    std::optional<int> instanceCount,
+                                                                    std::optional<AsyncAssetLoader::OnProgress> onProgress);
+  void setAssetLoadingFrameBudget(double milliseconds);
+  // Loads a new instance of the asset, sharing the asset with all other cached loads of the same content.
+  std::shared_ptr<FilamentAssetWrapper> loadCachedAsset(std::shared_ptr<FilamentBuffer> modelBuffer);
+  AssetCache::Stats getAssetCacheStats();
+  // Advances pending asynchronous asset loads, called once per frame on the render thread.
+  void updateAsyncAssetLoads();
+  // The Threads that all AnimationMixers of this engine evaluate their animations on, started on first use.
+  std::shared_ptr<WorkerPool> getAnimationWorkerPool();
   std::shared_ptr<LightManagerWrapper> createLightManager();
   std::shared_ptr<RenderableManagerWrapper> createRenderableManager();
   std::shared_ptr<TransformManagerWrapper> createTransformManager();
@@ -79,6 +94,9 @@ private:
   std::shared_ptr<gltfio::MaterialProvider> _materialProvider;
   std::shared_ptr<gltfio::AssetLoader> _assetLoader;
   std::shared_ptr<gltfio::ResourceLoader> _resourceLoader;
+  std::shared_ptr<AsyncAssetLoader> _asyncAssetLoader;
+  std::shared_ptr<AssetCache> _assetCache;
+  std::shared_ptr<WorkerPool> _animationWorkerPool;
   std::shared_ptr<Skybox> _skybox = nullptr;
 
   std::function<void(double)> _frameCompletedCallback;
@@ -101,8 +119,8 @@ private:
   std::shared_ptr<Scene> createScene();
   std::shared_ptr<View> createView();
   std::shared_ptr<Camera> createCamera();
-  // Internal helper method to turn an FilamentAsset ptr into a FilamentAssetWrapper
-  std::shared_ptr<FilamentAssetWrapper> makeAssetWrapper(FilamentAsset* assetPtr);
+  // Internal helper method to create a FilamentAsset (without its resources) that gets destroyed on the render thread
+  std::shared_ptr<gltfio::FilamentAsset> createAsset(const std::shared_ptr<FilamentBuffer>& modelBuffer, std::optional<int> instanceCount);
 
 private:
   static constexpr auto TAG = "EngineImpl";
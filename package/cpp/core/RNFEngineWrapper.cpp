@@ -32,28 +32,34 @@
 namespace margelo {
 
 void EngineWrapper::loadHybridMethods() {
-  registerHybridMethod("setSurfaceProvider", &EngineWrapper::setSurfaceProvider, this);
-  registerHybridMethod("createSwapChainForSurface", &EngineWrapper::createSwapChainForSurface, this);
-  registerHybridMethod("createSwapChainForRecorder", &EngineWrapper::createSwapChainForRecorder, this);
-  registerHybridMethod("setSwapChain", &EngineWrapper::setSwapChain, this);
-  registerHybridMethod("setIndirectLight", &EngineWrapper::setIndirectLight, this);
-  registerHybridMethod("loadAsset", &EngineWrapper::loadAsset, this);
-  registerHybridMethod("loadInstancedAsset", &EngineWrapper::loadInstancedAsset, this);
-  registerHybridMethod("getScene", &EngineWrapper::getScene, this);
-  registerHybridMethod("getView", &EngineWrapper::getView, this);
-  registerHybridMethod("getCamera", &EngineWrapper::getCamera, this);
-  registerHybridMethod("createOrbitCameraManipulator", &EngineWrapper::createOrbitCameraManipulator, this);
-  registerHybridMethod("createTransformManager", &EngineWrapper::createTransformManager, this);
-  registerHybridMethod("createRenderableManager", &EngineWrapper::createRenderableManager, this);
-  registerHybridMethod("createMaterial", &EngineWrapper::createMaterial, this);
-  registerHybridMethod("createLightManager", &EngineWrapper::createLightManager, this);
-  registerHybridMethod("createRenderer", &EngineWrapper::createRenderer, this);
-  registerHybridMethod("createNameComponentManager", &EngineWrapper::createNameComponentManager, this);
-  registerHybridMethod("createAndSetSkyboxByColor", &EngineWrapper::createAndSetSkyboxByColor, this);
-  registerHybridMethod("createAndSetSkyboxByTexture", &EngineWrapper::createAndSetSkyboxByTexture, this);
-  registerHybridMethod("clearSkybox", &EngineWrapper::clearSkybox, this);
-  registerHybridMethod("setAutomaticInstancingEnabled", &EngineWrapper::setAutomaticInstancingEnabled, this);
-  registerHybridMethod("flushAndWait", &EngineWrapper::flushAndWait, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("setSurfaceProvider", &EngineWrapper::setSurfaceProvider);
+  registerHybridMethod("createSwapChainForSurface", &EngineWrapper::createSwapChainForSurface);
+  registerHybridMethod("createSwapChainForRecorder", &EngineWrapper::createSwapChainForRecorder);
+  registerHybridMethod("setSwapChain", &EngineWrapper::setSwapChain);
+  registerHybridMethod("setIndirectLight", &EngineWrapper::setIndirectLight);
+  registerHybridMethod("loadAsset", &EngineWrapper::loadAsset);
+  registerHybridMethod("loadInstancedAsset", &EngineWrapper::loadInstancedAsset);
+  registerHybridMethod("loadAssetAsync", &EngineWrapper::loadAssetAsync);
+  registerHybridMethod("setAssetLoadingFrameBudget", &EngineWrapper::setAssetLoadingFrameBudget);
+  registerHybridMethod("loadCachedAsset", &EngineWrapper::loadCachedAsset);
+  registerHybridMethod("getAssetCacheStats", &EngineWrapper::getAssetCacheStats);
+  registerHybridMethod("getScene", &EngineWrapper::getScene);
+  registerHybridMethod("getView", &EngineWrapper::getView);
+  registerHybridMethod("getCamera", &EngineWrapper::getCamera);
+  registerHybridMethod("createOrbitCameraManipulator", &EngineWrapper::createOrbitCameraManipulator);
+  registerHybridMethod("createTransformManager", &EngineWrapper::createTransformManager);
+  registerHybridMethod("createRenderableManager", &EngineWrapper::createRenderableManager);
+  registerHybridMethod("createMaterial", &EngineWrapper::createMaterial);
+  registerHybridMethod("createLightManager", &EngineWrapper::createLightManager);
+  registerHybridMethod("createRenderer", &EngineWrapper::createRenderer);
+  registerHybridMethod("createNameComponentManager", &EngineWrapper::createNameComponentManager);
+  registerHybridMethod("createAnimationMixer", &EngineWrapper::createAnimationMixer);
+  registerHybridMethod("createAndSetSkyboxByColor", &EngineWrapper::createAndSetSkyboxByColor);
+  registerHybridMethod("createAndSetSkyboxByTexture", &EngineWrapper::createAndSetSkyboxByTexture);
+  registerHybridMethod("clearSkybox", &EngineWrapper::clearSkybox);
+  registerHybridMethod("setAutomaticInstancingEnabled", &EngineWrapper::setAutomaticInstancingEnabled);
+  registerHybridMethod("flushAndWait", &EngineWrapper::flushAndWait);
 }
 void EngineWrapper::setSurfaceProvider(std::shared_ptr<SurfaceProvider> surfaceProvider) {
   pointee()->setSurfaceProvider(surfaceProvider);
@@ -105,6 +111,42 @@ std::shared_ptr<FilamentAssetWrapper> EngineWrapper::loadAsset(std::shared_ptr<F
 std::shared_ptr<FilamentAssetWrapper> EngineWrapper::loadInstancedAsset(std::shared_ptr<FilamentBuffer> modelBuffer, int instanceCount) {
   return pointee()->loadInstancedAsset(modelBuffer, instanceCount);
 }
+jsi::Value EngineWrapper::loadAssetAsync(jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
+  if (count < 1 || count > 3) {
+    [[unlikely]];
+    throw jsi::JSError(runtime, "loadAssetAsync(..) expects 1 to 3 arguments, but received " + std::to_string(count) + "!");
+  }
+  auto modelBuffer = JSIConverter<std::shared_ptr<FilamentBuffer>>::fromJSI(runtime, args[0]);
+  std::optional<int> instanceCount = count > 1 ? JSIConverter<std::optional<int>>::fromJSI(runtime, args[1]) : std::nullopt;
+
+  std::optional<AsyncAssetLoader::OnProgress> onProgress = std::nullopt;
+  if (count > 2 && !args[2].isUndefined() && !args[2].isNull()) {
+    // Progress is reported on the render thread, so we call the JS callback on the Thread of the Runtime that started the load.
+    // The callback also has to be deleted on that Thread, as it holds a jsi::Function.
+    std::shared_ptr<Dispatcher> dispatcher = Dispatcher::getRuntimeGlobalDispatcher(runtime);
+    auto callbackPtr = new std::function<void(double)>(JSIConverter<std::function<void(double)>>::fromJSI(runtime, args[2]));
+    auto callback = std::shared_ptr<std::function<void(double)>>(
+        callbackPtr, [dispatcher](std::function<void(double)>* ptr) { dispatcher->runAsync([ptr]() { delete ptr; }); });
+    onProgress = [callback, dispatcher](double progress) { dispatcher->runAsync([callback, progress]() { (*callback)(progress); }); };
+  }
+
+  std::future<std::shared_ptr<FilamentAssetWrapper>> future = pointee()->loadAssetAsync(modelBuffer, instanceCount, std::move(onProgress));
+  return JSIConverter<std::future<std::shared_ptr<FilamentAssetWrapper>>>::toJSI(runtime, std::move(future));
+}
+void EngineWrapper::setAssetLoadingFrameBudget(double milliseconds) {
+  pointee()->setAssetLoadingFrameBudget(milliseconds);
+}
+std::shared_ptr<FilamentAssetWrapper> EngineWrapper::loadCachedAsset(std::shared_ptr<FilamentBuffer> modelBuffer) {
+  return pointee()->loadCachedAsset(modelBuffer);
+}
+std::unordered_map<std::string, double> EngineWrapper::getAssetCacheStats() {
+  AssetCache::Stats stats = pointee()->getAssetCacheStats();
+  return {{"hits", stats.hits},
+          {"misses", stats.misses},
+          {"residentBytes", stats.residentBytes},
+          {"residentAssets", stats.residentAssets},
+          {"activeInstances", stats.activeInstances}};
+}
 std::shared_ptr<SceneWrapper> EngineWrapper::getScene() {
   std::shared_ptr<Scene> scene = pointee()->_scene;
   return std::make_shared<SceneWrapper>(scene);
@@ -169,7 +211,7 @@ std::shared_ptr<LightManagerWrapper> EngineWrapper::createLightManager() {
 }
 std::shared_ptr<RendererWrapper> EngineWrapper::createRenderer() {
   std::shared_ptr<Renderer> renderer = pointee()->_renderer;
-  return std::make_shared<RendererWrapper>(renderer);
+  return std::make_shared<RendererWrapper>(renderer, pointee());
 }
 std::shared_ptr<RenderableManagerWrapper> EngineWrapper::createRenderableManager() {
   return pointee()->createRenderableManager();
@@ -177,6 +219,9 @@ std::shared_ptr<RenderableManagerWrapper> EngineWrapper::createRenderableManager
 std::shared_ptr<NameComponentManagerWrapper> EngineWrapper::createNameComponentManager() {
   return pointee()->createNameComponentManager();
 }
+std::shared_ptr<AnimationMixerWrapper> EngineWrapper::createAnimationMixer() {
+  return std::make_shared<AnimationMixerWrapper>(std::make_shared<AnimationMixer>(pointee()->getAnimationWorkerPool()));
+}
 std::shared_ptr<MaterialWrapper> EngineWrapper::createMaterial(std::shared_ptr<FilamentBuffer> materialBuffer) {
   return pointee()->createMaterial(materialBuffer);
 }
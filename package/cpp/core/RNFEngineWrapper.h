@@ -6,6 +6,7 @@
 
 #include "jsi/RNFPointerHolder.h"
 
+#include "RNFAnimationMixerWrapper.h"
 #include "RNFCameraWrapper.h"
 #include "RNFChoreographer.h"
 #include "RNFFilamentAssetWrapper.h"
@@ -68,6 +69,10 @@ private: // Exposed public JS API
   void setIndirectLight(std::shared_ptr<FilamentBuffer> modelBuffer, std::optional<double> intensity, std::optional<int> irradianceBands);
   std::shared_ptr<FilamentAssetWrapper> loadAsset(std::shared_ptr<FilamentBuffer> modelBuffer);
   std::shared_ptr<FilamentAssetWrapper> loadInstancedAsset(std::shared_ptr<FilamentBuffer> modelBuffer, int instanceCount);
+  jsi::Value loadAssetAsync(jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* args, size_t count);
+  void setAssetLoadingFrameBudget(double milliseconds);
+  std::shared_ptr<FilamentAssetWrapper> loadCachedAsset(std::shared_ptr<FilamentBuffer> modelBuffer);
+  std::unordered_map<std::string, double> getAssetCacheStats();
   std::shared_ptr<SceneWrapper> getScene();
   std::shared_ptr<ViewWrapper> getView();
   std::shared_ptr<CameraWrapper> getCamera();
@@ -77,6 +82,7 @@ private: // Exposed public JS API
   std::shared_ptr<RendererWrapper> createRenderer();
   std::shared_ptr<RenderableManagerWrapper> createRenderableManager();
   std::shared_ptr<NameComponentManagerWrapper> createNameComponentManager();
+  std::shared_ptr<AnimationMixerWrapper> createAnimationMixer();
   std::shared_ptr<MaterialWrapper> createMaterial(std::shared_ptr<FilamentBuffer> materialBuffer);
   void createAndSetSkyboxByColor(std::string hexColor, std::optional<bool> showSun, std::optional<float> envIntensity);
   void createAndSetSkyboxByTexture(std::shared_ptr<FilamentBuffer> textureBuffer, std::optional<bool> showSun,
@@ -6,37 +6,78 @@
 #include <utils/Entity.h>
 #include <utils/EntityInstance.h>
 
+#include <unordered_set>
+
 namespace margelo {
 
 using namespace utils;
 
 void FilamentAssetWrapper::loadHybridMethods() {
-  registerHybridMethod("getRoot", &FilamentAssetWrapper::getRoot, this);
-  registerHybridMethod("releaseSourceData", &FilamentAssetWrapper::releaseSourceData, this);
-  registerHybridMethod("createAnimator", &FilamentAssetWrapper::createAnimator, this);
-  registerHybridGetter("entityCount", &FilamentAssetWrapper::getEntityCount, this);
-  registerHybridMethod("getEntities", &FilamentAssetWrapper::getEntities, this);
-  registerHybridGetter("renderableEntityCount", &FilamentAssetWrapper::getRenderableEntityCount, this);
-  registerHybridMethod("getRenderableEntities", &FilamentAssetWrapper::getRenderableEntities, this);
-  registerHybridMethod("getBoundingBox", &FilamentAssetWrapper::getBoundingBox, this);
-  registerHybridMethod("getFirstEntityByName", &FilamentAssetWrapper::getFirstEntityByName, this);
-  registerHybridMethod("getInstance", &FilamentAssetWrapper::getInstance, this);
-  registerHybridMethod("getAssetInstances", &FilamentAssetWrapper::getAssetInstances, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("getRoot", &FilamentAssetWrapper::getRoot);
+  registerHybridMethod("releaseSourceData", &FilamentAssetWrapper::releaseSourceData);
+  registerHybridMethod("createAnimator", &FilamentAssetWrapper::createAnimator);
+  registerHybridGetter("entityCount", &FilamentAssetWrapper::getEntityCount);
+  registerHybridMethod("getEntities", &FilamentAssetWrapper::getEntities);
+  registerHybridGetter("renderableEntityCount", &FilamentAssetWrapper::getRenderableEntityCount);
+  registerHybridMethod("getRenderableEntities", &FilamentAssetWrapper::getRenderableEntities);
+  registerHybridMethod("getBoundingBox", &FilamentAssetWrapper::getBoundingBox);
+  registerHybridMethod("getFirstEntityByName", &FilamentAssetWrapper::getFirstEntityByName);
+  registerHybridMethod("getInstance", &FilamentAssetWrapper::getInstance);
+  registerHybridMethod("getAssetInstances", &FilamentAssetWrapper::getAssetInstances);
+}
+
+ScopedRange<const Entity> FilamentAssetWrapper::getScopedEntities() {
+  if (_scopedInstance != nullptr) {
+    return {_scopedInstance->getEntities(), _scopedInstance->getEntityCount()};
+  }
+  return {pointee()->getEntities(), pointee()->getEntityCount()};
+}
+
+ScopedRange<FilamentInstance* const> FilamentAssetWrapper::getScopedInstances() {
+  if (_scopedInstance != nullptr) {
+    return {&_scopedInstance, 1};
+  }
+  return {pointee()->getAssetInstances(), pointee()->getAssetInstanceCount()};
+}
+
+std::vector<Entity> FilamentAssetWrapper::getScopedRenderableEntities() {
+  const Entity* renderableEntities = pointee()->getRenderableEntities();
+  size_t renderableEntityCount = pointee()->getRenderableEntityCount();
+  if (_scopedInstance == nullptr) {
+    return std::vector<Entity>(renderableEntities, renderableEntities + renderableEntityCount);
+  }
+
+  // The asset only knows the renderable entities of all instances, so we filter them by our instance
+  ScopedRange<const Entity> instanceEntities = getScopedEntities();
+  std::unordered_set<Entity, Entity::Hasher> instanceEntitySet(instanceEntities.begin(), instanceEntities.end());
+  std::vector<Entity> entities;
+  for (size_t i = 0; i < renderableEntityCount; i++) {
+    if (instanceEntitySet.count(renderableEntities[i]) != 0) {
+      entities.push_back(renderableEntities[i]);
+    }
+  }
+  return entities;
 }
 
 std::shared_ptr<EntityWrapper> FilamentAssetWrapper::getRoot() {
-  Entity rootEntity = pointee()->getRoot();
+  Entity rootEntity = _scopedInstance != nullptr ? _scopedInstance->getRoot() : pointee()->getRoot();
   return std::make_shared<EntityWrapper>(rootEntity);
 }
 
 void FilamentAssetWrapper::releaseSourceData() {
+  if (_scopedInstance != nullptr) {
+    // The asset is shared through the AssetCache, which needs the source data to create more instances.
+    Logger::log("FilamentAssetWrapper", "Not releasing source data of a cached asset.");
+    return;
+  }
   std::unique_lock lock(_mutex);
   pointee()->releaseSourceData();
 }
 
 std::shared_ptr<AnimatorWrapper>
 FilamentAssetWrapper::createAnimator(std::shared_ptr<NameComponentManagerWrapper> nameComponentManagerWrapper) {
-  FilamentInstance* instance = pointee()->getInstance();
+  FilamentInstance* instance = _scopedInstance != nullptr ? _scopedInstance : pointee()->getInstance();
   Animator* animator = instance->getAnimator();
   std::shared_ptr<NameComponentManager> manager = nameComponentManagerWrapper->getManager();
   return std::make_shared<AnimatorWrapper>(animator, instance, manager);
@@ -44,24 +85,33 @@ FilamentAssetWrapper::createAnimator(std::shared_ptr<NameComponentManagerWrapper
 
 std::vector<std::shared_ptr<EntityWrapper>> FilamentAssetWrapper::getEntities() {
   std::vector<std::shared_ptr<EntityWrapper>> entities;
-  const Entity* entityArray = pointee()->getEntities();
-  for (int i = 0; i < pointee()->getEntityCount(); i++) {
-    entities.push_back(std::make_shared<EntityWrapper>(entityArray[i]));
+  for (Entity entity : getScopedEntities()) {
+    entities.push_back(std::make_shared<EntityWrapper>(entity));
   }
   return entities;
 }
 
 std::vector<std::shared_ptr<EntityWrapper>> FilamentAssetWrapper::getRenderableEntities() {
   std::vector<std::shared_ptr<EntityWrapper>> entities;
-  const Entity* entityArray = pointee()->getRenderableEntities();
-  for (int i = 0; i < pointee()->getRenderableEntityCount(); i++) {
-    entities.push_back(std::make_shared<EntityWrapper>(entityArray[i]));
+  for (Entity entity : getScopedRenderableEntities()) {
+    entities.push_back(std::make_shared<EntityWrapper>(entity));
   }
   return entities;
 }
 
 std::optional<std::shared_ptr<EntityWrapper>> FilamentAssetWrapper::getFirstEntityByName(const std::string& name) {
-  Entity entity = pointee()->getFirstEntityByName(name.c_str());
+  Entity entity;
+  if (_scopedInstance != nullptr) {
+    for (Entity instanceEntity : getScopedEntities()) {
+      const char* entityName = pointee()->getName(instanceEntity);
+      if (entityName != nullptr && name == entityName) {
+        entity = instanceEntity;
+        break;
+      }
+    }
+  } else {
+    entity = pointee()->getFirstEntityByName(name.c_str());
+  }
   if (entity.isNull()) {
     Logger::log("FilamentAssetWrapper", "Entity with name %s not found!", name.c_str());
     return std::nullopt;
@@ -71,16 +121,14 @@ std::optional<std::shared_ptr<EntityWrapper>> FilamentAssetWrapper::getFirstEnti
 }
 
 std::shared_ptr<FilamentInstanceWrapper> FilamentAssetWrapper::getInstance() {
-  FilamentInstance* instance = pointee()->getInstance();
+  FilamentInstance* instance = _scopedInstance != nullptr ? _scopedInstance : pointee()->getInstance();
   return std::make_shared<FilamentInstanceWrapper>(instance);
 }
 
 std::vector<std::shared_ptr<FilamentInstanceWrapper>> FilamentAssetWrapper::getAssetInstances() {
   std::vector<std::shared_ptr<FilamentInstanceWrapper>> instances;
-  FilamentInstance** instanceArray = pointee()->getAssetInstances();
-  size_t instanceCount = pointee()->getAssetInstanceCount();
-  for (int i = 0; i < instanceCount; i++) {
-    instances.push_back(std::make_shared<FilamentInstanceWrapper>(instanceArray[i]));
+  for (FilamentInstance* instance : getScopedInstances()) {
+    instances.push_back(std::make_shared<FilamentInstanceWrapper>(instance));
   }
   return instances;
 }
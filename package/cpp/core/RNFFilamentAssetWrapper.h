@@ -6,6 +6,7 @@
 #include "jsi/RNFPointerHolder.h"
 #include <filament/TransformManager.h>
 #include <gltfio/FilamentAsset.h>
+#include <gltfio/FilamentInstance.h>
 
 namespace margelo {
 
@@ -15,9 +16,31 @@ class FilamentInstanceWrapper;
 
 using namespace filament;
 
+// A non-owning view of the entities or instances a FilamentAssetWrapper represents.
+template <typename T> struct ScopedRange {
+  T* pointer;
+  size_t count;
+
+  T* begin() const {
+    return pointer;
+  }
+  T* end() const {
+    return pointer + count;
+  }
+  T* data() const {
+    return pointer;
+  }
+  size_t size() const {
+    return count;
+  }
+};
+
 class FilamentAssetWrapper : public PointerHolder<gltfio::FilamentAsset> {
 public:
   explicit FilamentAssetWrapper(std::shared_ptr<gltfio::FilamentAsset> asset) : PointerHolder("FilamentAssetWrapper", asset) {}
+  // Creates a wrapper that only represents the given instance of a shared asset (see AssetCache).
+  explicit FilamentAssetWrapper(std::shared_ptr<gltfio::FilamentAsset> asset, gltfio::FilamentInstance* scopedInstance)
+      : PointerHolder("FilamentAssetWrapper", asset), _scopedInstance(scopedInstance) {}
 
   void loadHybridMethods() override;
 
@@ -25,20 +48,30 @@ public:
     return pointee();
   }
 
+  // Internal: The entities this wrapper represents, either all entities of the asset or only the ones of its scoped instance.
+  ScopedRange<const Entity> getScopedEntities();
+  // Internal: The instances this wrapper represents, either all instances of the asset or only its scoped instance.
+  ScopedRange<gltfio::FilamentInstance* const> getScopedInstances();
+  // Internal: The renderable entities this wrapper represents.
+  std::vector<Entity> getScopedRenderableEntities();
+
 private: // Public API functions:
   std::shared_ptr<EntityWrapper> getRoot();
   void releaseSourceData();
   std::shared_ptr<AnimatorWrapper> createAnimator(std::shared_ptr<NameComponentManagerWrapper> nameComponentManagerWrapper);
   int getEntityCount() {
-    return pointee()->getEntityCount();
+    return static_cast<int>(getScopedEntities().size());
   }
   std::vector<std::shared_ptr<EntityWrapper>> getEntities();
   int getRenderableEntityCount() {
+    if (_scopedInstance != nullptr) {
+      return static_cast<int>(getScopedRenderableEntities().size());
+    }
     return pointee()->getRenderableEntityCount();
   }
   std::vector<std::shared_ptr<EntityWrapper>> getRenderableEntities();
   std::shared_ptr<AABBWrapper> getBoundingBox() {
-    Aabb aabb = pointee()->getBoundingBox();
+    Aabb aabb = _scopedInstance != nullptr ? _scopedInstance->getBoundingBox() : pointee()->getBoundingBox();
     return std::make_shared<AABBWrapper>(aabb);
   }
 
@@ -50,6 +83,7 @@ private: // Public API functions:
 
 private: // Internal state:
   std::mutex _mutex;
+  gltfio::FilamentInstance* _scopedInstance = nullptr;
 };
 
 } // namespace margelo
@@ -10,11 +10,11 @@
 namespace margelo {
 
 void FilamentInstanceWrapper::loadHybridMethods() {
-  registerHybridGetter("entityCount", &FilamentInstanceWrapper::getEntityCount, this);
-  registerHybridMethod("getEntities", &FilamentInstanceWrapper::getEntities, this);
-  registerHybridMethod("getRoot", &FilamentInstanceWrapper::getRoot, this);
-  registerHybridMethod("createAnimator", &FilamentInstanceWrapper::createAnimator, this);
-  registerHybridMethod("getBoundingBox", &FilamentInstanceWrapper::getBoundingBox, this);
+  registerHybridGetter("entityCount", &FilamentInstanceWrapper::getEntityCount);
+  registerHybridMethod("getEntities", &FilamentInstanceWrapper::getEntities);
+  registerHybridMethod("getRoot", &FilamentInstanceWrapper::getRoot);
+  registerHybridMethod("createAnimator", &FilamentInstanceWrapper::createAnimator);
+  registerHybridMethod("getBoundingBox", &FilamentInstanceWrapper::getBoundingBox);
 }
 
 int FilamentInstanceWrapper::getEntityCount() {
@@ -0,0 +1,637 @@
+#include "RNFGltfGeometryReader.h"
+
+#include <math/mat4.h>
+#include <math/quat.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace margelo {
+
+namespace {
+
+  // A view of bytes owned by the file or by a decoded buffer
+  struct ByteRange {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    bool empty() const {
+      return size == 0;
+    }
+  };
+
+  // A minimal JSON DOM, only as much as reading glTF needs
+  struct JsonValue {
+    enum class Type { NUL, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+
+    Type type = Type::NUL;
+    bool boolean = false;
+    double number = 0;
+    std::string string;
+    // Elements of arrays, values of objects
+    std::vector<JsonValue> values;
+    // Keys of objects
+    std::vector<std::string> keys;
+
+    const JsonValue* find(const char* key) const {
+      for (size_t i = 0; i < keys.size(); i++) {
+        if (keys[i] == key) {
+          return &values[i];
+        }
+      }
+      return nullptr;
+    }
+    const JsonValue* at(size_t index) const {
+      return type == Type::ARRAY && index < values.size() ? &values[index] : nullptr;
+    }
+    double numberOr(const char* key, double fallback) const {
+      const JsonValue* value = find(key);
+      return value != nullptr && value->type == Type::NUMBER ? value->number : fallback;
+    }
+    // Offsets, lengths, counts and indices. Casting anything but a non-negative integer that fits into size_t is undefined,
+    // so those are rejected instead.
+    size_t toSize(const char* name) const {
+      // Doubles only represent integers exactly up to 2^53
+      constexpr double MAX_EXACT_INTEGER = 9007199254740992.0;
+      bool isValid = type == Type::NUMBER && number >= 0 && number < MAX_EXACT_INTEGER &&
+                     number < static_cast<double>(std::numeric_limits<size_t>::max()) && std::floor(number) == number;
+      if (!isValid) {
+        [[unlikely]];
+        throw std::invalid_argument(std::string("Invalid glTF: ") + name + " has to be a non-negative integer!");
+      }
+      return static_cast<size_t>(number);
+    }
+    std::optional<size_t> indexOf(const char* key) const {
+      const JsonValue* value = find(key);
+      if (value == nullptr) {
+        return std::nullopt;
+      }
+      return value->toSize(key);
+    }
+    size_t sizeOr(const char* key, size_t fallback) const {
+      return indexOf(key).value_or(fallback);
+    }
+    std::string stringOr(const char* key, const std::string& fallback) const {
+      const JsonValue* value = find(key);
+      return value != nullptr && value->type == Type::STRING ? value->string : fallback;
+    }
+  };
+
+  class JsonParser {
+  public:
+    explicit JsonParser(const std::string& text) : _text(text) {}
+
+    JsonValue parse() {
+      JsonValue value = parseValue(0);
+      skipWhitespace();
+      if (_position != _text.size()) {
+        fail("Unexpected trailing characters");
+      }
+      return value;
+    }
+
+  private:
+    static constexpr int MAX_DEPTH = 64;
+
+    [[noreturn]] void fail(const char* reason) {
+      throw std::invalid_argument("Invalid glTF JSON at offset " + std::to_string(_position) + ": " + reason + "!");
+    }
+
+    void skipWhitespace() {
+      while (_position < _text.size() &&
+             (_text[_position] == ' ' || _text[_position] == '\n' || _text[_position] == '\r' || _text[_position] == '\t')) {
+        _position++;
+      }
+    }
+
+    bool consume(char character) {
+      skipWhitespace();
+      if (_position < _text.size() && _text[_position] == character) {
+        _position++;
+        return true;
+      }
+      return false;
+    }
+
+    bool consumeLiteral(const char* literal) {
+      size_t length = std::strlen(literal);
+      if (_text.compare(_position, length, literal) == 0) {
+        _position += length;
+        return true;
+      }
+      return false;
+    }
+
+    JsonValue parseValue(int depth) {
+      if (depth > MAX_DEPTH) {
+        fail("Nested too deeply");
+      }
+      skipWhitespace();
+      if (_position >= _text.size()) {
+        fail("Unexpected end");
+      }
+
+      JsonValue value;
+      char character = _text[_position];
+      if (character == '{') {
+        _position++;
+        value.type = JsonValue::Type::OBJECT;
+        if (consume('}')) {
+          return value;
+        }
+        do {
+          skipWhitespace();
+          value.keys.push_back(parseString());
+          if (!consume(':')) {
+            fail("Expected ':'");
+          }
+          value.values.push_back(parseValue(depth + 1));
+        } while (consume(','));
+        if (!consume('}')) {
+          fail("Expected '}'");
+        }
+      } else if (character == '[') {
+        _position++;
+        value.type = JsonValue::Type::ARRAY;
+        if (consume(']')) {
+          return value;
+        }
+        do {
+          value.values.push_back(parseValue(depth + 1));
+        } while (consume(','));
+        if (!consume(']')) {
+          fail("Expected ']'");
+        }
+      } else if (character == '"') {
+        value.type = JsonValue::Type::STRING;
+        value.string = parseString();
+      } else if (consumeLiteral("true")) {
+        value.type = JsonValue::Type::BOOLEAN;
+        value.boolean = true;
+      } else if (consumeLiteral("false")) {
+        value.type = JsonValue::Type::BOOLEAN;
+      } else if (consumeLiteral("null")) {
+        value.type = JsonValue::Type::NUL;
+      } else {
+        const char* start = _text.c_str() + _position;
+        char* end = nullptr;
+        value.type = JsonValue::Type::NUMBER;
+        value.number = std::strtod(start, &end);
+        if (end == start) {
+          fail("Unexpected character");
+        }
+        _position += end - start;
+      }
+      return value;
+    }
+
+    std::string parseString() {
+      if (_position >= _text.size() || _text[_position] != '"') {
+        fail("Expected a string");
+      }
+      _position++;
+      std::string result;
+      while (_position < _text.size() && _text[_position] != '"') {
+        char character = _text[_position++];
+        if (character != '\\') {
+          result.push_back(character);
+          continue;
+        }
+        if (_position >= _text.size()) {
+          break;
+        }
+        char escaped = _text[_position++];
+        switch (escaped) {
+          case 'b':
+            result.push_back('\b');
+            break;
+          case 'f':
+            result.push_back('\f');
+            break;
+          case 'n':
+            result.push_back('\n');
+            break;
+          case 'r':
+            result.push_back('\r');
+            break;
+          case 't':
+            result.push_back('\t');
+            break;
+          case 'u':
+            appendCodePoint(result);
+            break;
+          default:
+            result.push_back(escaped);
+            break;
+        }
+      }
+      if (_position >= _text.size()) {
+        fail("Unterminated string");
+      }
+      _position++;
+      return result;
+    }
+
+    void appendCodePoint(std::string& result) {
+      if (_position + 4 > _text.size()) {
+        fail("Invalid unicode escape");
+      }
+      uint32_t codePoint = static_cast<uint32_t>(std::strtoul(_text.substr(_position, 4).c_str(), nullptr, 16));
+      _position += 4;
+      // Surrogate pairs are combined, so names with emojis compare equal to their UTF-8 form
+      if (codePoint >= 0xD800 && codePoint <= 0xDBFF && _text.compare(_position, 2, "\\u") == 0 && _position + 6 <= _text.size()) {
+        uint32_t low = static_cast<uint32_t>(std::strtoul(_text.substr(_position + 2, 4).c_str(), nullptr, 16));
+        if (low >= 0xDC00 && low <= 0xDFFF) {
+          codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+          _position += 6;
+        }
+      }
+      if (codePoint < 0x80) {
+        result.push_back(static_cast<char>(codePoint));
+      } else if (codePoint < 0x800) {
+        result.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+      } else if (codePoint < 0x10000) {
+        result.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+      } else {
+        result.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        result.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        result.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        result.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+      }
+    }
+
+  private:
+    const std::string& _text;
+    size_t _position = 0;
+  };
+
+  constexpr uint32_t GLB_MAGIC = 0x46546C67;       // "glTF"
+  constexpr uint32_t GLB_CHUNK_JSON = 0x4E4F534A;  // "JSON"
+  constexpr uint32_t GLB_CHUNK_BIN = 0x004E4942;   // "BIN\0"
+  constexpr size_t COMPONENT_UNSIGNED_BYTE = 5121;
+  constexpr size_t COMPONENT_UNSIGNED_SHORT = 5123;
+  constexpr size_t COMPONENT_UNSIGNED_INT = 5125;
+  constexpr size_t COMPONENT_FLOAT = 5126;
+  constexpr size_t MODE_TRIANGLES = 4;
+  constexpr int MAX_NODE_DEPTH = 256;
+
+  uint32_t readUint32(const uint8_t* data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(uint32_t));
+    return value;
+  }
+
+  std::vector<uint8_t> decodeBase64(const std::string& text, size_t offset) {
+    auto decodeCharacter = [](char character) -> int {
+      if (character >= 'A' && character <= 'Z') {
+        return character - 'A';
+      } else if (character >= 'a' && character <= 'z') {
+        return character - 'a' + 26;
+      } else if (character >= '0' && character <= '9') {
+        return character - '0' + 52;
+      } else if (character == '+' || character == '-') {
+        return 62;
+      } else if (character == '/' || character == '_') {
+        return 63;
+      }
+      return -1;
+    };
+
+    std::vector<uint8_t> result;
+    result.reserve((text.size() - offset) * 3 / 4);
+    uint32_t accumulator = 0;
+    int bits = 0;
+    for (size_t i = offset; i < text.size(); i++) {
+      int value = decodeCharacter(text[i]);
+      if (value < 0) {
+        // Padding
+        continue;
+      }
+      accumulator = (accumulator << 6) | static_cast<uint32_t>(value);
+      bits += 6;
+      if (bits >= 8) {
+        bits -= 8;
+        result.push_back(static_cast<uint8_t>((accumulator >> bits) & 0xFF));
+      }
+    }
+    return result;
+  }
+
+  class Reader {
+  public:
+    Reader(const uint8_t* data, size_t size) {
+      std::string jsonText;
+      if (size >= 12 && readUint32(data) == GLB_MAGIC) {
+        // Header (magic, version, length), followed by the JSON chunk and an optional BIN chunk
+        size_t offset = 12;
+        while (offset + 8 <= size) {
+          uint32_t chunkLength = readUint32(data + offset);
+          uint32_t chunkType = readUint32(data + offset + 4);
+          offset += 8;
+          if (chunkLength > size - offset) {
+            throw std::invalid_argument("Invalid glb: A chunk exceeds the file size!");
+          }
+          if (chunkType == GLB_CHUNK_JSON && jsonText.empty()) {
+            jsonText.assign(reinterpret_cast<const char*>(data + offset), chunkLength);
+          } else if (chunkType == GLB_CHUNK_BIN && _binaryChunk.empty()) {
+            _binaryChunk = ByteRange{data + offset, chunkLength};
+          }
+          offset += chunkLength;
+        }
+      } else {
+        jsonText.assign(reinterpret_cast<const char*>(data), size);
+      }
+      if (jsonText.empty()) {
+        throw std::invalid_argument("Invalid glTF: No JSON found!");
+      }
+      _json = JsonParser(jsonText).parse();
+      if (_json.type != JsonValue::Type::OBJECT) {
+        throw std::invalid_argument("Invalid glTF: The JSON is not an object!");
+      }
+    }
+
+    std::vector<GltfGeometryReader::Primitive> read(const std::optional<std::string>& nodeName) {
+      const JsonValue* nodes = _json.find("nodes");
+      if (nodeName.has_value()) {
+        for (size_t i = 0; nodes != nullptr && i < nodes->values.size(); i++) {
+          if (nodes->values[i].stringOr("name", "") == nodeName.value()) {
+            // In the node's own space
+            readNode(i, math::mat4f(), 0, true);
+            return std::move(_primitives);
+          }
+        }
+        throw std::invalid_argument("The glTF has no node named \"" + nodeName.value() + "\"!");
+      }
+
+      for (size_t rootIndex : getRootNodes()) {
+        readNode(rootIndex, math::mat4f(), 0, false);
+      }
+      return std::move(_primitives);
+    }
+
+  private:
+    std::vector<size_t> getRootNodes() {
+      std::vector<size_t> roots;
+      const JsonValue* scenes = _json.find("scenes");
+      size_t sceneIndex = _json.indexOf("scene").value_or(0);
+      const JsonValue* scene = scenes != nullptr ? scenes->at(sceneIndex) : nullptr;
+      if (scene != nullptr) {
+        const JsonValue* sceneNodes = scene->find("nodes");
+        for (size_t i = 0; sceneNodes != nullptr && i < sceneNodes->values.size(); i++) {
+          roots.push_back(sceneNodes->values[i].toSize("nodes"));
+        }
+        return roots;
+      }
+
+      // Without scenes, all nodes that aren't children of another node are roots
+      const JsonValue* nodes = _json.find("nodes");
+      size_t nodesCount = nodes != nullptr ? nodes->values.size() : 0;
+      std::vector<bool> isChild(nodesCount, false);
+      for (size_t i = 0; i < nodesCount; i++) {
+        const JsonValue* children = nodes->values[i].find("children");
+        for (size_t j = 0; children != nullptr && j < children->values.size(); j++) {
+          size_t child = children->values[j].toSize("children");
+          if (child < nodesCount) {
+            isChild[child] = true;
+          }
+        }
+      }
+      for (size_t i = 0; i < nodesCount; i++) {
+        if (!isChild[i]) {
+          roots.push_back(i);
+        }
+      }
+      return roots;
+    }
+
+    static math::mat4f getLocalTransform(const JsonValue& node) {
+      const JsonValue* matrix = node.find("matrix");
+      if (matrix != nullptr && matrix->values.size() == 16) {
+        // Column-major, like filament's matrices
+        math::mat4f transform;
+        for (size_t i = 0; i < 16; i++) {
+          transform[i / 4][i % 4] = static_cast<float>(matrix->values[i].number);
+        }
+        return transform;
+      }
+
+      math::float3 translation(0.0f);
+      math::quatf rotation(1.0f, 0.0f, 0.0f, 0.0f);
+      math::float3 scale(1.0f);
+      const JsonValue* translationValue = node.find("translation");
+      if (translationValue != nullptr && translationValue->values.size() == 3) {
+        translation =
+            math::float3(translationValue->values[0].number, translationValue->values[1].number, translationValue->values[2].number);
+      }
+      const JsonValue* rotationValue = node.find("rotation");
+      if (rotationValue != nullptr && rotationValue->values.size() == 4) {
+        // glTF stores quaternions as x, y, z, w
+        rotation = math::quatf(rotationValue->values[3].number, rotationValue->values[0].number, rotationValue->values[1].number,
+                               rotationValue->values[2].number);
+      }
+      const JsonValue* scaleValue = node.find("scale");
+      if (scaleValue != nullptr && scaleValue->values.size() == 3) {
+        scale = math::float3(scaleValue->values[0].number, scaleValue->values[1].number, scaleValue->values[2].number);
+      }
+      return math::mat4f::translation(translation) * math::mat4f(rotation) * math::mat4f::scaling(scale);
+    }
+
+    void readNode(size_t nodeIndex, const math::mat4f& parentTransform, int depth, bool isSpaceRoot) {
+      if (depth > MAX_NODE_DEPTH) {
+        throw std::invalid_argument("Invalid glTF: The node hierarchy is too deep or has a cycle!");
+      }
+      const JsonValue* nodes = _json.find("nodes");
+      const JsonValue* node = nodes != nullptr ? nodes->at(nodeIndex) : nullptr;
+      if (node == nullptr) {
+        throw std::invalid_argument("Invalid glTF: Node " + std::to_string(nodeIndex) + " does not exist!");
+      }
+
+      math::mat4f transform = isSpaceRoot ? parentTransform : parentTransform * getLocalTransform(*node);
+      std::optional<size_t> meshIndex = node->indexOf("mesh");
+      if (meshIndex.has_value()) {
+        readMesh(meshIndex.value(), transform);
+      }
+      const JsonValue* children = node->find("children");
+      for (size_t i = 0; children != nullptr && i < children->values.size(); i++) {
+        readNode(children->values[i].toSize("children"), transform, depth + 1, false);
+      }
+    }
+
+    void readMesh(size_t meshIndex, const math::mat4f& transform) {
+      const JsonValue* meshes = _json.find("meshes");
+      const JsonValue* mesh = meshes != nullptr ? meshes->at(meshIndex) : nullptr;
+      const JsonValue* primitives = mesh != nullptr ? mesh->find("primitives") : nullptr;
+      if (primitives == nullptr) {
+        throw std::invalid_argument("Invalid glTF: Mesh " + std::to_string(meshIndex) + " does not exist!");
+      }
+
+      for (const JsonValue& primitive : primitives->values) {
+        const JsonValue* extensions = primitive.find("extensions");
+        if (extensions != nullptr && extensions->find("KHR_draco_mesh_compression") != nullptr) {
+          throw std::invalid_argument("Draco compressed meshes are not supported!");
+        }
+        const JsonValue* attributes = primitive.find("attributes");
+        std::optional<size_t> positionAccessor = attributes != nullptr ? attributes->indexOf("POSITION") : std::nullopt;
+        if (!positionAccessor.has_value()) {
+          continue;
+        }
+
+        GltfGeometryReader::Primitive result;
+        result.positions = readPositions(positionAccessor.value());
+        for (math::float3& position : result.positions) {
+          position = (transform * math::float4(position, 1.0f)).xyz;
+        }
+
+        if (primitive.sizeOr("mode", MODE_TRIANGLES) == MODE_TRIANGLES) {
+          std::optional<size_t> indicesAccessor = primitive.indexOf("indices");
+          if (indicesAccessor.has_value()) {
+            result.triangleIndices = readIndices(indicesAccessor.value(), result.positions.size());
+          } else {
+            result.triangleIndices.resize(result.positions.size() - result.positions.size() % 3);
+            for (size_t i = 0; i < result.triangleIndices.size(); i++) {
+              result.triangleIndices[i] = static_cast<uint32_t>(i);
+            }
+          }
+          result.triangleIndices.resize(result.triangleIndices.size() - result.triangleIndices.size() % 3);
+        }
+        _primitives.push_back(std::move(result));
+      }
+    }
+
+    struct AccessorData {
+      const uint8_t* data;
+      size_t count;
+      size_t stride;
+    };
+
+    AccessorData getAccessorData(size_t accessorIndex, size_t expectedComponentType, const char* expectedType, size_t elementSize) {
+      const JsonValue* accessors = _json.find("accessors");
+      const JsonValue* accessor = accessors != nullptr ? accessors->at(accessorIndex) : nullptr;
+      if (accessor == nullptr) {
+        throw std::invalid_argument("Invalid glTF: Accessor " + std::to_string(accessorIndex) + " does not exist!");
+      }
+      if (accessor->sizeOr("componentType", 0) != expectedComponentType ||
+          accessor->stringOr("type", "") != expectedType) {
+        throw std::invalid_argument("Accessor " + std::to_string(accessorIndex) + " has an unsupported format (quantized or not " +
+                                    expectedType + ")!");
+      }
+      std::optional<size_t> bufferViewIndex = accessor->indexOf("bufferView");
+      if (!bufferViewIndex.has_value() || accessor->find("sparse") != nullptr) {
+        throw std::invalid_argument("Sparse, compressed or empty accessors are not supported!");
+      }
+
+      const JsonValue* bufferViews = _json.find("bufferViews");
+      const JsonValue* bufferView = bufferViews != nullptr ? bufferViews->at(bufferViewIndex.value()) : nullptr;
+      if (bufferView == nullptr) {
+        throw std::invalid_argument("Invalid glTF: BufferView " + std::to_string(bufferViewIndex.value()) + " does not exist!");
+      }
+      ByteRange buffer = getBuffer(bufferView->indexOf("buffer").value_or(0));
+      size_t viewOffset = bufferView->sizeOr("byteOffset", 0);
+      size_t viewLength = bufferView->sizeOr("byteLength", 0);
+      size_t stride = bufferView->sizeOr("byteStride", elementSize);
+      size_t accessorOffset = accessor->sizeOr("byteOffset", 0);
+      size_t count = accessor->sizeOr("count", 0);
+      if (stride < elementSize) {
+        throw std::invalid_argument("Invalid glTF: Accessor " + std::to_string(accessorIndex) + " has a stride smaller than its elements!");
+      }
+
+      // Written so that none of the terms can overflow, as all of them come from the file
+      bool isOutOfBounds = viewOffset > buffer.size || viewLength > buffer.size - viewOffset;
+      if (!isOutOfBounds && count > 0) {
+        isOutOfBounds = accessorOffset > viewLength || elementSize > viewLength - accessorOffset ||
+                        count - 1 > (viewLength - accessorOffset - elementSize) / stride;
+      }
+      if (isOutOfBounds) {
+        throw std::invalid_argument("Invalid glTF: Accessor " + std::to_string(accessorIndex) + " is out of bounds!");
+      }
+      return AccessorData{buffer.data + viewOffset + accessorOffset, count, stride};
+    }
+
+    std::vector<math::float3> readPositions(size_t accessorIndex) {
+      AccessorData accessor = getAccessorData(accessorIndex, COMPONENT_FLOAT, "VEC3", sizeof(float) * 3);
+      std::vector<math::float3> positions(accessor.count);
+      for (size_t i = 0; i < accessor.count; i++) {
+        std::memcpy(&positions[i], accessor.data + i * accessor.stride, sizeof(float) * 3);
+      }
+      return positions;
+    }
+
+    std::vector<uint32_t> readIndices(size_t accessorIndex, size_t verticesCount) {
+      const JsonValue* accessors = _json.find("accessors");
+      const JsonValue* accessor = accessors != nullptr ? accessors->at(accessorIndex) : nullptr;
+      size_t componentType = accessor != nullptr ? accessor->sizeOr("componentType", 0) : 0;
+      if (componentType != COMPONENT_UNSIGNED_BYTE && componentType != COMPONENT_UNSIGNED_SHORT &&
+          componentType != COMPONENT_UNSIGNED_INT) {
+        throw std::invalid_argument("Invalid glTF: Accessor " + std::to_string(accessorIndex) + " has an invalid index type!");
+      }
+      size_t componentSize = componentType == COMPONENT_UNSIGNED_BYTE ? 1 : componentType == COMPONENT_UNSIGNED_SHORT ? 2 : 4;
+      AccessorData data = getAccessorData(accessorIndex, componentType, "SCALAR", componentSize);
+
+      std::vector<uint32_t> indices(data.count);
+      for (size_t i = 0; i < data.count; i++) {
+        const uint8_t* element = data.data + i * data.stride;
+        uint32_t index = 0;
+        if (componentSize == 1) {
+          index = *element;
+        } else if (componentSize == 2) {
+          uint16_t value;
+          std::memcpy(&value, element, sizeof(uint16_t));
+          index = value;
+        } else {
+          index = readUint32(element);
+        }
+        if (index >= verticesCount) {
+          throw std::invalid_argument("Invalid glTF: Index " + std::to_string(index) + " is out of bounds!");
+        }
+        indices[i] = index;
+      }
+      return indices;
+    }
+
+    ByteRange getBuffer(size_t bufferIndex) {
+      auto decoded = _decodedBuffers.find(bufferIndex);
+      if (decoded != _decodedBuffers.end()) {
+        return ByteRange{decoded->second.data(), decoded->second.size()};
+      }
+
+      const JsonValue* buffers = _json.find("buffers");
+      const JsonValue* buffer = buffers != nullptr ? buffers->at(bufferIndex) : nullptr;
+      if (buffer == nullptr) {
+        throw std::invalid_argument("Invalid glTF: Buffer " + std::to_string(bufferIndex) + " does not exist!");
+      }
+      const JsonValue* uri = buffer->find("uri");
+      if (uri == nullptr && bufferIndex == 0 && !_binaryChunk.empty()) {
+        return _binaryChunk;
+      }
+      static constexpr auto BASE64_MARKER = ";base64,";
+      size_t markerPosition = uri != nullptr ? uri->string.find(BASE64_MARKER) : std::string::npos;
+      if (uri == nullptr || uri->string.rfind("data:", 0) != 0 || markerPosition == std::string::npos) {
+        throw std::invalid_argument("Buffers in external files are not supported, use a .glb or embed the buffers!");
+      }
+      std::vector<uint8_t>& bytes = _decodedBuffers[bufferIndex];
+      bytes = decodeBase64(uri->string, markerPosition + std::strlen(BASE64_MARKER));
+      return ByteRange{bytes.data(), bytes.size()};
+    }
+
+  private:
+    JsonValue _json;
+    ByteRange _binaryChunk;
+    std::unordered_map<size_t, std::vector<uint8_t>> _decodedBuffers;
+    std::vector<GltfGeometryReader::Primitive> _primitives;
+  };
+
+} // namespace
+
+std::vector<GltfGeometryReader::Primitive> GltfGeometryReader::read(const uint8_t* data, size_t size,
+                                                                    const std::optional<std::string>& nodeName) {
+  return Reader(data, size).read(nodeName);
+}
+
+} // namespace margelo
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <math/vec3.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace margelo {
+
+using namespace filament;
+
+// Reads the vertex positions and triangles of the meshes in a glTF file on the CPU, e.g. to build collision shapes.
+// gltfio uploads the geometry to GPU buffers. Its cgltf source data (FilamentAsset::getSourceAsset) can't be used instead, as the
+// cgltf headers aren't part of the prebuilt Filament libraries and useModel releases the source data after loading by default
+// (releaseSourceData). So this parses the glTF itself:
+// Binary .glb files and .gltf files with embedded (base64 data URI) buffers are supported, compressed meshes
+// (Draco, meshopt) and sparse accessors are not. Only float positions are read, quantized ones are rejected.
+class GltfGeometryReader {
+public:
+  struct Primitive {
+    // Transformed into the space the geometry is read in
+    std::vector<math::float3> positions;
+    // Three indices into `positions` per triangle, empty for primitives that aren't triangles (points, lines)
+    std::vector<uint32_t> triangleIndices;
+  };
+
+  /**
+   * Reads all mesh primitives of the default scene in the glTF's space, or if `nodeName` is set, the primitives of the first
+   * node with that name and its children in that node's space (so without the node's own transform).
+   * Throws if the glTF is invalid or uses unsupported features.
+   */
+  static std::vector<Primitive> read(const uint8_t* data, size_t size, const std::optional<std::string>& nodeName);
+};
+
+} // namespace margelo
@@ -13,20 +13,21 @@
 namespace margelo {
 
 void LightManagerWrapper::loadHybridMethods() {
-  registerHybridMethod("createLightEntity", &LightManagerWrapper::createLightEntity, this);
-  registerHybridMethod("destroy", &LightManagerWrapper::destroy, this);
-  registerHybridMethod("setPosition", &LightManagerWrapper::setPosition, this);
-  registerHybridMethod("getPosition", &LightManagerWrapper::getPosition, this);
-  registerHybridMethod("setDirection", &LightManagerWrapper::setDirection, this);
-  registerHybridMethod("getDirection", &LightManagerWrapper::getDirection, this);
-  registerHybridMethod("setColor", &LightManagerWrapper::setColor, this);
-  registerHybridMethod("getColor", &LightManagerWrapper::getColor, this);
-  registerHybridMethod("setIntensity", &LightManagerWrapper::setIntensity, this);
-  registerHybridMethod("getIntensity", &LightManagerWrapper::getIntensity, this);
-  registerHybridMethod("setFalloff", &LightManagerWrapper::setFalloff, this);
-  registerHybridMethod("getFalloff", &LightManagerWrapper::getFalloff, this);
-  registerHybridMethod("setSpotLightCone", &LightManagerWrapper::setSpotLightCone, this);
-  registerHybridMethod("getSpotLightCone", &LightManagerWrapper::getSpotLightCone, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("createLightEntity", &LightManagerWrapper::createLightEntity);
+  registerHybridMethod("destroy", &LightManagerWrapper::destroy);
+  registerHybridMethod("setPosition", &LightManagerWrapper::setPosition);
+  registerHybridMethod("getPosition", &LightManagerWrapper::getPosition);
+  registerHybridMethod("setDirection", &LightManagerWrapper::setDirection);
+  registerHybridMethod("getDirection", &LightManagerWrapper::getDirection);
+  registerHybridMethod("setColor", &LightManagerWrapper::setColor);
+  registerHybridMethod("getColor", &LightManagerWrapper::getColor);
+  registerHybridMethod("setIntensity", &LightManagerWrapper::setIntensity);
+  registerHybridMethod("getIntensity", &LightManagerWrapper::getIntensity);
+  registerHybridMethod("setFalloff", &LightManagerWrapper::setFalloff);
+  registerHybridMethod("getFalloff", &LightManagerWrapper::getFalloff);
+  registerHybridMethod("setSpotLightCone", &LightManagerWrapper::setSpotLightCone);
+  registerHybridMethod("getSpotLightCone", &LightManagerWrapper::getSpotLightCone);
 }
 
 std::shared_ptr<EntityWrapper> LightManagerWrapper::createLightEntity(const std::string& lightTypeStr, std::optional<double> colorKelvin,
@@ -91,7 +92,7 @@ LightManager::Instance LightManagerWrapper::getLightInstance(std::shared_ptr<Ent
   return lightInstance;
 }
 
-void LightManagerWrapper::setPosition(std::shared_ptr<EntityWrapper> entityWrapper, std::vector<double> position) {
+void LightManagerWrapper::setPosition(std::shared_ptr<EntityWrapper> entityWrapper, TypedArrayView<float> position) {
   std::unique_lock lock(_mutex);
   LightManager::Instance lightInstance = getLightInstance(entityWrapper);
 
@@ -105,7 +106,7 @@ std::vector<double> LightManagerWrapper::getPosition(std::shared_ptr<EntityWrapp
   math::float3 position = _lightManager.getPosition(lightInstance);
   return Converter::Float3ToVec(position);
 }
-void LightManagerWrapper::setDirection(std::shared_ptr<EntityWrapper> entityWrapper, std::vector<double> direction) {
+void LightManagerWrapper::setDirection(std::shared_ptr<EntityWrapper> entityWrapper, TypedArrayView<float> direction) {
   std::unique_lock lock(_mutex);
   LightManager::Instance lightInstance = getLightInstance(entityWrapper);
 
@@ -118,7 +119,7 @@ std::vector<double> LightManagerWrapper::getDirection(std::shared_ptr<EntityWrap
   math::float3 direction = _lightManager.getDirection(lightInstance);
   return Converter::Float3ToVec(direction);
 }
-void LightManagerWrapper::setColor(std::shared_ptr<EntityWrapper> entityWrapper, std::vector<double> color) {
+void LightManagerWrapper::setColor(std::shared_ptr<EntityWrapper> entityWrapper, TypedArrayView<float> color) {
   std::unique_lock lock(_mutex);
   LightManager::Instance lightInstance = getLightInstance(entityWrapper);
 
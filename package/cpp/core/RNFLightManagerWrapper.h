@@ -27,11 +27,11 @@ private: // JS API:
                                                    std::optional<double> falloffRadius, std::optional<std::vector<double>> spotLightCone);
 
   void destroy(std::shared_ptr<EntityWrapper> entityWrapper);
-  void setPosition(std::shared_ptr<EntityWrapper> entityWrapper, std::vector<double> position);
+  void setPosition(std::shared_ptr<EntityWrapper> entityWrapper, TypedArrayView<float> position);
   std::vector<double> getPosition(std::shared_ptr<EntityWrapper> entityWrapper);
-  void setDirection(std::shared_ptr<EntityWrapper> entityWrapper, std::vector<double> direction);
+  void setDirection(std::shared_ptr<EntityWrapper> entityWrapper, TypedArrayView<float> direction);
   std::vector<double> getDirection(std::shared_ptr<EntityWrapper> entityWrapper);
-  void setColor(std::shared_ptr<EntityWrapper> entityWrapper, std::vector<double> color);
+  void setColor(std::shared_ptr<EntityWrapper> entityWrapper, TypedArrayView<float> color);
   std::vector<double> getColor(std::shared_ptr<EntityWrapper> entityWrapper);
   void setIntensity(std::shared_ptr<EntityWrapper> entityWrapper, double intensity);
   double getIntensity(std::shared_ptr<EntityWrapper> entityWrapper);
@@ -10,20 +10,20 @@
 
 namespace margelo {
 void MaterialInstanceWrapper::loadHybridMethods() {
-  registerHybridMethod("setCullingMode", &MaterialInstanceWrapper::setCullingMode, this);
-  registerHybridMethod("setTransparencyMode", &MaterialInstanceWrapper::setTransparencyMode, this);
-  registerHybridMethod("changeAlpha", &MaterialInstanceWrapper::changeAlpha, this);
-  registerHybridMethod("setFloatParameter", &MaterialInstanceWrapper::setFloatParameter, this);
-  registerHybridMethod("setIntParameter", &MaterialInstanceWrapper::setIntParameter, this);
-  registerHybridMethod("setFloat3Parameter", &MaterialInstanceWrapper::setFloat3Parameter, this);
-  registerHybridMethod("setFloat4Parameter", &MaterialInstanceWrapper::setFloat4Parameter, this);
-  registerHybridMethod("setMat3fParameter", &MaterialInstanceWrapper::setMat3fParameter, this);
-  registerHybridMethod("getFloatParameter", &MaterialInstanceWrapper::getFloatParameter, this);
-  registerHybridMethod("getIntParameter", &MaterialInstanceWrapper::getIntParameter, this);
-  registerHybridMethod("getFloat3Parameter", &MaterialInstanceWrapper::getFloat3Parameter, this);
-  registerHybridMethod("getFloat4Parameter", &MaterialInstanceWrapper::getFloat4Parameter, this);
-  registerHybridMethod("getMat3fParameter", &MaterialInstanceWrapper::getMat3fParameter, this);
-  registerHybridGetter("getName", &MaterialInstanceWrapper::getName, this);
+  registerHybridMethod("setCullingMode", &MaterialInstanceWrapper::setCullingMode);
+  registerHybridMethod("setTransparencyMode", &MaterialInstanceWrapper::setTransparencyMode);
+  registerHybridMethod("changeAlpha", &MaterialInstanceWrapper::changeAlpha);
+  registerHybridMethod("setFloatParameter", &MaterialInstanceWrapper::setFloatParameter);
+  registerHybridMethod("setIntParameter", &MaterialInstanceWrapper::setIntParameter);
+  registerHybridMethod("setFloat3Parameter", &MaterialInstanceWrapper::setFloat3Parameter);
+  registerHybridMethod("setFloat4Parameter", &MaterialInstanceWrapper::setFloat4Parameter);
+  registerHybridMethod("setMat3fParameter", &MaterialInstanceWrapper::setMat3fParameter);
+  registerHybridMethod("getFloatParameter", &MaterialInstanceWrapper::getFloatParameter);
+  registerHybridMethod("getIntParameter", &MaterialInstanceWrapper::getIntParameter);
+  registerHybridMethod("getFloat3Parameter", &MaterialInstanceWrapper::getFloat3Parameter);
+  registerHybridMethod("getFloat4Parameter", &MaterialInstanceWrapper::getFloat4Parameter);
+  registerHybridMethod("getMat3fParameter", &MaterialInstanceWrapper::getMat3fParameter);
+  registerHybridGetter("getName", &MaterialInstanceWrapper::getName);
 }
 
 void MaterialInstanceWrapper::setCullingMode(std::string mode) {
@@ -9,14 +9,15 @@
 
 namespace margelo {
 void MaterialWrapper::loadHybridMethods() {
-  registerHybridMethod("createInstance", &MaterialWrapper::createInstance, this);
-  registerHybridMethod("setDefaultFloatParameter", &MaterialWrapper::setDefaultFloatParameter, this);
-  registerHybridMethod("setDefaultTextureParameter", &MaterialWrapper::setDefaultTextureParameter, this);
-  registerHybridMethod("getDefaultInstance", &MaterialWrapper::getDefaultInstance, this);
-  registerHybridMethod("setDefaultMat3fParameter", &MaterialWrapper::setDefaultMat3fParameter, this);
-  registerHybridMethod("setDefaultFloat3Parameter", &MaterialWrapper::setDefaultFloat3Parameter, this);
-  registerHybridMethod("setDefaultFloat4Parameter", &MaterialWrapper::setDefaultFloat4Parameter, this);
-  registerHybridMethod("setDefaultIntParameter", &MaterialWrapper::setDefaultIntParameter, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("createInstance", &MaterialWrapper::createInstance);
+  registerHybridMethod("setDefaultFloatParameter", &MaterialWrapper::setDefaultFloatParameter);
+  registerHybridMethod("setDefaultTextureParameter", &MaterialWrapper::setDefaultTextureParameter);
+  registerHybridMethod("getDefaultInstance", &MaterialWrapper::getDefaultInstance);
+  registerHybridMethod("setDefaultMat3fParameter", &MaterialWrapper::setDefaultMat3fParameter);
+  registerHybridMethod("setDefaultFloat3Parameter", &MaterialWrapper::setDefaultFloat3Parameter);
+  registerHybridMethod("setDefaultFloat4Parameter", &MaterialWrapper::setDefaultFloat4Parameter);
+  registerHybridMethod("setDefaultIntParameter", &MaterialWrapper::setDefaultIntParameter);
 }
 std::shared_ptr<MaterialInstanceWrapper> MaterialWrapper::createInstance() {
   return pointee()->createInstance();
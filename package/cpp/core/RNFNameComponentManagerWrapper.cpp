@@ -6,7 +6,8 @@
 namespace margelo {
 
     void NameComponentManagerWrapper::loadHybridMethods() {
-        registerHybridMethod("getEntityName", &NameComponentManagerWrapper::getEntityName, this);
+        PointerHolder::loadHybridMethods();
+        registerHybridMethod("getEntityName", &NameComponentManagerWrapper::getEntityName);
     }
 
     // TODO: This code is similar to EntityNameMap AnimatorWrapper::createEntityNameMap, consider refactoring
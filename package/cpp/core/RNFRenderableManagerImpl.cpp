@@ -37,11 +37,7 @@ std::shared_ptr<MaterialInstanceWrapper> RenderableManagerImpl::getMaterialInsta
 }
 
 void RenderableManagerImpl::setAssetEntitiesOpacity(std::shared_ptr<FilamentAssetWrapper> asset, double opacity) {
-  std::shared_ptr<FilamentAsset> fAsset = asset->getAsset();
-  size_t instanceCount = fAsset->getAssetInstanceCount();
-  FilamentInstance** instances = fAsset->getAssetInstances();
-  for (size_t i = 0; i < instanceCount; ++i) {
-    FilamentInstance* instance = instances[i];
+  for (FilamentInstance* instance : asset->getScopedInstances()) {
     setInstanceEntitiesOpacity(instance, opacity);
   }
 }
@@ -275,10 +271,8 @@ void RenderableManagerImpl::scaleBoundingBox(std::shared_ptr<FilamentAssetWrappe
   RenderableManager& renderableManager = _engine->getRenderableManager();
 
   // Get bounding box from asset
-  FilamentAsset* asset = assetWrapper->getAsset().get();
-  size_t entityCount = asset->getRenderableEntityCount();
-  const Entity* entities = asset->getRenderableEntities();
-  for (size_t i = 0; i < entityCount; ++i) {
+  std::vector<Entity> entities = assetWrapper->getScopedRenderableEntities();
+  for (size_t i = 0; i < entities.size(); ++i) {
     Entity entity = entities[i];
     RenderableManager::Instance renderable = renderableManager.getInstance(entity);
     Box boundingBox = renderableManager.getAxisAlignedBoundingBox(renderable);
@@ -10,19 +10,20 @@
 
 namespace margelo {
 void RenderableManagerWrapper::loadHybridMethods() {
-  registerHybridMethod("getPrimitiveCount", &RenderableManagerWrapper::getPrimitiveCount, this);
-  registerHybridMethod("getMaterialInstanceAt", &RenderableManagerWrapper::getMaterialInstanceAt, this);
-  registerHybridMethod("setMaterialInstanceAt", &RenderableManagerWrapper::setMaterialInstanceAt, this);
-  registerHybridMethod("setAssetEntitiesOpacity", &RenderableManagerWrapper::setAssetEntitiesOpacity, this);
-  registerHybridMethod("setInstanceEntitiesOpacity", &RenderableManagerWrapper::setInstanceWrapperEntitiesOpacity, this);
-  registerHybridMethod("changeMaterialTextureMap", &RenderableManagerWrapper::changeMaterialTextureMap, this);
-  registerHybridMethod("setCastShadow", &RenderableManagerWrapper::setCastShadow, this);
-  registerHybridMethod("setReceiveShadow", &RenderableManagerWrapper::setReceiveShadow, this);
-  registerHybridMethod("createPlane", &RenderableManagerWrapper::createPlane, this);
-  registerHybridMethod("createImageBackgroundShape", &RenderableManagerWrapper::createImageBackgroundShape, this);
-  registerHybridMethod("scaleBoundingBox", &RenderableManagerWrapper::scaleBoundingBox, this);
-  registerHybridMethod("createDebugCubeWireframe", &RenderableManagerWrapper::createDebugCubeWireframe, this);
-  registerHybridMethod("getAxisAlignedBoundingBox", &RenderableManagerWrapper::getAxisAlignedBoundingBox, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("getPrimitiveCount", &RenderableManagerWrapper::getPrimitiveCount);
+  registerHybridMethod("getMaterialInstanceAt", &RenderableManagerWrapper::getMaterialInstanceAt);
+  registerHybridMethod("setMaterialInstanceAt", &RenderableManagerWrapper::setMaterialInstanceAt);
+  registerHybridMethod("setAssetEntitiesOpacity", &RenderableManagerWrapper::setAssetEntitiesOpacity);
+  registerHybridMethod("setInstanceEntitiesOpacity", &RenderableManagerWrapper::setInstanceWrapperEntitiesOpacity);
+  registerHybridMethod("changeMaterialTextureMap", &RenderableManagerWrapper::changeMaterialTextureMap);
+  registerHybridMethod("setCastShadow", &RenderableManagerWrapper::setCastShadow);
+  registerHybridMethod("setReceiveShadow", &RenderableManagerWrapper::setReceiveShadow);
+  registerHybridMethod("createPlane", &RenderableManagerWrapper::createPlane);
+  registerHybridMethod("createImageBackgroundShape", &RenderableManagerWrapper::createImageBackgroundShape);
+  registerHybridMethod("scaleBoundingBox", &RenderableManagerWrapper::scaleBoundingBox);
+  registerHybridMethod("createDebugCubeWireframe", &RenderableManagerWrapper::createDebugCubeWireframe);
+  registerHybridMethod("getAxisAlignedBoundingBox", &RenderableManagerWrapper::getAxisAlignedBoundingBox);
 }
 int RenderableManagerWrapper::getPrimitiveCount(std::shared_ptr<EntityWrapper> entity) {
   return pointee()->getPrimitiveCount(entity);
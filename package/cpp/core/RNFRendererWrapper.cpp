@@ -3,15 +3,17 @@
 //
 
 #include "RNFRendererWrapper.h"
+#include "RNFEngineImpl.h"
 
 namespace margelo {
 void RendererWrapper::loadHybridMethods() {
-  registerHybridMethod("setFrameRateOptions", &RendererWrapper::setFrameRateOptions, this);
-  registerHybridMethod("setClearContent", &RendererWrapper::setClearContent, this);
-  registerHybridMethod("setPresentationTime", &RendererWrapper::setPresentationTime, this);
-  registerHybridMethod("beginFrame", &RendererWrapper::beginFrame, this);
-  registerHybridMethod("render", &RendererWrapper::render, this);
-  registerHybridMethod("endFrame", &RendererWrapper::endFrame, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("setFrameRateOptions", &RendererWrapper::setFrameRateOptions);
+  registerHybridMethod("setClearContent", &RendererWrapper::setClearContent);
+  registerHybridMethod("setPresentationTime", &RendererWrapper::setPresentationTime);
+  registerHybridMethod("beginFrame", &RendererWrapper::beginFrame);
+  registerHybridMethod("render", &RendererWrapper::render);
+  registerHybridMethod("endFrame", &RendererWrapper::endFrame);
 }
 
 void RendererWrapper::setFrameRateOptions(std::unordered_map<std::string, double> options) {
@@ -41,6 +43,12 @@ void RendererWrapper::setPresentationTime(double timestamp) {
 }
 
 bool RendererWrapper::beginFrame(std::shared_ptr<SwapChainWrapper> swapChainWrapper, double timestamp) {
+  std::shared_ptr<EngineImpl> engineImpl = _engineImpl.lock();
+  if (engineImpl != nullptr) {
+    // Upload the next part of any asset that is being loaded asynchronously, within the frame budget
+    engineImpl->updateAsyncAssetLoads();
+  }
+
   std::shared_ptr<SwapChain> swapChain = swapChainWrapper->getSwapChain();
   return pointee()->beginFrame(swapChain.get(), timestamp);
 }
@@ -13,9 +13,12 @@ namespace margelo {
 
 using namespace filament;
 
+class EngineImpl;
+
 class RendererWrapper : public PointerHolder<Renderer> {
 public:
-  explicit RendererWrapper(std::shared_ptr<Renderer> renderer) : PointerHolder("RendererWrapper", renderer) {}
+  explicit RendererWrapper(std::shared_ptr<Renderer> renderer, std::weak_ptr<EngineImpl> engineImpl)
+      : PointerHolder("RendererWrapper", renderer), _engineImpl(engineImpl) {}
 
   void loadHybridMethods() override;
 
@@ -33,6 +36,10 @@ private: // Exposed JS API
   bool beginFrame(std::shared_ptr<SwapChainWrapper> swapChainWrapper, double timestamp);
   void render(std::shared_ptr<ViewWrapper> viewWrapper);
   void endFrame();
+
+private:
+  // Used to advance asynchronous asset loads once per frame
+  std::weak_ptr<EngineImpl> _engineImpl;
 };
 
 } // namespace margelo
@@ -0,0 +1,156 @@
+#include "RNFRigidBodyTransformSync.h"
+
+namespace margelo {
+
+bool RigidBodyTransformSync::bind(TransformManager& transformManager, int bodyId, btRigidBody* body, Entity entity) {
+  Binding binding{};
+  binding.bodyId = bodyId;
+  binding.body = body;
+  binding.entity = entity;
+  binding.instance = transformManager.getInstance(entity);
+  if (!binding.instance.isValid()) {
+    return false;
+  }
+
+  // The length of the basis vectors, the rotation is replaced by the body's anyways
+  const math::mat4f& transform = transformManager.getTransform(binding.instance);
+  binding.scale = math::float3(length(transform[0].xyz), length(transform[1].xyz), length(transform[2].xyz));
+  // A sleeping body would not be synced until it wakes up
+  apply(transformManager, binding);
+
+  auto iterator = _bindingIndices.find(bodyId);
+  if (iterator != _bindingIndices.end()) {
+    _bindings[iterator->second] = binding;
+  } else {
+    _bindingIndices.emplace(bodyId, _bindings.size());
+    _bindings.push_back(binding);
+  }
+  return true;
+}
+
+void RigidBodyTransformSync::unbind(int bodyId) {
+  auto iterator = _bindingIndices.find(bodyId);
+  if (iterator == _bindingIndices.end()) {
+    return;
+  }
+
+  // Swap with the last binding to keep the list dense
+  size_t index = iterator->second;
+  _bindingIndices.erase(iterator);
+  if (index != _bindings.size() - 1) {
+    _bindings[index] = _bindings.back();
+    _bindingIndices[_bindings[index].bodyId] = index;
+  }
+  _bindings.pop_back();
+}
+
+void RigidBodyTransformSync::sync(TransformManager& transformManager) {
+  size_t componentCount = transformManager.getComponentCount();
+  bool syncAll = _isInvalidated;
+  _isInvalidated = false;
+  for (Binding& binding : _bindings) {
+    if (!syncAll && !binding.body->isActive()) {
+      continue;
+    }
+    if (!resolve(transformManager, componentCount, binding)) {
+      [[unlikely]];
+      // The entity has been destroyed
+      continue;
+    }
+    apply(transformManager, binding);
+  }
+}
+
+void RigidBodyTransformSync::capture(std::vector<Pose>& poses) {
+  bool isReset = _isInvalidated;
+  _isInvalidated = false;
+  poses.resize(_bindings.size());
+  for (size_t i = 0; i < _bindings.size(); i++) {
+    const Binding& binding = _bindings[i];
+    // Stepped with a fixed time step, so the body's transform is the one of the step, there is nothing to interpolate in the motion state
+    const btTransform& bodyTransform = binding.body->getWorldTransform();
+    const btVector3& origin = bodyTransform.getOrigin();
+    btQuaternion rotation = bodyTransform.getRotation();
+    Pose& pose = poses[i];
+    pose.entity = binding.entity;
+    pose.scale = binding.scale;
+    pose.position = math::float3(origin.x(), origin.y(), origin.z());
+    pose.rotation = math::quatf(rotation.w(), rotation.x(), rotation.y(), rotation.z());
+    pose.isActive = binding.body->isActive();
+    pose.isReset = isReset;
+  }
+}
+
+void RigidBodyTransformSync::applyInterpolated(TransformManager& transformManager, const std::vector<Pose>& previous,
+                                               const std::vector<Pose>& current, float alpha) {
+  for (size_t i = 0; i < current.size(); i++) {
+    const Pose& pose = current[i];
+    TransformManager::Instance instance = transformManager.getInstance(pose.entity);
+    if (!instance.isValid()) {
+      [[unlikely]];
+      // The entity has been destroyed
+      continue;
+    }
+
+    // Bindings only change between captures if entities were bound or unbound in between
+    bool wasBound = i < previous.size() && previous[i].entity == pose.entity;
+    // Interpolating a reset body would move it between unrelated poses, e.g. the ones before and after restoring a snapshot
+    if (!wasBound || pose.isReset) {
+      transformManager.setTransform(instance, composeTransform(pose.position, pose.rotation, pose.scale));
+      continue;
+    }
+    const Pose& previousPose = previous[i];
+    if (!pose.isActive && !previousPose.isActive) {
+      continue;
+    }
+    // Take the shorter way around, q and -q are the same rotation
+    math::quatf previousRotation = dot(previousPose.rotation, pose.rotation) < 0 ? -previousPose.rotation : previousPose.rotation;
+    math::float3 position = mix(previousPose.position, pose.position, alpha);
+    math::quatf rotation = nlerp(previousRotation, pose.rotation, alpha);
+    transformManager.setTransform(instance, composeTransform(position, rotation, pose.scale));
+  }
+}
+
+bool RigidBodyTransformSync::resolve(const TransformManager& transformManager, size_t componentCount, Binding& binding) {
+  // Instance 0 is invalid, so valid instances are in [1, componentCount]
+  TransformManager::Instance instance = binding.instance;
+  if (instance.isValid() && instance.asValue() <= componentCount && transformManager.getEntity(instance) == binding.entity) {
+    return true;
+  }
+  binding.instance = transformManager.getInstance(binding.entity);
+  return binding.instance.isValid();
+}
+
+void RigidBodyTransformSync::apply(TransformManager& transformManager, const Binding& binding) {
+  // The motion state holds the transform interpolated between the last two fixed steps
+  btTransform bodyTransform;
+  btMotionState* motionState = binding.body->getMotionState();
+  if (motionState != nullptr) {
+    motionState->getWorldTransform(bodyTransform);
+  } else {
+    bodyTransform = binding.body->getWorldTransform();
+  }
+
+  // T * R * S, without multiplying full matrices: Bullet's basis is row-major, its columns are the rotation's columns.
+  const btMatrix3x3& basis = bodyTransform.getBasis();
+  const btVector3& origin = bodyTransform.getOrigin();
+  math::mat4f transform;
+  for (int column = 0; column < 3; column++) {
+    btVector3 axis = basis.getColumn(column) * binding.scale[column];
+    transform[column] = math::float4(axis.x(), axis.y(), axis.z(), 0.0f);
+  }
+  transform[3] = math::float4(origin.x(), origin.y(), origin.z(), 1.0f);
+  transformManager.setTransform(binding.instance, transform);
+}
+
+math::mat4f RigidBodyTransformSync::composeTransform(const math::float3& position, const math::quatf& rotation, const math::float3& scale) {
+  // T * R * S, without multiplying full matrices
+  math::mat4f transform = math::mat4f(rotation);
+  transform[0] *= scale.x;
+  transform[1] *= scale.y;
+  transform[2] *= scale.z;
+  transform[3] = math::float4(position, 1.0f);
+  return transform;
+}
+
+} // namespace margelo
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <btBulletDynamicsCommon.h>
+#include <filament/TransformManager.h>
+#include <math/mat4.h>
+#include <math/quat.h>
+#include <math/vec3.h>
+#include <utils/Entity.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace margelo {
+
+using namespace filament;
+using namespace utils;
+
+// A flat list of (rigid body, entity) bindings, whose local transforms are set from the bodies' transforms with `sync()`.
+// The scale of the entity is taken from its local transform once when binding (rigid bodies don't carry any scale),
+// and the TransformManager instance is resolved once as well, re-resolving it only if it moved (see TransformSyncList).
+// Bodies are identified by an id, so the owner can unbind them in O(1) - the owner has to keep the bodies alive while bound.
+class RigidBodyTransformSync {
+public:
+  // The transform of a bound body at one point in time, so it can be applied to the entity later on another Thread.
+  struct Pose {
+    Entity entity;
+    math::float3 scale;
+    math::float3 position;
+    math::quatf rotation;
+    bool isActive;
+    // The body was moved without simulating (see `invalidate`), so this pose is applied as is instead of interpolated
+    bool isReset;
+  };
+
+  /**
+   * Binds the entity to the body, replacing a previous binding of the body, and sets its transform right away.
+   * Returns false (and does not bind) if the entity has no transform component.
+   */
+  bool bind(TransformManager& transformManager, int bodyId, btRigidBody* body, Entity entity);
+
+  /**
+   * Removes the binding of the body, if any.
+   */
+  void unbind(int bodyId);
+
+  /**
+   * Makes the next `sync` or `capture` include every bound body, active or not. Call after moving bodies without stepping
+   * (e.g. restoring a snapshot), as bodies that are asleep afterwards would not be synced until they wake up.
+   */
+  void invalidate() {
+    _isInvalidated = true;
+  }
+
+  /**
+   * Sets the local transform of every entity bound to an active body. Sleeping and deactivated bodies did not move, so they are skipped,
+   * unless the bindings were invalidated since the last sync.
+   * Must be called within a local transform transaction.
+   */
+  void sync(TransformManager& transformManager);
+
+  /**
+   * Records the current transform of every bound body, in the order of the bindings. If the bindings were invalidated since the
+   * last capture, every pose is marked as `isReset`.
+   * Does not access the TransformManager, so it may be called on another Thread than the render Thread.
+   */
+  void capture(std::vector<Pose>& poses);
+
+  /**
+   * Sets the local transforms of the entities interpolated between two captures, `alpha` = 0 being `previous`.
+   * Entities that weren't bound at the previous capture and reset poses are set to their current pose, bodies that slept at both are
+   * skipped.
+   * Must be called within a local transform transaction.
+   */
+  static void applyInterpolated(TransformManager& transformManager, const std::vector<Pose>& previous, const std::vector<Pose>& current,
+                                float alpha);
+
+  size_t size() const {
+    return _bindings.size();
+  }
+
+private:
+  struct Binding {
+    int bodyId;
+    btRigidBody* body;
+    Entity entity;
+    TransformManager::Instance instance;
+    math::float3 scale;
+  };
+
+private:
+  static bool resolve(const TransformManager& transformManager, size_t componentCount, Binding& binding);
+  static void apply(TransformManager& transformManager, const Binding& binding);
+  static math::mat4f composeTransform(const math::float3& position, const math::quatf& rotation, const math::float3& scale);
+
+private:
+  std::vector<Binding> _bindings;
+  // Index of each body's binding in `_bindings`
+  std::unordered_map<int, size_t> _bindingIndices;
+  bool _isInvalidated = false;
+};
+
+} // namespace margelo
@@ -5,13 +5,14 @@
 namespace margelo {
 
 void margelo::SceneWrapper::loadHybridMethods() {
-  registerHybridMethod("addEntity", &SceneWrapper::addEntity, this);
-  registerHybridMethod("addEntities", &SceneWrapper::addEntities, this);
-  registerHybridMethod("removeEntity", &SceneWrapper::removeEntity, this);
-  registerHybridMethod("removeEntities", &SceneWrapper::removeEntities, this);
-  registerHybridMethod("addAssetEntities", &SceneWrapper::addAssetEntities, this);
-  registerHybridMethod("removeAssetEntities", &SceneWrapper::removeAssetEntities, this);
-  registerHybridGetter("entityCount", &SceneWrapper::getEntityCount, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("addEntity", &SceneWrapper::addEntity);
+  registerHybridMethod("addEntities", &SceneWrapper::addEntities);
+  registerHybridMethod("removeEntity", &SceneWrapper::removeEntity);
+  registerHybridMethod("removeEntities", &SceneWrapper::removeEntities);
+  registerHybridMethod("addAssetEntities", &SceneWrapper::addAssetEntities);
+  registerHybridMethod("removeAssetEntities", &SceneWrapper::removeAssetEntities);
+  registerHybridGetter("entityCount", &SceneWrapper::getEntityCount);
 }
 
 void margelo::SceneWrapper::addEntity(std::shared_ptr<EntityWrapper> entity) {
@@ -52,7 +53,7 @@ void SceneWrapper::removeEntities(std::vector<std::shared_ptr<EntityWrapper>> en
   pointee()->removeEntities(entityArrayPtr, count);
 }
 
-void SceneWrapper::addAsset(std::shared_ptr<gltfio::FilamentAsset> asset) {
+void SceneWrapper::addAsset(std::shared_ptr<FilamentAssetWrapper> asset) {
   std::unique_lock lock(_mutex);
 
   if (asset == nullptr) {
@@ -60,10 +61,12 @@ void SceneWrapper::addAsset(std::shared_ptr<gltfio::FilamentAsset> asset) {
     return;
   }
 
-  pointee()->addEntities(asset->getEntities(), asset->getEntityCount());
+  // Only the entities of the wrapper's instance, if the asset is shared through the AssetCache
+  ScopedRange<const Entity> entities = asset->getScopedEntities();
+  pointee()->addEntities(entities.data(), entities.size());
 }
 
-void SceneWrapper::removeAsset(std::shared_ptr<gltfio::FilamentAsset> asset) {
+void SceneWrapper::removeAsset(std::shared_ptr<FilamentAssetWrapper> asset) {
   std::unique_lock lock(_mutex);
 
   if (asset == nullptr) {
@@ -72,9 +75,8 @@ void SceneWrapper::removeAsset(std::shared_ptr<gltfio::FilamentAsset> asset) {
   }
 
   Logger::log("SceneWrapper", "Removing an asset from scene");
-  auto entities = asset->getEntities();
-  auto entityCount = asset->getEntityCount();
-  pointee()->removeEntities(entities, entityCount);
+  ScopedRange<const Entity> entities = asset->getScopedEntities();
+  pointee()->removeEntities(entities.data(), entities.size());
 }
 
 void SceneWrapper::removeAssetEntities(std::shared_ptr<FilamentAssetWrapper> asset) {
@@ -87,7 +89,7 @@ void SceneWrapper::removeAssetEntities(std::shared_ptr<FilamentAssetWrapper> ass
     throw std::invalid_argument("Filament asset is null");
   }
 
-  removeAsset(filamentAsset);
+  removeAsset(asset);
 }
 
 void SceneWrapper::addAssetEntities(std::shared_ptr<FilamentAssetWrapper> asset) {
@@ -100,7 +102,7 @@ void SceneWrapper::addAssetEntities(std::shared_ptr<FilamentAssetWrapper> asset)
     throw std::invalid_argument("Filament asset is null");
   }
 
-  addAsset(filamentAsset);
+  addAsset(asset);
 }
 
 int SceneWrapper::getEntityCount() {
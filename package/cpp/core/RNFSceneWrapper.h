@@ -18,8 +18,8 @@ public:
 
   void loadHybridMethods() override;
 
-  void addAsset(std::shared_ptr<gltfio::FilamentAsset> asset);
-  void removeAsset(std::shared_ptr<gltfio::FilamentAsset> asset);
+  void addAsset(std::shared_ptr<FilamentAssetWrapper> asset);
+  void removeAsset(std::shared_ptr<FilamentAssetWrapper> asset);
 
 private:
   std::mutex _mutex;
@@ -11,8 +11,6 @@ class SwapChainWrapper : public PointerHolder<SwapChain> {
 public:
   explicit SwapChainWrapper(std::shared_ptr<SwapChain> swapChain) : PointerHolder("SwapChainWrapper", swapChain) {}
 
-  void loadHybridMethods() override {}
-
   std::shared_ptr<SwapChain> getSwapChain() {
     return pointee();
   }
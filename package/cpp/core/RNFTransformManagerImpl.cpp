@@ -6,6 +6,7 @@
 #include "RNFAABBWrapper.h"
 #include "core/utils/RNFConverter.h"
 #include <filament/TransformManager.h>
+#include <cstring>
 #include <math/mat4.h>
 #include <utils/EntityInstance.h>
 
@@ -66,14 +67,12 @@ void TransformManagerImpl::updateTransform(math::mat4 transform, Entity entity,
   transformManager.setTransform(instance, newTransform);
 }
 
-void TransformManagerImpl::setEntityPosition(Entity entity, std::vector<double> positionVec, bool multiplyCurrent) {
-  math::float3 position = Converter::VecToFloat3(positionVec);
+void TransformManagerImpl::setEntityPosition(Entity entity, math::float3 position, bool multiplyCurrent) {
   auto translationMatrix = math::mat4::translation(position);
   updateTransform(translationMatrix, entity, multiplyCurrent);
 }
 
-void TransformManagerImpl::setEntityRotation(Entity entity, double angleRadians, std::vector<double> axisVec, bool multiplyCurrent) {
-  math::float3 axis = Converter::VecToFloat3(axisVec);
+void TransformManagerImpl::setEntityRotation(Entity entity, double angleRadians, math::float3 axis, bool multiplyCurrent) {
   if (axis.x == 0 && axis.y == 0 && axis.z == 0) {
     throw std::invalid_argument("Axis cannot be zero");
   }
@@ -82,8 +81,7 @@ void TransformManagerImpl::setEntityRotation(Entity entity, double angleRadians,
   updateTransform(rotationMatrix, entity, multiplyCurrent);
 }
 
-void TransformManagerImpl::setEntityScale(Entity entity, std::vector<double> scaleVec, bool multiplyCurrent) {
-  math::float3 scale = Converter::VecToFloat3(scaleVec);
+void TransformManagerImpl::setEntityScale(Entity entity, math::float3 scale, bool multiplyCurrent) {
   auto scaleMatrix = math::mat4::scaling(scale);
   updateTransform(scaleMatrix, entity, multiplyCurrent);
 }
@@ -149,6 +147,87 @@ void TransformManagerImpl::transformToUnitCube(Entity rootEntity, Aabb aabb) {
   transformManager.setTransform(instance, transform);
 }
 
+template <size_t Stride, typename ComposeTransform>
+void TransformManagerImpl::setTransformsBatch(const int32_t* entityIds, size_t count, const float* data,
+                                              ComposeTransform&& composeTransform) {
+  std::unique_lock lock(_mutex);
+  TransformManager& transformManager = _engine->getTransformManager();
+
+  // Resolve all instances first, so an invalid entity can't leave the transaction open.
+  std::vector<TransformManager::Instance> instances;
+  instances.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    instances.push_back(getInstance(Entity::import(entityIds[i]), transformManager));
+  }
+
+  // Within a transaction the world transforms are only computed once in commit, instead of after every setTransform.
+  transformManager.openLocalTransformTransaction();
+  for (size_t i = 0; i < count; i++) {
+    const float* element = data + i * Stride;
+    transformManager.setTransform(instances[i], composeTransform(transformManager, instances[i], element));
+  }
+  transformManager.commitLocalTransformTransaction();
+}
+
+void TransformManagerImpl::setTransforms(const int32_t* entityIds, size_t count, const float* matrices) {
+  setTransformsBatch<16>(entityIds, count, matrices, [](TransformManager&, TransformManager::Instance, const float* matrix) {
+    math::mat4f transform;
+    std::memcpy(&transform[0][0], matrix, sizeof(float) * 16);
+    return transform;
+  });
+}
+
+void TransformManagerImpl::setTranslations(const int32_t* entityIds, size_t count, const float* translations) {
+  setTransformsBatch<3>(entityIds, count, translations,
+                        [](TransformManager& transformManager, TransformManager::Instance instance, const float* translation) {
+                          math::mat4f transform = transformManager.getTransform(instance);
+                          transform[3] = math::float4(translation[0], translation[1], translation[2], 1.0f);
+                          return transform;
+                        });
+}
+
+void TransformManagerImpl::setTransformsTRS(const int32_t* entityIds, size_t count, const float* transforms) {
+  setTransformsBatch<10>(entityIds, count, transforms, [](TransformManager&, TransformManager::Instance, const float* trs) {
+    // T * R * S, without multiplying full matrices: the rotation's columns are scaled, the translation is the last column.
+    math::quatf rotation = math::quatf(trs[6], trs[3], trs[4], trs[5]);
+    math::mat4f transform = math::mat4f(rotation);
+    transform[0] *= trs[7];
+    transform[1] *= trs[8];
+    transform[2] *= trs[9];
+    transform[3] = math::float4(trs[0], trs[1], trs[2], 1.0f);
+    return transform;
+  });
+}
+
+void TransformManagerImpl::bindRigidBody(RigidBodyTransformSync& sync, int bodyId, btRigidBody* body, Entity entity) {
+  std::unique_lock lock(_mutex);
+  if (!entity) {
+    [[unlikely]];
+    throw std::invalid_argument("Entity is null");
+  }
+  if (!sync.bind(_engine->getTransformManager(), bodyId, body, entity)) {
+    [[unlikely]];
+    throw std::invalid_argument("Entity is not valid / has no transform!");
+  }
+}
+
+void TransformManagerImpl::syncRigidBodies(RigidBodyTransformSync& sync) {
+  std::unique_lock lock(_mutex);
+  TransformManager& transformManager = _engine->getTransformManager();
+  transformManager.openLocalTransformTransaction();
+  sync.sync(transformManager);
+  transformManager.commitLocalTransformTransaction();
+}
+
+void TransformManagerImpl::syncRigidBodies(const std::vector<RigidBodyTransformSync::Pose>& previous,
+                                           const std::vector<RigidBodyTransformSync::Pose>& current, float alpha) {
+  std::unique_lock lock(_mutex);
+  TransformManager& transformManager = _engine->getTransformManager();
+  transformManager.openLocalTransformTransaction();
+  RigidBodyTransformSync::applyInterpolated(transformManager, previous, current, alpha);
+  transformManager.commitLocalTransformTransaction();
+}
+
 TransformManager::Instance TransformManagerImpl::getInstance(Entity entity, TransformManager& transformManager) {
   if (!entity) {
     [[unlikely]];
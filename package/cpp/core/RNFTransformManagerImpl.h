@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "RNFRigidBodyTransformSync.h"
 #include "bullet/RNFRigidBodyWrapper.h"
 #include "core/math/RNFTMat44Wrapper.h"
 #include "core/utils/RNFEntityWrapper.h"
@@ -24,14 +25,32 @@ public:
   void commitLocalTransformTransaction();
   void setTransform(Entity entity, std::shared_ptr<TMat44Wrapper> transform);
   std::shared_ptr<TMat44Wrapper> createIdentityMatrix();
-  void setEntityPosition(Entity entity, std::vector<double> positionVec, bool multiplyCurrent);
-  void setEntityRotation(Entity entity, double angleRadians, std::vector<double> axisVec, bool multiplyCurrent);
-  void setEntityScale(Entity entity, std::vector<double> scaleVec, bool multiplyCurrent);
+  void setEntityPosition(Entity entity, math::float3 position, bool multiplyCurrent);
+  void setEntityRotation(Entity entity, double angleRadians, math::float3 axis, bool multiplyCurrent);
+  void setEntityScale(Entity entity, math::float3 scale, bool multiplyCurrent);
   void updateTransformByRigidBody(Entity entity, std::shared_ptr<RigidBodyWrapper> rigidBody);
   void transformToUnitCube(Entity rootEntity, Aabb aabb);
 
+  // Batch updates, each applied within a single local transform transaction.
+  // Must not be called while a local transform transaction is already open.
+  // Sets the local transforms from 16 floats (column-major matrix) per entity.
+  void setTransforms(const int32_t* entityIds, size_t count, const float* matrices);
+  // Sets the translation (3 floats per entity) of the local transforms, keeping their rotation and scale.
+  void setTranslations(const int32_t* entityIds, size_t count, const float* translations);
+  // Sets the local transforms from translation (3), rotation quaternion (4, x y z w) and scale (3) - 10 floats per entity.
+  void setTransformsTRS(const int32_t* entityIds, size_t count, const float* transforms);
+  // Binds the entity to the rigid body in the given sync list. Throws if the entity has no transform component.
+  void bindRigidBody(RigidBodyTransformSync& sync, int bodyId, btRigidBody* body, Entity entity);
+  // Sets the local transforms of all entities bound to an active rigid body.
+  void syncRigidBodies(RigidBodyTransformSync& sync);
+  // Sets the local transforms of the bound entities interpolated between two captured poses, see RigidBodyTransformSync.
+  void syncRigidBodies(const std::vector<RigidBodyTransformSync::Pose>& previous, const std::vector<RigidBodyTransformSync::Pose>& current,
+                       float alpha);
+
 private: // Internal
   void updateTransform(math::mat4 transform, Entity entity, bool multiplyCurrent);
+  template <size_t Stride, typename ComposeTransform>
+  void setTransformsBatch(const int32_t* entityIds, size_t count, const float* data, ComposeTransform&& composeTransform);
   TransformManager::Instance getInstance(Entity entity, TransformManager& transformManager);
 
 private:
@@ -3,21 +3,26 @@
 //
 
 #include "RNFTransformManagerWrapper.h"
+#include "core/utils/RNFConverter.h"
 
 namespace margelo {
 
 void TransformManagerWrapper::loadHybridMethods() {
-  registerHybridMethod("getTransform", &TransformManagerWrapper::getTransform, this);
-  registerHybridMethod("getWorldTransform", &TransformManagerWrapper::getWorldTransform, this);
-  registerHybridMethod("openLocalTransformTransaction", &TransformManagerWrapper::openLocalTransformTransaction, this);
-  registerHybridMethod("commitLocalTransformTransaction", &TransformManagerWrapper::commitLocalTransformTransaction, this);
-  registerHybridMethod("setTransform", &TransformManagerWrapper::setTransform, this);
-  registerHybridMethod("createIdentityMatrix", &TransformManagerWrapper::createIdentityMatrix, this);
-  registerHybridMethod("setEntityPosition", &TransformManagerWrapper::setEntityPosition, this);
-  registerHybridMethod("setEntityRotation", &TransformManagerWrapper::setEntityRotation, this);
-  registerHybridMethod("setEntityScale", &TransformManagerWrapper::setEntityScale, this);
-  registerHybridMethod("updateTransformByRigidBody", &TransformManagerWrapper::updateTransformByRigidBody, this);
-  registerHybridMethod("transformToUnitCube", &TransformManagerWrapper::transformToUnitCube, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("getTransform", &TransformManagerWrapper::getTransform);
+  registerHybridMethod("getWorldTransform", &TransformManagerWrapper::getWorldTransform);
+  registerHybridMethod("openLocalTransformTransaction", &TransformManagerWrapper::openLocalTransformTransaction);
+  registerHybridMethod("commitLocalTransformTransaction", &TransformManagerWrapper::commitLocalTransformTransaction);
+  registerHybridMethod("setTransform", &TransformManagerWrapper::setTransform);
+  registerHybridMethod("createIdentityMatrix", &TransformManagerWrapper::createIdentityMatrix);
+  registerHybridMethod("setEntityPosition", &TransformManagerWrapper::setEntityPosition);
+  registerHybridMethod("setEntityRotation", &TransformManagerWrapper::setEntityRotation);
+  registerHybridMethod("setEntityScale", &TransformManagerWrapper::setEntityScale);
+  registerHybridMethod("updateTransformByRigidBody", &TransformManagerWrapper::updateTransformByRigidBody);
+  registerHybridMethod("transformToUnitCube", &TransformManagerWrapper::transformToUnitCube);
+  registerHybridMethod("setTransforms", &TransformManagerWrapper::setTransforms);
+  registerHybridMethod("setTranslations", &TransformManagerWrapper::setTranslations);
+  registerHybridMethod("setTransformsTRS", &TransformManagerWrapper::setTransformsTRS);
 }
 std::shared_ptr<TMat44Wrapper> TransformManagerWrapper::getTransform(std::shared_ptr<EntityWrapper> entityWrapper) {
   Entity entity = getEntity(entityWrapper);
@@ -40,20 +45,20 @@ void TransformManagerWrapper::setTransform(std::shared_ptr<EntityWrapper> entity
 std::shared_ptr<TMat44Wrapper> TransformManagerWrapper::createIdentityMatrix() {
   return pointee()->createIdentityMatrix();
 }
-void TransformManagerWrapper::setEntityPosition(std::shared_ptr<EntityWrapper> entityWrapper, std::vector<double> positionVec,
+void TransformManagerWrapper::setEntityPosition(std::shared_ptr<EntityWrapper> entityWrapper, TypedArrayView<float> positionVec,
                                                 bool multiplyCurrent) {
   Entity entity = getEntity(entityWrapper);
-  pointee()->setEntityPosition(entity, positionVec, multiplyCurrent);
+  pointee()->setEntityPosition(entity, Converter::VecToFloat3(positionVec), multiplyCurrent);
 }
 void TransformManagerWrapper::setEntityRotation(std::shared_ptr<EntityWrapper> entityWrapper, double angleRadians,
-                                                std::vector<double> axisVec, bool multiplyCurrent) {
+                                                TypedArrayView<float> axisVec, bool multiplyCurrent) {
   Entity entity = getEntity(entityWrapper);
-  pointee()->setEntityRotation(entity, angleRadians, axisVec, multiplyCurrent);
+  pointee()->setEntityRotation(entity, angleRadians, Converter::VecToFloat3(axisVec), multiplyCurrent);
 }
-void TransformManagerWrapper::setEntityScale(std::shared_ptr<EntityWrapper> entityWrapper, std::vector<double> scaleVec,
+void TransformManagerWrapper::setEntityScale(std::shared_ptr<EntityWrapper> entityWrapper, TypedArrayView<float> scaleVec,
                                              bool multiplyCurrent) {
   Entity entity = getEntity(entityWrapper);
-  pointee()->setEntityScale(entity, scaleVec, multiplyCurrent);
+  pointee()->setEntityScale(entity, Converter::VecToFloat3(scaleVec), multiplyCurrent);
 }
 void TransformManagerWrapper::updateTransformByRigidBody(std::shared_ptr<EntityWrapper> entityWrapper,
                                                          std::shared_ptr<RigidBodyWrapper> rigidBody) {
@@ -73,6 +78,27 @@ void TransformManagerWrapper::transformToUnitCube(std::shared_ptr<EntityWrapper>
   pointee()->transformToUnitCube(rootEntity, aabb);
 }
 
+void TransformManagerWrapper::setTransforms(TypedArrayView<int32_t> entityIds, TypedArrayView<float> matrices) {
+  validateBatchSize("setTransforms", entityIds.size(), matrices.size(), 16);
+  pointee()->setTransforms(entityIds.data(), entityIds.size(), matrices.data());
+}
+void TransformManagerWrapper::setTranslations(TypedArrayView<int32_t> entityIds, TypedArrayView<float> translations) {
+  validateBatchSize("setTranslations", entityIds.size(), translations.size(), 3);
+  pointee()->setTranslations(entityIds.data(), entityIds.size(), translations.data());
+}
+void TransformManagerWrapper::setTransformsTRS(TypedArrayView<int32_t> entityIds, TypedArrayView<float> transforms) {
+  validateBatchSize("setTransformsTRS", entityIds.size(), transforms.size(), 10);
+  pointee()->setTransformsTRS(entityIds.data(), entityIds.size(), transforms.data());
+}
+
+void TransformManagerWrapper::validateBatchSize(const char* method, size_t entityCount, size_t floatCount, size_t floatsPerEntity) {
+  if (floatCount != entityCount * floatsPerEntity) {
+    [[unlikely]];
+    throw std::invalid_argument(std::string(method) + ": Expected " + std::to_string(entityCount * floatsPerEntity) + " floats for " +
+                                std::to_string(entityCount) + " entities, but received " + std::to_string(floatCount) + "!");
+  }
+}
+
 Entity TransformManagerWrapper::getEntity(std::shared_ptr<EntityWrapper> entityWrapper) {
   if (!entityWrapper) {
     [[unlikely]];
@@ -16,6 +16,11 @@ public:
 
   void loadHybridMethods() override;
 
+public: // Internal API
+  std::shared_ptr<TransformManagerImpl> getTransformManager() {
+    return pointee();
+  }
+
 private: // Exposed JS API:
   std::shared_ptr<TMat44Wrapper> getTransform(std::shared_ptr<EntityWrapper> entityWrapper);
   std::shared_ptr<TMat44Wrapper> getWorldTransform(std::shared_ptr<EntityWrapper> entityWrapper);
@@ -23,14 +28,18 @@ private: // Exposed JS API:
   void commitLocalTransformTransaction();
   void setTransform(std::shared_ptr<EntityWrapper> entityWrapper, std::shared_ptr<TMat44Wrapper> transform);
   std::shared_ptr<TMat44Wrapper> createIdentityMatrix();
-  void setEntityPosition(std::shared_ptr<EntityWrapper> entity, std::vector<double> positionVec, bool multiplyCurrent);
-  void setEntityRotation(std::shared_ptr<EntityWrapper> entity, double angleRadians, std::vector<double> axisVec, bool multiplyCurrent);
-  void setEntityScale(std::shared_ptr<EntityWrapper> entity, std::vector<double> scaleVec, bool multiplyCurrent);
+  void setEntityPosition(std::shared_ptr<EntityWrapper> entity, TypedArrayView<float> positionVec, bool multiplyCurrent);
+  void setEntityRotation(std::shared_ptr<EntityWrapper> entity, double angleRadians, TypedArrayView<float> axisVec, bool multiplyCurrent);
+  void setEntityScale(std::shared_ptr<EntityWrapper> entity, TypedArrayView<float> scaleVec, bool multiplyCurrent);
   void updateTransformByRigidBody(std::shared_ptr<EntityWrapper> entityWrapper, std::shared_ptr<RigidBodyWrapper> rigidBody);
   void transformToUnitCube(std::shared_ptr<EntityWrapper> rootEntityWrapper, std::shared_ptr<AABBWrapper> aabbWrapper);
+  void setTransforms(TypedArrayView<int32_t> entityIds, TypedArrayView<float> matrices);
+  void setTranslations(TypedArrayView<int32_t> entityIds, TypedArrayView<float> translations);
+  void setTransformsTRS(TypedArrayView<int32_t> entityIds, TypedArrayView<float> transforms);
 
 private: // Internal
   Entity getEntity(std::shared_ptr<EntityWrapper> entityWrapper);
+  static void validateBatchSize(const char* method, size_t entityCount, size_t floatCount, size_t floatsPerEntity);
 };
 
 } // namespace margelo
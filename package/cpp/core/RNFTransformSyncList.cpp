@@ -0,0 +1,41 @@
+#include "RNFTransformSyncList.h"
+
+namespace margelo {
+
+bool TransformSyncList::add(TransformManager& transformManager, Entity source, Entity target) {
+  Pair pair{.sourceEntity = source, .targetEntity = target};
+  if (!resolve(transformManager, pair)) {
+    return false;
+  }
+  _pairs.push_back(pair);
+  return true;
+}
+
+void TransformSyncList::sync(TransformManager& transformManager) {
+  size_t componentCount = transformManager.getComponentCount();
+  for (Pair& pair : _pairs) {
+    if (!isResolved(transformManager, componentCount, pair.source, pair.sourceEntity) ||
+        !isResolved(transformManager, componentCount, pair.target, pair.targetEntity)) {
+      [[unlikely]];
+      if (!resolve(transformManager, pair)) {
+        // One of the entities has been destroyed
+        continue;
+      }
+    }
+    transformManager.setTransform(pair.target, transformManager.getTransform(pair.source));
+  }
+}
+
+bool TransformSyncList::isResolved(const TransformManager& transformManager, size_t componentCount, TransformManager::Instance instance,
+                                   Entity entity) {
+  // Instance 0 is invalid, so valid instances are in [1, componentCount]
+  return instance.isValid() && instance.asValue() <= componentCount && transformManager.getEntity(instance) == entity;
+}
+
+bool TransformSyncList::resolve(const TransformManager& transformManager, Pair& pair) {
+  pair.source = transformManager.getInstance(pair.sourceEntity);
+  pair.target = transformManager.getInstance(pair.targetEntity);
+  return pair.source.isValid() && pair.target.isValid();
+}
+
+} // namespace margelo
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <filament/TransformManager.h>
+#include <utils/Entity.h>
+
+#include <vector>
+
+namespace margelo {
+
+using namespace filament;
+using namespace utils;
+
+// A flat list of (source, target) transform components, whose local transforms are copied from source to target with `sync()`.
+// The TransformManager instances are resolved once when adding a pair, so syncing is a linear copy without any lookups.
+// Instances move when other transform components get destroyed, so each pair also keeps its entities to detect that
+// (with an O(1) check) and to resolve the pair again.
+class TransformSyncList {
+public:
+  /**
+   * Adds a pair of entities. Returns false (and does not add the pair) if either entity has no transform component.
+   */
+  bool add(TransformManager& transformManager, Entity source, Entity target);
+
+  /**
+   * Copies the local transform of every source onto its target.
+   */
+  void sync(TransformManager& transformManager);
+
+  size_t size() const {
+    return _pairs.size();
+  }
+
+private:
+  struct Pair {
+    TransformManager::Instance source;
+    TransformManager::Instance target;
+    Entity sourceEntity;
+    Entity targetEntity;
+  };
+
+private:
+  static bool isResolved(const TransformManager& transformManager, size_t componentCount, TransformManager::Instance instance,
+                         Entity entity);
+  static bool resolve(const TransformManager& transformManager, Pair& pair);
+
+private:
+  std::vector<Pair> _pairs;
+};
+
+} // namespace margelo
@@ -3,27 +3,28 @@
 namespace margelo {
 
 void ViewWrapper::loadHybridMethods() {
-  registerHybridMethod("getAspectRatio", &ViewWrapper::getAspectRatio, this);
-  registerHybridMethod("createAmbientOcclusionOptions", &ViewWrapper::createAmbientOcclusionOptions, this);
-  registerHybridMethod("setAmbientOcclusionOptions", &ViewWrapper::setAmbientOcclusionOptions, this);
-  registerHybridMethod("getAmbientOcclusionOptions", &ViewWrapper::getAmbientOcclusionOptions, this);
-  registerHybridMethod("createDynamicResolutionOptions", &ViewWrapper::createDynamicResolutionOptions, this);
-  registerHybridMethod("setDynamicResolutionOptions", &ViewWrapper::setDynamicResolutionOptions, this);
-  registerHybridMethod("getDynamicResolutionOptions", &ViewWrapper::getDynamicResolutionOptions, this);
-  registerHybridSetter("temporalAntiAliasingOptions", &ViewWrapper::setTemporalAntiAliasingOptions, this);
-  registerHybridGetter("screenSpaceRefraction", &ViewWrapper::isScreenSpaceRefractionEnabled, this);
-  registerHybridSetter("screenSpaceRefraction", &ViewWrapper::setScreenSpaceRefractionEnabled, this);
-  registerHybridGetter("postProcessing", &ViewWrapper::isPostProcessingEnabled, this);
-  registerHybridSetter("postProcessing", &ViewWrapper::setPostProcessingEnabled, this);
-  registerHybridGetter("shadowing", &ViewWrapper::isShadowingEnabled, this);
-  registerHybridSetter("shadowing", &ViewWrapper::setShadowingEnabled, this);
-  registerHybridGetter("dithering", &ViewWrapper::getDithering, this);
-  registerHybridSetter("dithering", &ViewWrapper::setDithering, this);
-  registerHybridGetter("antiAliasing", &ViewWrapper::getAntiAliasing, this);
-  registerHybridSetter("antiAliasing", &ViewWrapper::setAntiAliasing, this);
-  registerHybridMethod("projectWorldToScreen", &ViewWrapper::projectWorldToScreen, this);
-  registerHybridMethod("pickEntity", &ViewWrapper::pickEntity, this);
-  registerHybridMethod("getViewport", &ViewWrapper::getViewport, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("getAspectRatio", &ViewWrapper::getAspectRatio);
+  registerHybridMethod("createAmbientOcclusionOptions", &ViewWrapper::createAmbientOcclusionOptions);
+  registerHybridMethod("setAmbientOcclusionOptions", &ViewWrapper::setAmbientOcclusionOptions);
+  registerHybridMethod("getAmbientOcclusionOptions", &ViewWrapper::getAmbientOcclusionOptions);
+  registerHybridMethod("createDynamicResolutionOptions", &ViewWrapper::createDynamicResolutionOptions);
+  registerHybridMethod("setDynamicResolutionOptions", &ViewWrapper::setDynamicResolutionOptions);
+  registerHybridMethod("getDynamicResolutionOptions", &ViewWrapper::getDynamicResolutionOptions);
+  registerHybridSetter("temporalAntiAliasingOptions", &ViewWrapper::setTemporalAntiAliasingOptions);
+  registerHybridGetter("screenSpaceRefraction", &ViewWrapper::isScreenSpaceRefractionEnabled);
+  registerHybridSetter("screenSpaceRefraction", &ViewWrapper::setScreenSpaceRefractionEnabled);
+  registerHybridGetter("postProcessing", &ViewWrapper::isPostProcessingEnabled);
+  registerHybridSetter("postProcessing", &ViewWrapper::setPostProcessingEnabled);
+  registerHybridGetter("shadowing", &ViewWrapper::isShadowingEnabled);
+  registerHybridSetter("shadowing", &ViewWrapper::setShadowingEnabled);
+  registerHybridGetter("dithering", &ViewWrapper::getDithering);
+  registerHybridSetter("dithering", &ViewWrapper::setDithering);
+  registerHybridGetter("antiAliasing", &ViewWrapper::getAntiAliasing);
+  registerHybridSetter("antiAliasing", &ViewWrapper::setAntiAliasing);
+  registerHybridMethod("projectWorldToScreen", &ViewWrapper::projectWorldToScreen);
+  registerHybridMethod("pickEntity", &ViewWrapper::pickEntity);
+  registerHybridMethod("getViewport", &ViewWrapper::getViewport);
 }
 
 double ViewWrapper::getAspectRatio() {
@@ -251,6 +252,7 @@ std::future<std::optional<std::shared_ptr<EntityWrapper>>> ViewWrapper::pickEnti
       std::shared_ptr<EntityWrapper> entityWrapper = std::make_shared<EntityWrapper>(entity);
       promise.set_value(std::optional(entityWrapper));
     }
+    CompletionReactor::notify();
   });
 
   return future;
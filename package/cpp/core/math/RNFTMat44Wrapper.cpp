@@ -5,39 +5,33 @@
 namespace margelo {
 
 void margelo::TMat44Wrapper::loadHybridMethods() {
-  registerHybridGetter("data", &TMat44Wrapper::getMatrixData, this);
-  registerHybridMethod("scaling", &TMat44Wrapper::scaling, this);
-  registerHybridMethod("translate", &TMat44Wrapper::translate, this);
-  registerHybridMethod("rotate", &TMat44Wrapper::rotate, this);
-  registerHybridGetter("scale", &TMat44Wrapper::getScale, this);
-  registerHybridGetter("translation", &TMat44Wrapper::getTranslation, this);
+  registerHybridGetter("data", &TMat44Wrapper::getMatrixData);
+  registerHybridMethod("scaling", &TMat44Wrapper::scaling);
+  registerHybridMethod("translate", &TMat44Wrapper::translate);
+  registerHybridMethod("rotate", &TMat44Wrapper::rotate);
+  registerHybridGetter("scale", &TMat44Wrapper::getScale);
+  registerHybridGetter("translation", &TMat44Wrapper::getTranslation);
 }
 
-std::vector<double> TMat44Wrapper::getMatrixData() {
-  std::vector<double> data;
-  data.reserve(16);
-  const float* array = _matrix.asArray();
-  for (int i = 0; i < 16; i++) {
-    data.push_back((double)array[i]);
-  }
-  return data;
+std::shared_ptr<TypedArray<float>> TMat44Wrapper::getMatrixData() {
+  return std::make_shared<TypedArray<float>>(_matrix.asArray(), 16);
 }
 
-std::shared_ptr<TMat44Wrapper> TMat44Wrapper::scaling(std::vector<double> scale) {
+std::shared_ptr<TMat44Wrapper> TMat44Wrapper::scaling(TypedArrayView<float> scale) {
   math::float3 scaleVec = Converter::VecToFloat3(scale);
   math::mat4f scaleMatrix = math::mat4f::scaling(scaleVec);
   math::mat4f newMatrix = scaleMatrix * _matrix;
   return std::make_shared<TMat44Wrapper>(newMatrix);
 }
 
-std::shared_ptr<TMat44Wrapper> TMat44Wrapper::translate(std::vector<double> translation) {
+std::shared_ptr<TMat44Wrapper> TMat44Wrapper::translate(TypedArrayView<float> translation) {
   math::float3 translateVec = Converter::VecToFloat3(translation);
   math::mat4f translateMatrix = math::mat4f::translation(translateVec);
   math::mat4f newMatrix = translateMatrix * _matrix;
   return std::make_shared<TMat44Wrapper>(newMatrix);
 }
 
-std::shared_ptr<TMat44Wrapper> TMat44Wrapper::rotate(double angleRadians, std::vector<double> axisVec) {
+std::shared_ptr<TMat44Wrapper> TMat44Wrapper::rotate(double angleRadians, TypedArrayView<float> axisVec) {
   math::float3 axis = Converter::VecToFloat3(axisVec);
   if (axis.x == 0 && axis.y == 0 && axis.z == 0) {
     throw std::invalid_argument("Axis cannot be zero");
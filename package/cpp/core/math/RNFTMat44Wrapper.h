@@ -21,13 +21,14 @@ public:
   }
 
 private:
-  std::vector<double> getMatrixData();
+  // Returns the 16 matrix elements (column-major) as a Float32Array
+  std::shared_ptr<TypedArray<float>> getMatrixData();
   // Multiplies the matrix with the provided scale vector
-  std::shared_ptr<TMat44Wrapper> scaling(std::vector<double> scale);
+  std::shared_ptr<TMat44Wrapper> scaling(TypedArrayView<float> scale);
   // Translates the matrix by the provided translation vector
-  std::shared_ptr<TMat44Wrapper> translate(std::vector<double> translation);
+  std::shared_ptr<TMat44Wrapper> translate(TypedArrayView<float> translation);
   // Rotates the matrix by the provided angle in radians around the provided axis
-  std::shared_ptr<TMat44Wrapper> rotate(double angleRadians, std::vector<double> axisVec);
+  std::shared_ptr<TMat44Wrapper> rotate(double angleRadians, TypedArrayView<float> axisVec);
   // Returns the scale of the matrix
   std::vector<double> getScale();
   // Returns the translation of the matrix
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "jsi/RNFTypedArray.h"
 #include <math/vec3.h>
 
 namespace margelo {
@@ -18,6 +19,14 @@ public:
     return math::float3(vec[0], vec[1], vec[2]);
   }
 
+  static math::float3 VecToFloat3(const TypedArrayView<float>& vec) {
+    if (vec.size() != 3) {
+      throw std::invalid_argument("Point must have 3 elements");
+    }
+
+    return math::float3(vec[0], vec[1], vec[2]);
+  }
+
   static std::vector<double> Float3ToVec(const math::float3& vec) {
     return {vec.x, vec.y, vec.z};
   }
@@ -1,7 +1,7 @@
 #include "RNFEntityWrapper.h"
 
 void margelo::EntityWrapper::loadHybridMethods() {
-  registerHybridGetter("id", &EntityWrapper::getId, this);
+  registerHybridGetter("id", &EntityWrapper::getId);
 }
 
 int margelo::EntityWrapper::getId() {
@@ -2,12 +2,13 @@
 
 namespace margelo {
 void ManipulatorWrapper::loadHybridMethods() {
-  registerHybridMethod("grabBegin", &ManipulatorWrapper::grabBegin, this);
-  registerHybridMethod("grabUpdate", &ManipulatorWrapper::grabUpdate, this);
-  registerHybridMethod("grabEnd", &ManipulatorWrapper::grabEnd, this);
-  registerHybridMethod("scroll", &ManipulatorWrapper::scroll, this);
-  registerHybridMethod("update", &ManipulatorWrapper::update, this);
-  registerHybridMethod("getLookAt", &ManipulatorWrapper::getLookAt, this);
+  PointerHolder::loadHybridMethods();
+  registerHybridMethod("grabBegin", &ManipulatorWrapper::grabBegin);
+  registerHybridMethod("grabUpdate", &ManipulatorWrapper::grabUpdate);
+  registerHybridMethod("grabEnd", &ManipulatorWrapper::grabEnd);
+  registerHybridMethod("scroll", &ManipulatorWrapper::scroll);
+  registerHybridMethod("update", &ManipulatorWrapper::update);
+  registerHybridMethod("getLookAt", &ManipulatorWrapper::getLookAt);
 }
 
 void ManipulatorWrapper::grabBegin(float x, float y, bool strafe) {
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "RNFHybridPropertyTable.h"
+#include "RNFRuntimeCache.h"
+#include <array>
+#include <atomic>
+#include <jsi/jsi.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace margelo {
+
+using namespace facebook;
+
+/**
+ * Caches the `jsi::Function`s of Hybrid Methods per `jsi::Runtime`, indexed by the property id of the HybridPropertyTable,
+ * as well as the most recently looked up property names as `jsi::PropNameID`s.
+ *
+ * Looking up the functions of an already known runtime is lock-free: The first few runtimes get a fixed slot that
+ * is published with an atomic store, only further runtimes fall back to a mutex-guarded map.
+ * A `jsi::Runtime` is single-threaded, so the returned entry itself can be accessed without locking.
+ * The entry of a runtime is dropped once that runtime gets destroyed.
+ */
+class HybridFunctionCache : public RuntimeLifecycleListener {
+public:
+  struct Entry {
+    Entry(jsi::Runtime& runtime, const HybridPropertyTable& propertyTable)
+        : functions(propertyTable.size()), toStringName(jsi::PropNameID::forAscii(runtime, "toString")) {
+      recentNames.reserve(MAX_RECENT_NAMES);
+      recentProperties.reserve(MAX_RECENT_NAMES);
+    }
+
+    // Created on first access of each method
+    std::vector<std::shared_ptr<jsi::Function>> functions;
+    // The last looked up names and what they resolved to (nullptr if the class has no such property).
+    // Incoming names are compared to these first, and only converted to a string and hashed if none of them matches.
+    std::vector<jsi::PropNameID> recentNames;
+    std::vector<const HybridPropertyTable::Property*> recentProperties;
+    // The slot that is replaced next once all recent names are taken
+    size_t nextRecentSlot = 0;
+    jsi::PropNameID toStringName;
+  };
+
+  static constexpr size_t MAX_RECENT_NAMES = 8;
+
+  HybridFunctionCache() = default;
+  HybridFunctionCache(const HybridFunctionCache&) = delete;
+  HybridFunctionCache& operator=(const HybridFunctionCache&) = delete;
+
+  ~HybridFunctionCache() {
+    for (size_t i = 0; i < MAX_FAST_RUNTIMES; i++) {
+      jsi::Runtime* runtime = _runtimes[i].load(std::memory_order_acquire);
+      if (runtime != nullptr) {
+        RuntimeLifecycleMonitor::removeListener(*runtime, this);
+      }
+      delete _entries[i];
+    }
+    for (auto& overflow : _overflow) {
+      RuntimeLifecycleMonitor::removeListener(*overflow.first, this);
+    }
+  }
+
+  /**
+   * Get the cache entry for the given runtime, creating it for the properties of `propertyTable` on first access.
+   */
+  inline Entry& get(jsi::Runtime& runtime, const HybridPropertyTable& propertyTable) {
+    for (size_t i = 0; i < MAX_FAST_RUNTIMES; i++) {
+      if (_runtimes[i].load(std::memory_order_acquire) == &runtime) {
+        [[likely]];
+        return *_entries[i];
+      }
+    }
+    return insert(runtime, propertyTable);
+  }
+
+  void onRuntimeDestroyed(jsi::Runtime* runtime) override {
+    remove(runtime);
+  }
+
+  /**
+   * Drops the cache entry of the given runtime. Must only be called when the runtime is no longer used.
+   */
+  void remove(jsi::Runtime* runtime) {
+    std::unique_lock lock(_mutex);
+    for (size_t i = 0; i < MAX_FAST_RUNTIMES; i++) {
+      if (_runtimes[i].load(std::memory_order_relaxed) == runtime) {
+        _runtimes[i].store(nullptr, std::memory_order_release);
+        delete _entries[i];
+        _entries[i] = nullptr;
+        return;
+      }
+    }
+    _overflow.erase(runtime);
+  }
+
+private:
+  Entry& insert(jsi::Runtime& runtime, const HybridPropertyTable& propertyTable) {
+    {
+      std::unique_lock lock(_mutex);
+      auto overflow = _overflow.find(&runtime);
+      if (overflow != _overflow.end()) {
+        return *overflow->second;
+      }
+    }
+
+    // First access from this runtime. Only this runtime's thread can insert it, so nobody else can race us here.
+    RuntimeLifecycleMonitor::addListener(runtime, this);
+    auto entry = std::make_unique<Entry>(runtime, propertyTable);
+
+    std::unique_lock lock(_mutex);
+    for (size_t i = 0; i < MAX_FAST_RUNTIMES; i++) {
+      if (_runtimes[i].load(std::memory_order_relaxed) == nullptr) {
+        _entries[i] = entry.release();
+        _runtimes[i].store(&runtime, std::memory_order_release);
+        return *_entries[i];
+      }
+    }
+    return *_overflow.emplace(&runtime, std::move(entry)).first->second;
+  }
+
+private:
+  static constexpr size_t MAX_FAST_RUNTIMES = 4;
+  std::array<std::atomic<jsi::Runtime*>, MAX_FAST_RUNTIMES> _runtimes{};
+  std::array<Entry*, MAX_FAST_RUNTIMES> _entries{};
+  std::mutex _mutex;
+  std::unordered_map<jsi::Runtime*, std::unique_ptr<Entry>> _overflow;
+};
+
+} // namespace margelo
@@ -5,6 +5,7 @@
 #include "RNFHybridObject.h"
 #include "RNFJSIConverter.h"
 #include "RNFLogger.h"
+#include <typeindex>
 
 namespace margelo {
 
@@ -33,68 +34,87 @@ HybridObject::~HybridObject() {
 #if DEBUG && RNF_ENABLE_LOGS
   Logger::log(TAG, "(MEMORY) Deleting %s (#%i)... ❌", _name, _instanceId);
 #endif
-  _functionCache.clear();
 }
 
+std::atomic<size_t> HybridObject::_propertyNameConversionsCount = 0;
+
 std::string HybridObject::toString(jsi::Runtime& runtime) {
   std::string result = std::string(_name) + " { ";
   std::vector<jsi::PropNameID> props = getPropertyNames(runtime);
   for (size_t i = 0; i < props.size(); i++) {
     auto suffix = i < props.size() - 1 ? ", " : " ";
-    result += "\"" + props[i].utf8(runtime) + "\"" + suffix;
+    result += "\"" + toUtf8(runtime, props[i]) + "\"" + suffix;
   }
   return result + "}";
 }
 
-std::vector<jsi::PropNameID> HybridObject::getPropertyNames(facebook::jsi::Runtime& runtime) {
-  std::unique_lock lock(_mutex);
-  ensureInitialized(runtime);
+std::string HybridObject::toUtf8(jsi::Runtime& runtime, const jsi::PropNameID& propName) {
+  _propertyNameConversionsCount.fetch_add(1, std::memory_order_relaxed);
+  return propName.utf8(runtime);
+}
 
-  std::vector<jsi::PropNameID> result;
-  size_t totalSize = _methods.size() + _getters.size() + _setters.size();
-  result.reserve(totalSize);
+size_t HybridObject::getPropertyNameConversionsCount() {
+  return _propertyNameConversionsCount.load(std::memory_order_relaxed);
+}
 
-  for (const auto& item : _methods) {
-    result.push_back(jsi::PropNameID::forUtf8(runtime, item.first));
+const HybridPropertyTable::Property* HybridObject::findProperty(jsi::Runtime& runtime, const Prototype& prototype,
+                                                                HybridFunctionCache::Entry& cache, const jsi::PropNameID& propName) {
+  // Comparing PropNameIDs is a symbol comparison in the runtime, converting the name to a string would allocate on every access.
+  // So names that were looked up recently (e.g. in a loop) are only compared, and everything else goes through the hash index once.
+  for (size_t i = 0; i < cache.recentNames.size(); i++) {
+    if (jsi::PropNameID::compare(runtime, cache.recentNames[i], propName)) {
+      [[likely]];
+      return cache.recentProperties[i];
+    }
   }
-  for (const auto& item : _getters) {
-    result.push_back(jsi::PropNameID::forUtf8(runtime, item.first));
+
+  const HybridPropertyTable::Property* property = prototype.propertyTable.find(toUtf8(runtime, propName));
+  if (cache.recentNames.size() < HybridFunctionCache::MAX_RECENT_NAMES) {
+    cache.recentNames.push_back(jsi::PropNameID(runtime, propName));
+    cache.recentProperties.push_back(property);
+  } else {
+    cache.recentNames[cache.nextRecentSlot] = jsi::PropNameID(runtime, propName);
+    cache.recentProperties[cache.nextRecentSlot] = property;
+    cache.nextRecentSlot = (cache.nextRecentSlot + 1) % HybridFunctionCache::MAX_RECENT_NAMES;
   }
-  for (const auto& item : _setters) {
-    result.push_back(jsi::PropNameID::forUtf8(runtime, item.first));
+  return property;
+}
+
+std::vector<jsi::PropNameID> HybridObject::getPropertyNames(facebook::jsi::Runtime& runtime) {
+  const HybridPropertyTable& propertyTable = ensureInitialized().propertyTable;
+
+  std::vector<jsi::PropNameID> result;
+  result.reserve(propertyTable.size());
+  for (const auto& property : propertyTable.getProperties()) {
+    result.push_back(jsi::PropNameID::forUtf8(runtime, property.name));
   }
   return result;
 }
 
 jsi::Value HybridObject::get(facebook::jsi::Runtime& runtime, const facebook::jsi::PropNameID& propName) {
-  std::unique_lock lock(_mutex);
-  ensureInitialized(runtime);
+  Prototype& prototype = ensureInitialized();
+  HybridFunctionCache::Entry& cache = prototype.functionCache.get(runtime, prototype.propertyTable);
+  const HybridPropertyTable::Property* property = findProperty(runtime, prototype, cache, propName);
 
-  std::string name = propName.utf8(runtime);
-  auto& functionCache = _functionCache[&runtime];
-
-  if (_getters.count(name) > 0) {
-    // it's a property getter
-    return _getters[name](runtime, jsi::Value::undefined(), nullptr, 0);
-  }
-
-  if (functionCache.count(name) > 0) {
+  if (property != nullptr) {
     [[likely]];
-    // cache hit
-    return jsi::Value(runtime, *functionCache[name]);
+    if (property->getter) {
+      // it's a property getter
+      return property->getter(*this, runtime, jsi::Value::undefined(), nullptr, 0);
+    }
+
+    if (property->method) {
+      // Methods are shared by all instances of this class, so this is only a miss once per class per runtime.
+      std::shared_ptr<jsi::Function>& cachedFunction = cache.functions[property->id];
+      if (cachedFunction == nullptr) {
+        [[unlikely]];
+        cachedFunction = JSIHelper::createSharedJsiFunction(runtime, createPrototypeMethod(runtime, &prototype, property));
+      }
+      return jsi::Value(runtime, *cachedFunction);
+    }
   }
 
-  if (_methods.count(name) > 0) {
-    // cache miss - create jsi::Function and cache it.
-    HybridFunction& hybridFunction = _methods.at(name);
-    jsi::Function function = jsi::Function::createFromHostFunction(runtime, jsi::PropNameID::forUtf8(runtime, name),
-                                                                   hybridFunction.parameterCount, hybridFunction.function);
-
-    functionCache[name] = JSIHelper::createSharedJsiFunction(runtime, std::move(function));
-    return jsi::Value(runtime, *functionCache[name]);
-  }
-
-  if (name == "toString") {
+  if (jsi::PropNameID::compare(runtime, propName, cache.toStringName)) {
     return jsi::Function::createFromHostFunction(
         runtime, jsi::PropNameID::forUtf8(runtime, "toString"), 0,
         [=](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
@@ -107,36 +127,92 @@ jsi::Value HybridObject::get(facebook::jsi::Runtime& runtime, const facebook::js
 }
 
 void HybridObject::set(facebook::jsi::Runtime& runtime, const facebook::jsi::PropNameID& propName, const facebook::jsi::Value& value) {
-  std::unique_lock lock(_mutex);
-  ensureInitialized(runtime);
-
-  std::string name = propName.utf8(runtime);
+  Prototype& prototype = ensureInitialized();
+  HybridFunctionCache::Entry& cache = prototype.functionCache.get(runtime, prototype.propertyTable);
+  const HybridPropertyTable::Property* property = findProperty(runtime, prototype, cache, propName);
 
-  if (_setters.count(name) > 0) {
+  if (property != nullptr && property->setter) {
     // Call setter
-    _setters[name](runtime, jsi::Value::undefined(), &value, 1);
+    property->setter(*this, runtime, jsi::Value::undefined(), &value, 1);
     return;
   }
 
   HostObject::set(runtime, propName, value);
 }
 
-void HybridObject::ensureInitialized(facebook::jsi::Runtime& runtime) {
-  if (!_didLoadMethods) {
+jsi::Function HybridObject::createPrototypeMethod(jsi::Runtime& runtime, const Prototype* prototype,
+                                                  const HybridPropertyTable::Property* property) {
+  return jsi::Function::createFromHostFunction(
+      runtime, jsi::PropNameID::forUtf8(runtime, property->name), property->parameterCount,
+      [prototype, property](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* args, size_t count) -> jsi::Value {
+        // The function is shared by all instances, so the instance is whatever it has been called on.
+        std::shared_ptr<HybridObject> hybridObject = nullptr;
+        if (thisValue.isObject()) {
+          jsi::Object thisObject = thisValue.getObject(runtime);
+          if (thisObject.isHostObject(runtime)) {
+            hybridObject = std::dynamic_pointer_cast<HybridObject>(thisObject.getHostObject(runtime));
+          }
+        }
+        if (hybridObject == nullptr || &hybridObject->ensureInitialized() != prototype) {
+          [[unlikely]];
+          throw std::runtime_error("Cannot call " + std::string(prototype->propertyTable.getName()) + "." + property->name +
+                                   "(...) - `this` is not a " + prototype->propertyTable.getName() +
+                                   "! Make sure to call it on the object, and to not pass the method around unbound.");
+        }
+        return property->method(*hybridObject, runtime, thisValue, args, count);
+      });
+}
+
+HybridObject::Prototype& HybridObject::ensureInitialized() {
+  Prototype* prototype = _prototype.load(std::memory_order_acquire);
+  if (prototype == nullptr) {
     [[unlikely]];
-    _creationRuntime = &runtime;
-    // lazy-load all exposed methods
+    // Racing threads will all get the same Prototype for this class.
+    prototype = loadPrototype();
+    _prototype.store(prototype, std::memory_order_release);
+  }
+  return *prototype;
+}
+
+static thread_local HybridPropertyTable* pendingPropertyTable = nullptr;
+
+HybridObject::Prototype* HybridObject::loadPrototype() {
+  // All instances of the same class register the same methods, so we only call loadHybridMethods() once per class.
+  // Prototypes are never destroyed, so they can be referenced from instances and jsi::Functions without ownership.
+  static std::mutex registryMutex;
+  static std::unordered_map<std::type_index, std::unique_ptr<Prototype>> registry;
+
+  std::unique_lock lock(registryMutex);
+  std::type_index type = std::type_index(typeid(*this));
+  auto existing = registry.find(type);
+  if (existing != registry.end()) {
+    [[likely]];
+    return existing->second.get();
+  }
+
+  auto prototype = std::make_unique<Prototype>(_name);
+  pendingPropertyTable = &prototype->propertyTable;
+  try {
     loadHybridMethods();
-    _didLoadMethods = true;
+  } catch (...) {
+    pendingPropertyTable = nullptr;
+    throw;
   }
+  pendingPropertyTable = nullptr;
+  prototype->propertyTable.seal();
+
+  Prototype* result = prototype.get();
+  registry.emplace(type, std::move(prototype));
+  return result;
 }
 
-bool HybridObject::isRuntimeAlive() {
-  if (_creationRuntime == nullptr) {
+HybridPropertyTable& HybridObject::getPendingPropertyTable(const std::string& name) {
+  if (pendingPropertyTable == nullptr) {
     [[unlikely]];
-    return false;
+    throw std::runtime_error("Cannot add Hybrid Property \"" + name +
+                             "\" - Hybrid Properties can only be registered inside loadHybridMethods()!");
   }
-  return RNFWorkletRuntimeRegistry::isRuntimeAlive(_creationRuntime);
+  return *pendingPropertyTable;
 }
 
 } // namespace margelo
@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include "RNFHybridFunctionCache.h"
+#include "RNFHybridPropertyTable.h"
 #include "RNFJSIConverter.h"
 #include "RNFLogger.h"
 #include "jsi/RNFWorkletRuntimeRegistry.h"
+#include <atomic>
 #include <functional>
 #include <jsi/jsi.h>
 #include <memory>
@@ -20,10 +23,7 @@ using namespace facebook;
 
 class HybridObject : public jsi::HostObject, public std::enable_shared_from_this<HybridObject> {
 public:
-  struct HybridFunction {
-    jsi::HostFunctionType function;
-    size_t parameterCount;
-  };
+  using HybridFunction = HybridPropertyTable::HybridFunction;
 
 public:
   explicit HybridObject(const char* name);
@@ -43,6 +43,8 @@ public:
 
   /**
    * Loads all native methods of this `HybridObject` to be exposed to JavaScript.
+   * This is only called once per class, the registered methods are shared between all instances of that class -
+   * so registrations must not depend on the state of the instance.
    * Example:
    *
    * ```cpp
@@ -51,7 +53,7 @@ public:
    * }
    *
    * void User::loadHybridMethods() {
-   *   registerHybridMethod("getAge", &User::getAge, this);
+   *   registerHybridMethod("getAge", &User::getAge);
    * }
    * ```
    */
@@ -62,21 +64,40 @@ public:
    */
   virtual std::string toString(jsi::Runtime& runtime);
 
+  /**
+   * How often a property name was converted to a `std::string` (which allocates) by any HybridObject. Property lookups in
+   * `get` and `set` compare names without converting them, so accessing properties doesn't change this. Used in tests.
+   */
+  static size_t getPropertyNameConversionsCount();
+
+private:
+  /**
+   * Everything that is shared between all instances of one HybridObject class: The registered properties,
+   * and per runtime one `jsi::Function` for each method and the property names. Method functions resolve their instance from `this`.
+   */
+  struct Prototype {
+    explicit Prototype(const char* name) : propertyTable(name) {}
+    HybridPropertyTable propertyTable;
+    HybridFunctionCache functionCache;
+  };
+
 private:
   static constexpr auto TAG = "HybridObject";
   const char* _name = TAG;
   int _instanceId = 1;
-  bool _didLoadMethods = false;
-  std::mutex _mutex;
-  std::unordered_map<std::string, HybridFunction> _methods;
-  std::unordered_map<std::string, jsi::HostFunctionType> _getters;
-  std::unordered_map<std::string, jsi::HostFunctionType> _setters;
-  std::unordered_map<jsi::Runtime*, std::unordered_map<std::string, std::shared_ptr<jsi::Function>>> _functionCache;
-  // Store a pointer to the runtime. Needed for checking if the runtime is still active, see WorkletRuntimeRegistry.
-  jsi::Runtime* _creationRuntime = nullptr;
+  // Shared by all instances of the same class, set on first access.
+  std::atomic<Prototype*> _prototype = nullptr;
+  static std::atomic<size_t> _propertyNameConversionsCount;
 
 private:
-  inline void ensureInitialized(facebook::jsi::Runtime& runtime);
+  inline Prototype& ensureInitialized();
+  Prototype* loadPrototype();
+  static HybridPropertyTable& getPendingPropertyTable(const std::string& name);
+  static const HybridPropertyTable::Property* findProperty(jsi::Runtime& runtime, const Prototype& prototype,
+                                                           HybridFunctionCache::Entry& cache, const jsi::PropNameID& propName);
+  static std::string toUtf8(jsi::Runtime& runtime, const jsi::PropNameID& propName);
+  static jsi::Function createPrototypeMethod(jsi::Runtime& runtime, const Prototype* prototype,
+                                             const HybridPropertyTable::Property* property);
 
 private:
   template <typename Derived, typename ReturnType, typename... Args, size_t... Is>
@@ -94,9 +115,11 @@ private:
   }
 
   template <typename Derived, typename ReturnType, typename... Args>
-  static jsi::HostFunctionType createHybridMethod(ReturnType (Derived::*method)(Args...), Derived* derivedInstance) {
-
-    return [derivedInstance, method](jsi::Runtime& runtime, const jsi::Value& thisVal, const jsi::Value* args, size_t count) -> jsi::Value {
+  static HybridFunction createHybridMethod(ReturnType (Derived::*method)(Args...)) {
+    // The method is bound per call instead of per instance, so one HybridFunction can serve every instance of Derived.
+    return [method](HybridObject& hybridObject, jsi::Runtime& runtime, const jsi::Value& thisVal, const jsi::Value* args,
+                    size_t count) -> jsi::Value {
+      Derived* derivedInstance = static_cast<Derived*>(&hybridObject);
       if constexpr (std::is_same_v<ReturnType, jsi::Value>) {
         // If the return type is a jsi::Value, we assume the user wants full JSI code control.
         // The signature must be identical to jsi::HostFunction (jsi::Runtime&, jsi::Value& this, ...)
@@ -111,47 +134,18 @@ private:
 
 protected:
   template <typename Derived, typename ReturnType, typename... Args>
-  void registerHybridMethod(std::string name, ReturnType (Derived::*method)(Args...), Derived* derivedInstance, bool override = false) {
-    if (!override && (_getters.count(name) > 0 || _setters.count(name) > 0)) {
-      [[unlikely]];
-      throw std::runtime_error("Cannot add Hybrid Method \"" + name + "\" - a property with that name already exists!");
-    }
-    if (!override && (_methods.count(name) > 0)) {
-      throw std::runtime_error("Cannot add Hybrid Method \"" + name + "\" - a method with that name already exists!");
-    }
-
-    _methods[name] = HybridFunction{.function = createHybridMethod(method, derivedInstance), .parameterCount = sizeof...(Args)};
+  void registerHybridMethod(std::string name, ReturnType (Derived::*method)(Args...), bool override = false) {
+    getPendingPropertyTable(name).addMethod(name, createHybridMethod(method), sizeof...(Args), override);
   }
 
-  template <typename Derived, typename ReturnType>
-  void registerHybridGetter(std::string name, ReturnType (Derived::*method)(), Derived* derivedInstance) {
-    if (_getters.count(name) > 0) {
-      [[unlikely]];
-      throw std::runtime_error("Cannot add Hybrid Property Getter \"" + name + "\" - a getter with that name already exists!");
-    }
-    if (_methods.count(name) > 0) {
-      [[unlikely]];
-      throw std::runtime_error("Cannot add Hybrid Property Getter \"" + name + "\" - a method with that name already exists!");
-    }
-
-    _getters[name] = createHybridMethod(method, derivedInstance);
+  template <typename Derived, typename ReturnType> void registerHybridGetter(std::string name, ReturnType (Derived::*method)()) {
+    getPendingPropertyTable(name).addGetter(name, createHybridMethod(method));
   }
 
-  template <typename Derived, typename ValueType>
-  void registerHybridSetter(std::string name, void (Derived::*method)(ValueType), Derived* derivedInstance) {
-    if (_setters.count(name) > 0) {
-      [[unlikely]];
-      throw std::runtime_error("Cannot add Hybrid Property Setter \"" + name + "\" - a setter with that name already exists!");
-    }
-    if (_methods.count(name) > 0) {
-      [[unlikely]];
-      throw std::runtime_error("Cannot add Hybrid Property Setter \"" + name + "\" - a method with that name already exists!");
-    }
-
-    _setters[name] = createHybridMethod(method, derivedInstance);
+  template <typename Derived, typename ValueType> void registerHybridSetter(std::string name, void (Derived::*method)(ValueType)) {
+    getPendingPropertyTable(name).addSetter(name, createHybridMethod(method));
   }
 
-  bool isRuntimeAlive();
 };
 
 } // namespace margelo
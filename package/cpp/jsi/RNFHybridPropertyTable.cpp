@@ -0,0 +1,128 @@
+#include "RNFHybridPropertyTable.h"
+
+namespace margelo {
+
+HybridPropertyTable::HybridPropertyTable(const char* name) : _name(name) {
+  rebuildIndex(4);
+}
+
+uint32_t HybridPropertyTable::hash(std::string_view name) noexcept {
+  // FNV-1a - property names are short, so this is faster than std::hash.
+  uint32_t hash = 2166136261u;
+  for (char c : name) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+HybridPropertyTable::Property* HybridPropertyTable::findUnsealed(const std::string& name) {
+  return const_cast<Property*>(find(name));
+}
+
+HybridPropertyTable::Property& HybridPropertyTable::getOrCreate(const std::string& name) {
+  if (_isSealed) {
+    [[unlikely]];
+    throw std::runtime_error("Cannot add Hybrid Property \"" + name + "\" to " + _name +
+                             " - Hybrid Properties can only be registered inside loadHybridMethods()!");
+  }
+  Property* existing = findUnsealed(name);
+  if (existing != nullptr) {
+    return *existing;
+  }
+  _properties.push_back(Property{.name = name, .id = _properties.size()});
+  addToIndex(_properties.back().id);
+  return _properties.back();
+}
+
+void HybridPropertyTable::addMethod(const std::string& name, HybridFunction&& method, size_t parameterCount, bool override) {
+  Property* existing = findUnsealed(name);
+  if (!override && existing != nullptr && (existing->getter || existing->setter)) {
+    [[unlikely]];
+    throw std::runtime_error("Cannot add Hybrid Method \"" + name + "\" - a property with that name already exists!");
+  }
+  if (!override && existing != nullptr && existing->method) {
+    throw std::runtime_error("Cannot add Hybrid Method \"" + name + "\" - a method with that name already exists!");
+  }
+
+  Property& property = getOrCreate(name);
+  property.method = std::move(method);
+  property.parameterCount = parameterCount;
+}
+
+void HybridPropertyTable::addGetter(const std::string& name, HybridFunction&& getter) {
+  Property* existing = findUnsealed(name);
+  if (existing != nullptr && existing->getter) {
+    [[unlikely]];
+    throw std::runtime_error("Cannot add Hybrid Property Getter \"" + name + "\" - a getter with that name already exists!");
+  }
+  if (existing != nullptr && existing->method) {
+    [[unlikely]];
+    throw std::runtime_error("Cannot add Hybrid Property Getter \"" + name + "\" - a method with that name already exists!");
+  }
+
+  getOrCreate(name).getter = std::move(getter);
+}
+
+void HybridPropertyTable::addSetter(const std::string& name, HybridFunction&& setter) {
+  Property* existing = findUnsealed(name);
+  if (existing != nullptr && existing->setter) {
+    [[unlikely]];
+    throw std::runtime_error("Cannot add Hybrid Property Setter \"" + name + "\" - a setter with that name already exists!");
+  }
+  if (existing != nullptr && existing->method) {
+    [[unlikely]];
+    throw std::runtime_error("Cannot add Hybrid Property Setter \"" + name + "\" - a method with that name already exists!");
+  }
+
+  getOrCreate(name).setter = std::move(setter);
+}
+
+void HybridPropertyTable::seal() {
+  _isSealed = true;
+}
+
+void HybridPropertyTable::addToIndex(size_t id) {
+  _hashes.push_back(hash(_properties[id].name));
+  // Keep the load factor at or below 50% so probe sequences stay short.
+  if (_properties.size() * 2 > _slots.size()) {
+    rebuildIndex(_slots.size() * 2);
+    return;
+  }
+  size_t slot = _hashes[id] & _mask;
+  while (_slots[slot] != 0) {
+    slot = (slot + 1) & _mask;
+  }
+  _slots[slot] = static_cast<uint32_t>(id + 1);
+}
+
+void HybridPropertyTable::rebuildIndex(size_t capacity) {
+  _mask = capacity - 1;
+  _slots.assign(capacity, 0);
+  for (const Property& property : _properties) {
+    size_t slot = _hashes[property.id] & _mask;
+    while (_slots[slot] != 0) {
+      slot = (slot + 1) & _mask;
+    }
+    _slots[slot] = static_cast<uint32_t>(property.id + 1);
+  }
+}
+
+const HybridPropertyTable::Property* HybridPropertyTable::find(std::string_view name) const noexcept {
+  uint32_t nameHash = hash(name);
+  size_t slot = nameHash & _mask;
+  while (true) {
+    uint32_t entry = _slots[slot];
+    if (entry == 0) {
+      return nullptr;
+    }
+    size_t id = entry - 1;
+    if (_hashes[id] == nameHash && _properties[id].name == name) {
+      [[likely]];
+      return &_properties[id];
+    }
+    slot = (slot + 1) & _mask;
+  }
+}
+
+} // namespace margelo
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <functional>
+#include <jsi/jsi.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace margelo {
+
+using namespace facebook;
+
+class HybridObject;
+
+/**
+ * An immutable lookup table of all methods, getters and setters of one `HybridObject` class.
+ *
+ * The table is built once per class (on first property access of its first instance) and then shared by all instances.
+ * After `seal()` it is never mutated again, so lookups are safe from any thread without locking.
+ * Every property name is interned to a dense id, which can be used to index per-property caches (like the functions of
+ * each runtime, see HybridFunctionCache). Names are found through an open-addressed hash index.
+ */
+class HybridPropertyTable {
+public:
+  using HybridFunction =
+      std::function<jsi::Value(HybridObject& hybridObject, jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* args,
+                               size_t count)>;
+
+  struct Property {
+    std::string name;
+    size_t id;
+    HybridFunction method;
+    size_t parameterCount = 0;
+    HybridFunction getter;
+    HybridFunction setter;
+  };
+
+public:
+  explicit HybridPropertyTable(const char* name);
+
+  void addMethod(const std::string& name, HybridFunction&& method, size_t parameterCount, bool override);
+  void addGetter(const std::string& name, HybridFunction&& getter);
+  void addSetter(const std::string& name, HybridFunction&& setter);
+
+  /**
+   * No more properties can be added after this.
+   */
+  void seal();
+
+  /**
+   * Finds the property with the given name, or returns `nullptr` if this class does not have such a property.
+   */
+  const Property* find(std::string_view name) const noexcept;
+
+  const std::vector<Property>& getProperties() const noexcept {
+    return _properties;
+  }
+  size_t size() const noexcept {
+    return _properties.size();
+  }
+  const char* getName() const noexcept {
+    return _name;
+  }
+
+private:
+  Property& getOrCreate(const std::string& name);
+  Property* findUnsealed(const std::string& name);
+  void addToIndex(size_t id);
+  void rebuildIndex(size_t capacity);
+  static uint32_t hash(std::string_view name) noexcept;
+
+private:
+  const char* _name;
+  bool _isSealed = false;
+  std::vector<Property> _properties;
+  // Open-addressed index into _properties (id + 1, 0 = empty slot), size is always a power of two.
+  std::vector<uint32_t> _slots;
+  std::vector<uint32_t> _hashes;
+  size_t _mask = 0;
+};
+
+} // namespace margelo
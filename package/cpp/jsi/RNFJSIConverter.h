@@ -9,7 +9,9 @@
 #include "RNFJSIHelper.h"
 #include "RNFPromise.h"
 #include "RNFPromiseFactory.h"
+#include "RNFTypedArray.h"
 #include "RNFWorkletRuntimeRegistry.h"
+#include "threading/RNFCompletionReactor.h"
 #include "threading/RNFDispatcher.h"
 #include <array>
 #include <future>
@@ -51,6 +53,16 @@ template <> struct JSIConverter<int> {
   }
 };
 
+// uint8_t <> number, for byte arrays
+template <> struct JSIConverter<uint8_t> {
+  static uint8_t fromJSI(jsi::Runtime&, const jsi::Value& arg) {
+    return static_cast<uint8_t>(arg.asNumber());
+  }
+  static jsi::Value toJSI(jsi::Runtime&, uint8_t arg) {
+    return jsi::Value(static_cast<int>(arg));
+  }
+};
+
 // double <> number
 template <> struct JSIConverter<double> {
   static double fromJSI(jsi::Runtime&, const jsi::Value& arg) {
@@ -154,47 +166,55 @@ template <typename TResult> struct JSIConverter<std::future<TResult>> {
     return PromiseFactory::createPromise(runtime, [sharedFuture = std::move(sharedFuture)](jsi::Runtime& runtime,
                                                                                            std::shared_ptr<Promise> promise,
                                                                                            std::shared_ptr<Dispatcher> dispatcher) {
-      // Spawn new async thread to wait for the result
-      std::thread waiterThread([promise, &runtime, dispatcher, sharedFuture = std::move(sharedFuture)]() {
-        // wait until the future completes. we are running on a background task here.
-        sharedFuture->wait();
-
-        // the async function completed successfully, resolve the promise on JS Thread
-        dispatcher->runAsync([&runtime, promise, sharedFuture]() mutable {
-          try {
-            if constexpr (std::is_same_v<TResult, void>) {
-              // it's returning void, just return undefined to JS
-              sharedFuture->get();
-              promise->resolve(jsi::Value::undefined());
-            } else {
-              // it's returning a custom type, convert it to a jsi::Value
-              TResult result = sharedFuture->get();
-              jsi::Value jsResult = JSIConverter<TResult>::toJSI(runtime, result);
-              promise->resolve(std::move(jsResult));
-            }
-          } catch (const std::exception& exception) {
-            // the async function threw an error, reject the promise on JS Thread
-            std::string what = exception.what();
-            promise->reject(what);
-          } catch (...) {
-            // the async function threw a non-std error, try getting it
-#if __has_include(<cxxabi.h>)
-            std::string name = __cxxabiv1::__cxa_current_exception_type()->name();
-#else
-                std::string name = "<unknown>";
-#endif
-            promise->reject("Unknown non-std exception: " + name);
-          }
+      if (sharedFuture->wait_for(std::chrono::seconds(0)) != std::future_status::timeout) {
+        // the future already completed, we don't need to wait for it.
+        dispatcher->runAsync([&runtime, promise = std::move(promise), sharedFuture]() mutable {
+          resolvePromise(runtime, std::move(promise), sharedFuture);
+        });
+        return;
+      }
 
-          // This lambda owns the promise shared pointer, and we need to call its
-          // destructor on the correct thread here - otherwise it might be called
-          // from the waiterThread.
-          promise = nullptr;
+      // wait until the future completes. The shared CompletionReactor waits for all pending futures on one background Thread.
+      CompletionReactor::getShared().watch(sharedFuture, [&runtime, promise = std::move(promise), dispatcher, sharedFuture]() mutable {
+        // the async function completed, resolve the promise on JS Thread.
+        // The promise is moved, so it is only ever released on the JS Thread, never on the reactor Thread.
+        dispatcher->runAsync([&runtime, promise = std::move(promise), sharedFuture]() mutable {
+          resolvePromise(runtime, std::move(promise), sharedFuture);
         });
       });
-      waiterThread.detach();
     });
   }
+
+private:
+  static void resolvePromise(jsi::Runtime& runtime, std::shared_ptr<Promise>&& promise, const std::shared_ptr<std::future<TResult>>& future) {
+    try {
+      if constexpr (std::is_same_v<TResult, void>) {
+        // it's returning void, just return undefined to JS
+        future->get();
+        promise->resolve(jsi::Value::undefined());
+      } else {
+        // it's returning a custom type, convert it to a jsi::Value
+        TResult result = future->get();
+        jsi::Value jsResult = JSIConverter<TResult>::toJSI(runtime, result);
+        promise->resolve(std::move(jsResult));
+      }
+    } catch (const std::exception& exception) {
+      // the async function threw an error, reject the promise on JS Thread
+      std::string what = exception.what();
+      promise->reject(what);
+    } catch (...) {
+      // the async function threw a non-std error, try getting it
+#if __has_include(<cxxabi.h>)
+      std::string name = __cxxabiv1::__cxa_current_exception_type()->name();
+#else
+      std::string name = "<unknown>";
+#endif
+      promise->reject("Unknown non-std exception: " + name);
+    }
+
+    // We own the promise shared pointer, and we need to call its destructor on the JS thread here.
+    promise = nullptr;
+  }
 };
 
 // [](Args...) -> T {} <> (Args...) => T
@@ -266,6 +286,69 @@ template <typename ElementType> struct JSIConverter<std::vector<ElementType>> {
   }
 };
 
+// TypedArrayView<T> <> Float32Array, Float64Array, ... (zero-copy), ArrayBuffer (zero-copy) or T[] (copy)
+template <typename ElementType> struct JSIConverter<TypedArrayView<ElementType>> {
+  static TypedArrayView<ElementType> fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+    jsi::Object object = arg.asObject(runtime);
+    if (object.isArray(runtime)) {
+      // It's a plain JS array, we need to convert every element.
+      return TypedArrayView<ElementType>(JSIConverter<std::vector<ElementType>>::fromJSI(runtime, arg));
+    }
+    if (object.isArrayBuffer(runtime)) {
+      jsi::ArrayBuffer arrayBuffer = object.getArrayBuffer(runtime);
+      return createView(runtime, arrayBuffer, 0, arrayBuffer.size(runtime));
+    }
+
+    // It's a TypedArray (or DataView), which is a view into an ArrayBuffer.
+    jsi::Value buffer = object.getProperty(runtime, "buffer");
+    if (!buffer.isObject() || !buffer.getObject(runtime).isArrayBuffer(runtime)) {
+      [[unlikely]];
+      throw std::runtime_error("Cannot convert \"" + arg.toString(runtime).utf8(runtime) + "\" to a " +
+                               TypedArrayTraits<ElementType>::name + " - it is not a TypedArray, ArrayBuffer or Array!");
+    }
+#if DEBUG
+    jsi::Value bytesPerElement = object.getProperty(runtime, "BYTES_PER_ELEMENT");
+    if (bytesPerElement.isNumber() && static_cast<size_t>(bytesPerElement.getNumber()) != sizeof(ElementType)) {
+      [[unlikely]];
+      throw std::runtime_error("Cannot convert TypedArray to a " + std::string(TypedArrayTraits<ElementType>::name) + " - it has " +
+                               std::to_string(static_cast<size_t>(bytesPerElement.getNumber())) + " bytes per element!");
+    }
+#endif
+    size_t byteOffset = static_cast<size_t>(object.getProperty(runtime, "byteOffset").asNumber());
+    size_t byteLength = static_cast<size_t>(object.getProperty(runtime, "byteLength").asNumber());
+    return createView(runtime, buffer.getObject(runtime).getArrayBuffer(runtime), byteOffset, byteLength);
+  }
+  static jsi::Value toJSI(jsi::Runtime&, const TypedArrayView<ElementType>&) {
+    throw std::runtime_error("TypedArrayView cannot be converted to JS as it does not own its memory - use TypedArray instead!");
+  }
+
+private:
+  static TypedArrayView<ElementType> createView(jsi::Runtime& runtime, const jsi::ArrayBuffer& arrayBuffer, size_t byteOffset,
+                                                size_t byteLength) {
+    if (byteOffset % alignof(ElementType) != 0 || byteLength % sizeof(ElementType) != 0) {
+      [[unlikely]];
+      throw std::runtime_error("Cannot view ArrayBuffer as a " + std::string(TypedArrayTraits<ElementType>::name) +
+                               " - its offset or length is not a multiple of " + std::to_string(sizeof(ElementType)) + " bytes!");
+    }
+    const uint8_t* data = arrayBuffer.data(runtime) + byteOffset;
+    return TypedArrayView<ElementType>(reinterpret_cast<const ElementType*>(data), byteLength / sizeof(ElementType));
+  }
+};
+
+// std::shared_ptr<TypedArray<T>> <> Float32Array, Float64Array, ...
+template <typename ElementType> struct JSIConverter<std::shared_ptr<TypedArray<ElementType>>> {
+  static std::shared_ptr<TypedArray<ElementType>> fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+    TypedArrayView<ElementType> view = JSIConverter<TypedArrayView<ElementType>>::fromJSI(runtime, arg);
+    return std::make_shared<TypedArray<ElementType>>(view.data(), view.size());
+  }
+  static jsi::Value toJSI(jsi::Runtime& runtime, const std::shared_ptr<TypedArray<ElementType>>& typedArray) {
+    // The ArrayBuffer uses our memory directly, and keeps the TypedArray alive.
+    jsi::ArrayBuffer arrayBuffer(runtime, typedArray);
+    jsi::Function constructor = runtime.global().getPropertyAsFunction(runtime, TypedArrayTraits<ElementType>::name);
+    return constructor.callAsConstructor(runtime, arrayBuffer);
+  }
+};
+
 // std::unordered_map<std::string, T> <> Record<string, T>
 template <typename ValueType> struct JSIConverter<std::unordered_map<std::string, ValueType>> {
   static std::unordered_map<std::string, ValueType> fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
@@ -23,11 +23,7 @@ protected:
    * @param name The name of the implementing class, for example "ViewWrapper".
    * @param pointer The pointer this class will hold. It might be released from JS at any point via `release()`.
    */
-  PointerHolder(const char* name, std::shared_ptr<T> pointer) : HybridObject(name), _name(name), _pointer(pointer) {
-    // eagerly initialize the release() method instead of putting it in `loadHybridMethods`
-    registerHybridMethod("release", &PointerHolder<T>::release, this);
-    registerHybridGetter("isValid", &PointerHolder<T>::getIsValid, this);
-  }
+  PointerHolder(const char* name, std::shared_ptr<T> pointer) : HybridObject(name), _name(name), _pointer(pointer) {}
 
   /**
    * Create a new instance of a pointer holder which holds a shared_ptr of the given value.
@@ -46,6 +42,15 @@ protected:
     }
   }
 
+public:
+  /**
+   * Registers `release()` and `isValid`. Subclasses that override this must call `PointerHolder::loadHybridMethods()` first.
+   */
+  void loadHybridMethods() override {
+    registerHybridMethod("release", &PointerHolder<T>::release);
+    registerHybridGetter("isValid", &PointerHolder<T>::getIsValid);
+  }
+
 protected:
   /**
    * Manually release this reference to the pointer.
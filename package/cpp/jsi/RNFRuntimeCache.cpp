@@ -3,6 +3,7 @@
 #include <jsi/jsi.h>
 
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -12,22 +13,32 @@
 namespace margelo {
 
 static std::unordered_map<jsi::Runtime*, std::unordered_set<RuntimeLifecycleListener*>> listeners;
+// Listeners are added from every runtime's thread (e.g. the first HybridObject access on a Worklet runtime).
+static std::mutex listenersMutex;
 
 struct RuntimeLifecycleMonitorObject : public jsi::HostObject {
   jsi::Runtime* _rt;
   explicit RuntimeLifecycleMonitorObject(jsi::Runtime* rt) : _rt(rt) {}
   ~RuntimeLifecycleMonitorObject() {
-    auto listenersSet = listeners.find(_rt);
-    if (listenersSet != listeners.end()) {
-      for (auto listener : listenersSet->second) {
-        listener->onRuntimeDestroyed(_rt);
+    std::unordered_set<RuntimeLifecycleListener*> runtimeListeners;
+    {
+      std::unique_lock lock(listenersMutex);
+      auto listenersSet = listeners.find(_rt);
+      if (listenersSet == listeners.end()) {
+        return;
       }
+      runtimeListeners = std::move(listenersSet->second);
       listeners.erase(listenersSet);
     }
+    // Notify without holding the lock, listeners may add or remove other listeners.
+    for (auto listener : runtimeListeners) {
+      listener->onRuntimeDestroyed(_rt);
+    }
   }
 };
 
 void RuntimeLifecycleMonitor::addListener(jsi::Runtime& rt, RuntimeLifecycleListener* listener) {
+  std::unique_lock lock(listenersMutex);
   auto listenersSet = listeners.find(&rt);
   if (listenersSet == listeners.end()) {
     // We install a global host object in the provided runtime, this way we can
@@ -45,6 +56,7 @@ void RuntimeLifecycleMonitor::addListener(jsi::Runtime& rt, RuntimeLifecycleList
 }
 
 void RuntimeLifecycleMonitor::removeListener(jsi::Runtime& rt, RuntimeLifecycleListener* listener) {
+  std::unique_lock lock(listenersMutex);
   auto listenersSet = listeners.find(&rt);
   if (listenersSet == listeners.end()) {
     // nothing to do here
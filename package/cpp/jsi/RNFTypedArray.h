@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstring>
+#include <jsi/jsi.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace margelo {
+
+using namespace facebook;
+
+template <typename T> struct TypedArrayTraits {};
+template <> struct TypedArrayTraits<float> {
+  static constexpr auto name = "Float32Array";
+};
+template <> struct TypedArrayTraits<double> {
+  static constexpr auto name = "Float64Array";
+};
+template <> struct TypedArrayTraits<int32_t> {
+  static constexpr auto name = "Int32Array";
+};
+template <> struct TypedArrayTraits<uint32_t> {
+  static constexpr auto name = "Uint32Array";
+};
+template <> struct TypedArrayTraits<uint16_t> {
+  static constexpr auto name = "Uint16Array";
+};
+template <> struct TypedArrayTraits<uint8_t> {
+  static constexpr auto name = "Uint8Array";
+};
+
+/**
+ * A non-owning view into the memory of a JS TypedArray (e.g. `Float32Array` for `TypedArrayView<float>`) or ArrayBuffer.
+ * The view is only valid for the duration of the native call it has been passed to, don't store it.
+ *
+ * For compatibility, plain JS number arrays are accepted as well - those are copied into storage owned by the view.
+ */
+template <typename T> class TypedArrayView {
+public:
+  TypedArrayView(const T* data, size_t size) : _data(data), _size(size) {}
+  explicit TypedArrayView(std::vector<T>&& storage) : _storage(std::move(storage)) {
+    _data = _storage.data();
+    _size = _storage.size();
+  }
+
+  TypedArrayView(const TypedArrayView&) = delete;
+  TypedArrayView& operator=(const TypedArrayView&) = delete;
+  TypedArrayView(TypedArrayView&& other) noexcept : _data(other._data), _size(other._size), _storage(std::move(other._storage)) {
+    if (!_storage.empty()) {
+      _data = _storage.data();
+    }
+  }
+
+  const T* data() const {
+    return _data;
+  }
+  size_t size() const {
+    return _size;
+  }
+  const T& operator[](size_t index) const {
+    return _data[index];
+  }
+  const T* begin() const {
+    return _data;
+  }
+  const T* end() const {
+    return _data + _size;
+  }
+
+private:
+  const T* _data = nullptr;
+  size_t _size = 0;
+  std::vector<T> _storage;
+};
+
+/**
+ * An owning, native buffer that is exposed to JS as a TypedArray (e.g. `Float32Array` for `TypedArray<float>`) without copying.
+ * The JS ArrayBuffer keeps this buffer alive.
+ */
+template <typename T> class TypedArray : public jsi::MutableBuffer {
+public:
+  explicit TypedArray(size_t count) : _elements(count) {}
+  explicit TypedArray(std::vector<T>&& elements) : _elements(std::move(elements)) {}
+  TypedArray(const T* elements, size_t count) : _elements(elements, elements + count) {}
+
+  size_t size() const override {
+    return _elements.size() * sizeof(T);
+  }
+  uint8_t* data() override {
+    return reinterpret_cast<uint8_t*>(_elements.data());
+  }
+
+  T* elements() {
+    return _elements.data();
+  }
+  size_t count() const {
+    return _elements.size();
+  }
+
+private:
+  std::vector<T> _elements;
+};
+
+} // namespace margelo
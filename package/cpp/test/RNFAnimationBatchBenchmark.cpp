@@ -0,0 +1,83 @@
+#include "RNFAnimationBatchBenchmark.h"
+#include "threading/RNFWorkerPool.h"
+
+#include <filament/Engine.h>
+#include <filament/TransformManager.h>
+#include <math/mat4.h>
+#include <math/quat.h>
+#include <utils/EntityManager.h>
+
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace margelo {
+
+using namespace filament;
+using namespace utils;
+
+template <typename Function> static double measureFrames(int framesCount, Function&& poseFrame) {
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < framesCount; frame++) {
+    poseFrame(static_cast<float>(frame) / 60.0f);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / framesCount;
+}
+
+std::unordered_map<std::string, double> benchmarkAnimationBatch(int instancesCount, int bonesCount, int framesCount) {
+  if (instancesCount < 1 || bonesCount < 1 || framesCount < 1) [[unlikely]] {
+    throw std::invalid_argument("Cannot benchmark " + std::to_string(instancesCount) + " instances with " + std::to_string(bonesCount) +
+                                " bones over " + std::to_string(framesCount) + " frames!");
+  }
+
+  Engine* engine = Engine::create(Engine::Backend::NOOP);
+  TransformManager& transformManager = engine->getTransformManager();
+  EntityManager& entityManager = EntityManager::get();
+
+  // Every instance is a skeleton with its own hierarchy (a binary tree of bones), like instances of a skinned asset
+  std::vector<Entity> entities(static_cast<size_t>(bonesCount) * instancesCount);
+  entityManager.create(entities.size(), entities.data());
+  for (int instance = 0; instance < instancesCount; instance++) {
+    size_t offset = static_cast<size_t>(instance) * bonesCount;
+    for (int bone = 0; bone < bonesCount; bone++) {
+      TransformManager::Instance parent;
+      if (bone > 0) {
+        parent = transformManager.getInstance(entities[offset + (bone - 1) / 2]);
+      }
+      transformManager.create(entities[offset + bone], parent, math::mat4f::translation(math::float3(0, 1, 0)));
+    }
+  }
+
+  auto poseInstance = [&](int instance, float time) {
+    size_t offset = static_cast<size_t>(instance) * bonesCount;
+    for (int bone = 0; bone < bonesCount; bone++) {
+      float angle = std::sin(time + static_cast<float>(bone)) * 0.5f;
+      math::quatf rotation = math::quatf::fromAxisAngle(math::float3(0, 0, 1), angle);
+      math::mat4f transform = math::mat4f::translation(math::float3(0, 1, 0)) * math::mat4f(rotation);
+      transformManager.setTransform(transformManager.getInstance(entities[offset + bone]), transform);
+    }
+  };
+
+  WorkerPool workerPool("RNF.Benchmark", WorkerPool::getDefaultThreadsCount());
+  std::unordered_map<std::string, double> results;
+  results["serial"] = measureFrames(framesCount, [&](float time) {
+    for (int instance = 0; instance < instancesCount; instance++) {
+      poseInstance(instance, time);
+    }
+  });
+  results["workerPool"] = measureFrames(framesCount, [&](float time) {
+    workerPool.parallelFor(instancesCount, [&](size_t instance) { poseInstance(static_cast<int>(instance), time); });
+  });
+  results["threads"] = static_cast<double>(workerPool.getThreadsCount() + 1);
+
+  for (Entity entity : entities) {
+    transformManager.destroy(entity);
+  }
+  entityManager.destroy(entities.size(), entities.data());
+  Engine::destroy(&engine);
+  return results;
+}
+
+} // namespace margelo
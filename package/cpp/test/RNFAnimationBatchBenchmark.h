@@ -0,0 +1,21 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace margelo {
+
+/**
+ * Measures how long it takes to pose `instancesCount` skeletons of `bonesCount` bones each, like the AnimationMixer
+ * applies the animations of all its animators every frame. Every bone gets a new local transform per frame, sampled
+ * from a rotation over time. Runs on a Filament Engine with the NOOP backend.
+ *
+ * - `serial`: Poses all instances one after another on the calling Thread
+ * - `workerPool`: Poses the instances in parallel on a WorkerPool, one instance per job (how the AnimationMixer does it)
+ *
+ * Returns the average milliseconds per frame of each approach over `framesCount` frames, keyed by the names above,
+ * and the number of Threads the WorkerPool used (including the calling Thread) as `threads`.
+ */
+std::unordered_map<std::string, double> benchmarkAnimationBatch(int instancesCount, int bonesCount, int framesCount);
+
+} // namespace margelo
@@ -0,0 +1,60 @@
+#include "RNFBakedAnimationTest.h"
+#include "core/RNFBakedAnimation.h"
+
+#include <math/mat4.h>
+#include <math/quat.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace margelo {
+
+using namespace filament;
+
+static math::mat4f composeTransform(math::float3 translation, math::quatf rotation, math::float3 scale) {
+  return math::mat4f::translation(translation) * math::mat4f(rotation) * math::mat4f::scaling(scale);
+}
+
+std::unordered_map<std::string, double> testBakedAnimationRoundTrip() {
+  constexpr size_t entityCount = 4;
+  constexpr size_t frameCount = 31;
+  constexpr double duration = 1;
+
+  std::vector<math::mat4f> restPose(entityCount, math::mat4f());
+  restPose[1] = composeTransform({0, 1, 0}, math::quatf(), {1, 1, 1});
+
+  std::vector<math::mat4f> samples(frameCount * entityCount);
+  for (size_t frame = 0; frame < frameCount; frame++) {
+    float t = static_cast<float>(frame) / static_cast<float>(frameCount - 1);
+    math::mat4f* pose = samples.data() + frame * entityCount;
+    pose[0] = restPose[0];
+    pose[1] = composeTransform({0, 2, 0}, math::quatf::fromAxisAngle(math::float3{1, 0, 0}, 0.5f), {1, 1, 1});
+    pose[2] = composeTransform({10 * t, -3 * t, 5}, math::quatf::fromAxisAngle(normalize(math::float3{1, 1, 0}), 3 * t),
+                               {1 + t, 1, 2 - t});
+    pose[3] = composeTransform({0, 0, 0}, math::quatf::fromAxisAngle(math::float3{0, 1, 0}, 6 * t), {-1, 1, 1});
+  }
+
+  BakedAnimation animation(duration, frameCount, entityCount, samples, restPose);
+  const std::vector<uint32_t>& trackEntityIndices = animation.getTrackEntityIndices();
+  bool constantTrack = std::find(trackEntityIndices.begin(), trackEntityIndices.end(), 1) != trackEntityIndices.end();
+
+  double maxError = 0;
+  std::vector<math::mat4f> decoded(animation.getTrackCount());
+  for (size_t frame = 0; frame < frameCount; frame++) {
+    double time = duration * static_cast<double>(frame) / static_cast<double>(frameCount - 1);
+    animation.samplePose(time, decoded.data());
+    for (size_t track = 0; track < decoded.size(); track++) {
+      const math::mat4f& expected = samples[frame * entityCount + trackEntityIndices[track]];
+      for (size_t column = 0; column < 4; column++) {
+        for (size_t row = 0; row < 4; row++) {
+          maxError = std::max(maxError, static_cast<double>(std::abs(decoded[track][column][row] - expected[column][row])));
+        }
+      }
+    }
+  }
+
+  return {{"tracks", static_cast<double>(animation.getTrackCount())}, {"constantTrack", constantTrack ? 1 : 0}, {"maxError", maxError}};
+}
+
+} // namespace margelo
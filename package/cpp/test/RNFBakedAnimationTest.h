@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace margelo {
+
+/**
+ * Bakes a synthetic clip of four entities into a BakedAnimation and decodes every baked frame again:
+ * - entity 0 stays at its rest pose
+ * - entity 1 is held at a constant transform that differs from its rest pose
+ * - entity 2 translates, rotates and scales over the clip
+ * - entity 3 rotates with a mirrored scale
+ *
+ * Returns the number of tracks (`tracks`, expected to be 3), whether the constant entity got a track (`constantTrack`, 1 or 0)
+ * and the largest difference of any matrix element between a decoded and a sampled transform (`maxError`).
+ */
+std::unordered_map<std::string, double> testBakedAnimationRoundTrip();
+
+} // namespace margelo
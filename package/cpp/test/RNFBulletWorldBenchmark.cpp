@@ -0,0 +1,227 @@
+#include "RNFBulletWorldBenchmark.h"
+#include "bullet/RNFDiscreteDynamicWorldWrapper.h"
+#include "bullet/RNFRigidBodyWrapper.h"
+#include "threading/RNFWorkerPool.h"
+
+#include <btBulletDynamicsCommon.h>
+
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace margelo {
+
+static constexpr double TIME_STEP = 1.0 / 60.0;
+static constexpr int SETTLE_FRAMES = 60;
+
+static double measurePile(int bodiesCount, int framesCount, std::optional<int> threadsCount) {
+  // Declared before the world, the world removes the bodies' broadphase proxies when it is destroyed
+  std::vector<std::shared_ptr<RigidBodyWrapper>> bodies;
+  bodies.reserve(bodiesCount + 1);
+  auto world = std::make_shared<DiscreteDynamicWorldWrapper>(0, -9.81, 0, threadsCount);
+
+  auto groundShape = std::make_shared<btStaticPlaneShape>(btVector3(0, 1, 0), 0);
+  bodies.push_back(RigidBodyWrapper::create(0, 0, 0, 0, groundShape, "ground", std::nullopt));
+  world->addRigidBody(bodies.back());
+
+  // Stack the boxes in layers of 10x10, every other layer slightly offset so the pile collapses into many contacts
+  auto boxShape = std::make_shared<btBoxShape>(btVector3(0.5, 0.5, 0.5));
+  constexpr int LAYER_SIZE = 10;
+  for (int i = 0; i < bodiesCount; i++) {
+    int layer = i / (LAYER_SIZE * LAYER_SIZE);
+    double offset = layer % 2 == 0 ? 0 : 0.3;
+    double x = (i % LAYER_SIZE) * 1.05 + offset;
+    double y = 0.5 + layer * 1.05;
+    double z = ((i / LAYER_SIZE) % LAYER_SIZE) * 1.05 + offset;
+    bodies.push_back(RigidBodyWrapper::create(1, x, y, z, boxShape, "box_" + std::to_string(i), std::nullopt));
+    world->addRigidBody(bodies.back());
+  }
+
+  for (int frame = 0; frame < SETTLE_FRAMES; frame++) {
+    world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+  }
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < framesCount; frame++) {
+    world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / framesCount;
+}
+
+std::unordered_map<std::string, double> benchmarkBulletWorld(int bodiesCount, int framesCount) {
+  if (bodiesCount < 1 || framesCount < 1) [[unlikely]] {
+    throw std::invalid_argument("Cannot benchmark " + std::to_string(bodiesCount) + " bodies over " + std::to_string(framesCount) +
+                                " frames!");
+  }
+
+  std::unordered_map<std::string, double> results;
+  results["sequential"] = measurePile(bodiesCount, framesCount, std::nullopt);
+  // All multithreaded worlds share the Threads of the first one, so only one thread count can be measured per process
+  int threadsCount = static_cast<int>(WorkerPool::getDefaultThreadsCount()) + 1;
+#if BT_THREADSAFE
+  threadsCount = BulletTaskScheduler::getSharedThreadsCount().value_or(threadsCount);
+#endif
+  results["multithreaded"] = measurePile(bodiesCount, framesCount, threadsCount);
+  return results;
+}
+
+static double millisecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::unordered_map<std::string, double> benchmarkBulkRigidBodies(int bodiesCount) {
+  if (bodiesCount < 1) [[unlikely]] {
+    throw std::invalid_argument("Cannot benchmark " + std::to_string(bodiesCount) + " bodies!");
+  }
+
+  // A grid of boxes resting on the ground, so every body has a pair when it gets removed
+  constexpr int ROW_SIZE = 100;
+  std::vector<double> packedBodies;
+  packedBodies.reserve(bodiesCount * DiscreteDynamicWorldWrapper::RIGID_BODY_STRIDE + DiscreteDynamicWorldWrapper::RIGID_BODY_STRIDE);
+  packedBodies.insert(packedBodies.end(), {0, 0, 0, 0, 0});
+  for (int i = 0; i < bodiesCount; i++) {
+    packedBodies.insert(packedBodies.end(), {1, (i % ROW_SIZE) * 1.05, 0.5, (i / ROW_SIZE) * 1.05, 1});
+  }
+  auto groundShape = std::make_shared<ShapeWrapper>("StaticPlaneShapeWrapper", std::make_shared<btStaticPlaneShape>(btVector3(0, 1, 0), 0));
+  auto boxShape = std::make_shared<ShapeWrapper>("BoxShapeWrapper", std::make_shared<btBoxShape>(btVector3(0.5, 0.5, 0.5)));
+  std::vector<std::shared_ptr<ShapeWrapper>> shapes = {groundShape, boxShape};
+
+  std::unordered_map<std::string, double> results;
+  {
+    auto world = std::make_shared<DiscreteDynamicWorldWrapper>(0, -9.81, 0);
+    std::vector<std::shared_ptr<RigidBodyWrapper>> bodies;
+    bodies.reserve(bodiesCount + 1);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < packedBodies.size(); i += DiscreteDynamicWorldWrapper::RIGID_BODY_STRIDE) {
+      const double* values = packedBodies.data() + i;
+      std::shared_ptr<btCollisionShape> shape = shapes[static_cast<size_t>(values[4])]->getShape();
+      bodies.push_back(RigidBodyWrapper::create(values[0], values[1], values[2], values[3], shape, "", std::nullopt));
+      world->addRigidBody(bodies.back());
+    }
+    results["addEach"] = millisecondsSince(start);
+
+    world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+    start = std::chrono::steady_clock::now();
+    for (const std::shared_ptr<RigidBodyWrapper>& body : bodies) {
+      world->removeRigidBody(body);
+    }
+    results["removeEach"] = millisecondsSince(start);
+  }
+  {
+    auto world = std::make_shared<DiscreteDynamicWorldWrapper>(0, -9.81, 0);
+    auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<TypedArray<int32_t>> bodyIds =
+        world->createRigidBodies(TypedArrayView<double>(packedBodies.data(), packedBodies.size()), shapes);
+    results["addBatch"] = millisecondsSince(start);
+
+    world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+    start = std::chrono::steady_clock::now();
+    world->removeRigidBodies(TypedArrayView<int32_t>(bodyIds->elements(), bodyIds->count()));
+    results["removeBatch"] = millisecondsSince(start);
+  }
+  return results;
+}
+
+std::unordered_map<std::string, double> benchmarkPhysicsSnapshot(int bodiesCount) {
+  if (bodiesCount < 1) [[unlikely]] {
+    throw std::invalid_argument("Cannot benchmark " + std::to_string(bodiesCount) + " bodies!");
+  }
+
+  constexpr int LAYER_SIZE = 10;
+  std::vector<double> packedBodies;
+  packedBodies.reserve(bodiesCount * DiscreteDynamicWorldWrapper::RIGID_BODY_STRIDE + DiscreteDynamicWorldWrapper::RIGID_BODY_STRIDE);
+  packedBodies.insert(packedBodies.end(), {0, 0, 0, 0, 0});
+  for (int i = 0; i < bodiesCount; i++) {
+    int layer = i / (LAYER_SIZE * LAYER_SIZE);
+    double offset = layer % 2 == 0 ? 0 : 0.3;
+    packedBodies.insert(packedBodies.end(),
+                        {1, (i % LAYER_SIZE) * 1.05 + offset, 0.5 + layer * 1.05, ((i / LAYER_SIZE) % LAYER_SIZE) * 1.05 + offset, 1});
+  }
+  auto groundShape = std::make_shared<ShapeWrapper>("StaticPlaneShapeWrapper", std::make_shared<btStaticPlaneShape>(btVector3(0, 1, 0), 0));
+  auto boxShape = std::make_shared<ShapeWrapper>("BoxShapeWrapper", std::make_shared<btBoxShape>(btVector3(0.5, 0.5, 0.5)));
+  auto world = std::make_shared<DiscreteDynamicWorldWrapper>(0, -9.81, 0);
+  world->createRigidBodies(TypedArrayView<double>(packedBodies.data(), packedBodies.size()), {groundShape, boxShape});
+  for (int frame = 0; frame < SETTLE_FRAMES; frame++) {
+    world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+  }
+
+  constexpr int RUNS = 20;
+  std::unordered_map<std::string, double> results;
+  std::shared_ptr<TypedArray<uint8_t>> snapshot;
+  auto start = std::chrono::steady_clock::now();
+  for (int run = 0; run < RUNS; run++) {
+    snapshot = world->snapshot();
+  }
+  results["snapshot"] = millisecondsSince(start) / RUNS;
+  results["bytes"] = static_cast<double>(snapshot->count());
+
+  start = std::chrono::steady_clock::now();
+  for (int run = 0; run < RUNS; run++) {
+    world->restore(TypedArrayView<uint8_t>(snapshot->elements(), snapshot->count()));
+  }
+  results["restore"] = millisecondsSince(start) / RUNS;
+
+  // The pile is still moving after settling, so diverging contacts would show up in the final state
+  auto replay = [&]() {
+    world->restore(TypedArrayView<uint8_t>(snapshot->elements(), snapshot->count()));
+    for (int frame = 0; frame < SETTLE_FRAMES; frame++) {
+      world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+    }
+    return world->snapshot();
+  };
+  std::shared_ptr<TypedArray<uint8_t>> first = replay();
+  std::shared_ptr<TypedArray<uint8_t>> second = replay();
+  bool isDeterministic =
+      first->count() == second->count() && std::equal(first->elements(), first->elements() + first->count(), second->elements());
+  results["deterministic"] = isDeterministic ? 1 : 0;
+  return results;
+}
+
+std::unordered_map<std::string, double> benchmarkChangedBodies(int bodiesCount) {
+  if (bodiesCount < 1) [[unlikely]] {
+    throw std::invalid_argument("Cannot benchmark " + std::to_string(bodiesCount) + " bodies!");
+  }
+
+  // Spaced apart so the boxes don't touch, every box settles on its own and falls asleep after about two seconds
+  constexpr int ROW_SIZE = 100;
+  constexpr int MEASURED_FRAMES = 60;
+  constexpr int SLEEP_FRAMES = 240;
+  std::vector<double> packedBodies;
+  packedBodies.reserve(bodiesCount * DiscreteDynamicWorldWrapper::RIGID_BODY_STRIDE + DiscreteDynamicWorldWrapper::RIGID_BODY_STRIDE);
+  packedBodies.insert(packedBodies.end(), {0, 0, 0, 0, 0});
+  for (int i = 0; i < bodiesCount; i++) {
+    packedBodies.insert(packedBodies.end(), {1, (i % ROW_SIZE) * 1.5, 2, (i / ROW_SIZE) * 1.5, 1});
+  }
+  auto groundShape = std::make_shared<ShapeWrapper>("StaticPlaneShapeWrapper", std::make_shared<btStaticPlaneShape>(btVector3(0, 1, 0), 0));
+  auto boxShape = std::make_shared<ShapeWrapper>("BoxShapeWrapper", std::make_shared<btBoxShape>(btVector3(0.5, 0.5, 0.5)));
+  auto world = std::make_shared<DiscreteDynamicWorldWrapper>(0, -9.81, 0);
+  world->createRigidBodies(TypedArrayView<double>(packedBodies.data(), packedBodies.size()), {groundShape, boxShape});
+  // The added bodies are reported once
+  world->takeChangedBodies();
+
+  auto measureFrames = [&world](double& changesPerFrame, double& msPerFrame) {
+    size_t changesCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < MEASURED_FRAMES; frame++) {
+      world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+      changesCount += world->takeChangedBodies()->count() / BodyChangeTracker::CHANGE_STRIDE;
+    }
+    msPerFrame = millisecondsSince(start) / MEASURED_FRAMES;
+    changesPerFrame = static_cast<double>(changesCount) / MEASURED_FRAMES;
+  };
+
+  std::unordered_map<std::string, double> results;
+  measureFrames(results["fallingChanges"], results["fallingMs"]);
+  for (int frame = 0; frame < SLEEP_FRAMES; frame++) {
+    world->stepSimulation(TIME_STEP, 1, TIME_STEP);
+  }
+  world->takeChangedBodies();
+  measureFrames(results["restingChanges"], results["restingMs"]);
+  results.merge(world->getSimulationStats());
+  return results;
+}
+
+} // namespace margelo
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace margelo {
+
+/**
+ * Measures how long it takes to step a pile of `bodiesCount` boxes falling onto a ground plane, on a single-threaded world
+ * and on a multithreaded world (btDiscreteDynamicsWorldMt) using all cores. All multithreaded worlds share one task
+ * scheduler (see BulletTaskScheduler::getShared), so if one was created before, its thread count is used as well.
+ * The pile is stepped for 60 frames to settle into contact before measuring `framesCount` frames at 60 Hz.
+ *
+ * Returns the average milliseconds per frame keyed by `sequential` and `multithreaded`.
+ */
+std::unordered_map<std::string, double> benchmarkBulletWorld(int bodiesCount, int framesCount);
+
+/**
+ * Measures how long it takes to spawn and despawn `bodiesCount` boxes resting on a ground plane, one body per call
+ * (`addRigidBody`, `removeRigidBody`) and in a single call (`createRigidBodies`, `removeRigidBodies`).
+ *
+ * Returns the milliseconds keyed by `addEach`, `removeEach`, `addBatch` and `removeBatch`.
+ */
+std::unordered_map<std::string, double> benchmarkBulkRigidBodies(int bodiesCount);
+
+/**
+ * Measures how long it takes to snapshot and restore a settled pile of `bodiesCount` boxes, averaged over a number of runs.
+ * Also steps the pile twice from the same restored snapshot and checks that both runs end in the same state.
+ *
+ * Returns the milliseconds keyed by `snapshot` and `restore`, the snapshot's size keyed by `bytes`,
+ * and `deterministic` (1 or 0).
+ */
+std::unordered_map<std::string, double> benchmarkPhysicsSnapshot(int bodiesCount);
+
+/**
+ * Measures the changed bodies reported per frame for a grid of `bodiesCount` boxes dropped onto a ground plane, while they
+ * fall and after they came to rest, along with how long stepping and taking the changes takes.
+ *
+ * Returns `fallingChanges` and `restingChanges` (bodies per frame), `fallingMs` and `restingMs` (per frame),
+ * and the world's simulation stats once resting.
+ */
+std::unordered_map<std::string, double> benchmarkChangedBodies(int bodiesCount);
+
+} // namespace margelo
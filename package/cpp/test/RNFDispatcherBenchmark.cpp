@@ -0,0 +1,159 @@
+#include "RNFDispatcherBenchmark.h"
+#include "threading/RNFBatchingDispatcher.h"
+#include "threading/RNFThreadDispatcher.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace margelo {
+
+/**
+ * Stand-in for a `java.util.concurrent.Executor` with a single Thread: runs posted tasks in order.
+ */
+class SerialExecutor {
+public:
+  SerialExecutor() : _thread([this]() { runLoop(); }) {}
+  ~SerialExecutor() {
+    {
+      std::unique_lock lock(_mutex);
+      _isRunning = false;
+    }
+    _condition.notify_one();
+    _thread.join();
+  }
+
+  void execute(std::function<void()>&& task) {
+    {
+      std::unique_lock lock(_mutex);
+      _tasks.push(std::move(task));
+    }
+    _condition.notify_one();
+  }
+
+private:
+  void runLoop() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock lock(_mutex);
+        _condition.wait(lock, [this]() { return !_tasks.empty() || !_isRunning; });
+        if (_tasks.empty()) {
+          break;
+        }
+        task = std::move(_tasks.front());
+        _tasks.pop();
+      }
+      task();
+    }
+  }
+
+private:
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::queue<std::function<void()>> _tasks;
+  bool _isRunning = true;
+  std::thread _thread;
+};
+
+/**
+ * The previous `JDispatcher` design: every job is pushed under a mutex and schedules its own executor task,
+ * which then pops exactly one job under that same mutex.
+ */
+class MutexQueueDispatcher : public Dispatcher {
+public:
+  void runAsync(std::function<void()>&& function) override {
+    std::unique_lock lock(_mutex);
+    _jobs.push(std::move(function));
+    _executor.execute([this]() { trigger(); });
+  }
+  void runSync(std::function<void()>&&) override {
+    throw std::runtime_error("MutexQueueDispatcher only supports runAsync!");
+  }
+
+private:
+  void trigger() {
+    std::unique_lock lock(_mutex);
+    auto job = _jobs.front();
+    job();
+    _jobs.pop();
+  }
+
+private:
+  std::queue<std::function<void()>> _jobs;
+  std::recursive_mutex _mutex;
+  // Declared last so its Thread is joined before the queue and mutex are destroyed
+  SerialExecutor _executor;
+};
+
+/**
+ * The current `JDispatcher` design, with the executor standing in for the Java side.
+ */
+class ExecutorBatchingDispatcher : public BatchingDispatcher {
+protected:
+  void scheduleDrain() override {
+    _executor.execute([this]() { drain(); });
+  }
+
+private:
+  SerialExecutor _executor;
+};
+
+static double measureDispatcher(Dispatcher& dispatcher, int jobsCount, int producersCount) {
+  std::atomic<int> completedJobs{0};
+  // Shared, as the last job might still be inside set_value() when the waiting Thread returns
+  auto allJobsCompleted = std::make_shared<std::promise<void>>();
+  std::future<void> allJobsCompletedFuture = allJobsCompleted->get_future();
+  int jobsPerProducer = jobsCount / producersCount;
+  int totalJobs = jobsPerProducer * producersCount;
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> producers;
+  producers.reserve(producersCount);
+  for (int i = 0; i < producersCount; i++) {
+    producers.emplace_back([&]() {
+      for (int j = 0; j < jobsPerProducer; j++) {
+        dispatcher.runAsync([&completedJobs, allJobsCompleted, totalJobs]() {
+          if (completedJobs.fetch_add(1, std::memory_order_relaxed) + 1 == totalJobs) {
+            allJobsCompleted->set_value();
+          }
+        });
+      }
+    });
+  }
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  allJobsCompletedFuture.wait();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+std::unordered_map<std::string, double> benchmarkDispatchers(int jobsCount, int producersCount) {
+  if (jobsCount < 1 || producersCount < 1 || producersCount > jobsCount) [[unlikely]] {
+    throw std::invalid_argument("Cannot benchmark " + std::to_string(jobsCount) + " jobs on " + std::to_string(producersCount) +
+                                " producers!");
+  }
+
+  std::unordered_map<std::string, double> results;
+  {
+    MutexQueueDispatcher dispatcher;
+    results["mutexQueue"] = measureDispatcher(dispatcher, jobsCount, producersCount);
+  }
+  {
+    ExecutorBatchingDispatcher dispatcher;
+    results["batchingExecutor"] = measureDispatcher(dispatcher, jobsCount, producersCount);
+  }
+  {
+    ThreadDispatcher dispatcher("RNF.Benchmark");
+    results["threadDispatcher"] = measureDispatcher(dispatcher, jobsCount, producersCount);
+  }
+  return results;
+}
+
+} // namespace margelo
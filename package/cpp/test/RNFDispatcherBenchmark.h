@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace margelo {
+
+/**
+ * Measures how long it takes `producersCount` Threads to run `jobsCount` tiny jobs through different Dispatcher designs:
+ *
+ * - `mutexQueue`: A `std::queue` under a mutex that posts one executor task per job (how `JDispatcher` used to work)
+ * - `batchingExecutor`: A `BatchingDispatcher` on the same kind of executor (how `JDispatcher` works now)
+ * - `threadDispatcher`: A `ThreadDispatcher` with its own `std::thread` event loop
+ *
+ * Returns the milliseconds each design took, keyed by the names above.
+ */
+std::unordered_map<std::string, double> benchmarkDispatchers(int jobsCount, int producersCount);
+
+} // namespace margelo
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "RNFChunkedBufferLoader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace margelo {
+
+/**
+ * A local stand-in for a slow source (e.g. a network stream): Generates `size` bytes of a known pattern
+ * (the byte at offset `i` is `i % 256`) and waits `chunkDelay` for every read.
+ */
+class GeneratedChunkSource : public ChunkSource {
+public:
+  explicit GeneratedChunkSource(size_t size, std::chrono::microseconds chunkDelay) : _size(size), _chunkDelay(chunkDelay) {}
+
+  size_t getSize() const override {
+    return _size;
+  }
+
+  size_t read(uint8_t* destination, size_t maxBytes) override {
+    if (_chunkDelay.count() > 0) {
+      std::this_thread::sleep_for(_chunkDelay);
+    }
+    size_t bytesRead = std::min(maxBytes, _size - _offset);
+    for (size_t i = 0; i < bytesRead; i++) {
+      destination[i] = static_cast<uint8_t>((_offset + i) % 256);
+    }
+    _offset += bytesRead;
+    return bytesRead;
+  }
+
+private:
+  size_t _size;
+  std::chrono::microseconds _chunkDelay;
+  size_t _offset = 0;
+};
+
+} // namespace margelo
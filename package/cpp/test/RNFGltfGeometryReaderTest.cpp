@@ -0,0 +1,157 @@
+#include "RNFGltfGeometryReaderTest.h"
+#include "core/RNFGltfGeometryReader.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace margelo {
+
+namespace {
+
+  // The parts of the triangle glTF the cases below replace
+  struct GltfParts {
+    std::string positionView = R"("buffer": 0, "byteOffset": 0, "byteLength": 36)";
+    std::string positionAccessor = R"("bufferView": 0, "componentType": 5126, "type": "VEC3", "count": 3)";
+    std::string nodes = R"([{ "name": "triangle", "mesh": 0, "translation": [1, 0, 0] }])";
+  };
+
+  // Three float3 positions, followed by three uint16 indices (and two bytes padding)
+  std::vector<uint8_t> createTriangleBuffer() {
+    const float positions[] = {0, 0, 0, 1, 0, 0, 0, 1, 0};
+    const uint16_t indices[] = {0, 1, 2};
+    std::vector<uint8_t> buffer(44, 0);
+    std::memcpy(buffer.data(), positions, sizeof(positions));
+    std::memcpy(buffer.data() + sizeof(positions), indices, sizeof(indices));
+    return buffer;
+  }
+
+  std::string encodeBase64(const std::vector<uint8_t>& bytes) {
+    static constexpr auto ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string result;
+    for (size_t i = 0; i < bytes.size(); i += 3) {
+      uint32_t chunk = static_cast<uint32_t>(bytes[i]) << 16;
+      if (i + 1 < bytes.size()) {
+        chunk |= static_cast<uint32_t>(bytes[i + 1]) << 8;
+      }
+      if (i + 2 < bytes.size()) {
+        chunk |= bytes[i + 2];
+      }
+      result += ALPHABET[(chunk >> 18) & 0x3F];
+      result += ALPHABET[(chunk >> 12) & 0x3F];
+      result += i + 1 < bytes.size() ? ALPHABET[(chunk >> 6) & 0x3F] : '=';
+      result += i + 2 < bytes.size() ? ALPHABET[chunk & 0x3F] : '=';
+    }
+    return result;
+  }
+
+  // `bufferUri` is left out for .glb files, which store the buffer in their BIN chunk
+  std::string createGltfJson(const GltfParts& parts, const std::string& bufferUri) {
+    std::string buffer = bufferUri.empty() ? R"({ "byteLength": 44 })" : R"({ "byteLength": 44, "uri": ")" + bufferUri + R"(" })";
+    return R"({ "asset": { "version": "2.0" }, "scene": 0, "scenes": [{ "nodes": [0] }], "nodes": )" + parts.nodes +
+           R"(, "meshes": [{ "primitives": [{ "attributes": { "POSITION": 0 }, "indices": 1 }] }], "accessors": [{ )" +
+           parts.positionAccessor + R"( }, { "bufferView": 1, "componentType": 5123, "type": "SCALAR", "count": 3 }], "bufferViews": [{ )" +
+           parts.positionView + R"( }, { "buffer": 0, "byteOffset": 36, "byteLength": 6 }], "buffers": [)" + buffer + "] }";
+  }
+
+  void appendUint32(std::vector<uint8_t>& bytes, uint32_t value) {
+    uint8_t encoded[sizeof(uint32_t)];
+    std::memcpy(encoded, &value, sizeof(uint32_t));
+    bytes.insert(bytes.end(), encoded, encoded + sizeof(uint32_t));
+  }
+
+  std::vector<uint8_t> createGlb(const std::string& json, const std::vector<uint8_t>& binary) {
+    std::string paddedJson = json;
+    paddedJson.resize((json.size() + 3) / 4 * 4, ' ');
+    std::vector<uint8_t> glb;
+    appendUint32(glb, 0x46546C67); // "glTF"
+    appendUint32(glb, 2);
+    appendUint32(glb, static_cast<uint32_t>(12 + 8 + paddedJson.size() + 8 + binary.size()));
+    appendUint32(glb, static_cast<uint32_t>(paddedJson.size()));
+    appendUint32(glb, 0x4E4F534A); // "JSON"
+    glb.insert(glb.end(), paddedJson.begin(), paddedJson.end());
+    appendUint32(glb, static_cast<uint32_t>(binary.size()));
+    appendUint32(glb, 0x004E4942); // "BIN\0"
+    glb.insert(glb.end(), binary.begin(), binary.end());
+    return glb;
+  }
+
+  std::vector<GltfGeometryReader::Primitive> read(const std::string& text, const std::optional<std::string>& nodeName = std::nullopt) {
+    return GltfGeometryReader::read(reinterpret_cast<const uint8_t*>(text.data()), text.size(), nodeName);
+  }
+
+  bool throwsWhenRead(const std::string& text) {
+    try {
+      read(text);
+      return false;
+    } catch (const std::invalid_argument&) {
+      return true;
+    }
+  }
+
+} // namespace
+
+std::unordered_map<std::string, double> testGltfGeometryReader() {
+  std::vector<uint8_t> buffer = createTriangleBuffer();
+  std::string uri = "data:application/octet-stream;base64," + encodeBase64(buffer);
+  auto createGltf = [&](const GltfParts& parts) { return createGltfJson(parts, uri); };
+
+  std::unordered_map<std::string, double> result;
+  std::vector<GltfGeometryReader::Primitive> primitives = read(createGltf({}));
+  result["primitives"] = static_cast<double>(primitives.size());
+  result["positions"] = primitives.empty() ? 0 : static_cast<double>(primitives[0].positions.size());
+  result["triangleIndices"] = primitives.empty() ? 0 : static_cast<double>(primitives[0].triangleIndices.size());
+  result["translatedX"] = primitives.empty() || primitives[0].positions.empty() ? -1 : primitives[0].positions[0].x;
+  std::vector<GltfGeometryReader::Primitive> nodePrimitives = read(createGltf({}), "triangle");
+  result["nodeSpaceX"] = nodePrimitives.empty() || nodePrimitives[0].positions.empty() ? -1 : nodePrimitives[0].positions[0].x;
+
+  std::vector<uint8_t> glb = createGlb(createGltfJson({}, ""), buffer);
+  std::vector<GltfGeometryReader::Primitive> glbPrimitives = GltfGeometryReader::read(glb.data(), glb.size(), std::nullopt);
+  result["glbPositions"] = glbPrimitives.empty() ? 0 : static_cast<double>(glbPrimitives[0].positions.size());
+
+  // Offsets, counts and strides from the file
+  GltfParts negativeOffset;
+  negativeOffset.positionView = R"("buffer": 0, "byteOffset": -4, "byteLength": 36)";
+  result["negativeOffsetThrew"] = throwsWhenRead(createGltf(negativeOffset));
+  GltfParts hugeOffset;
+  hugeOffset.positionView = R"("buffer": 0, "byteOffset": 1e300, "byteLength": 36)";
+  result["hugeOffsetThrew"] = throwsWhenRead(createGltf(hugeOffset));
+  GltfParts fractionalCount;
+  fractionalCount.positionAccessor = R"("bufferView": 0, "componentType": 5126, "type": "VEC3", "count": 2.5)";
+  result["fractionalCountThrew"] = throwsWhenRead(createGltf(fractionalCount));
+  GltfParts tooManyElements;
+  tooManyElements.positionAccessor = R"("bufferView": 0, "componentType": 5126, "type": "VEC3", "count": 4)";
+  result["tooManyElementsThrew"] = throwsWhenRead(createGltf(tooManyElements));
+  GltfParts overflowingStride;
+  overflowingStride.positionView = R"("buffer": 0, "byteOffset": 0, "byteLength": 36, "byteStride": 4000000000000000)";
+  overflowingStride.positionAccessor = R"("bufferView": 0, "componentType": 5126, "type": "VEC3", "count": 10000)";
+  result["overflowingStrideThrew"] = throwsWhenRead(createGltf(overflowingStride));
+  GltfParts smallStride;
+  smallStride.positionView = R"("buffer": 0, "byteOffset": 0, "byteLength": 36, "byteStride": 4)";
+  result["smallStrideThrew"] = throwsWhenRead(createGltf(smallStride));
+
+  // Unsupported accessors
+  GltfParts sparse;
+  sparse.positionAccessor = R"("bufferView": 0, "componentType": 5126, "type": "VEC3", "count": 3, "sparse": { "count": 1 })";
+  result["sparseThrew"] = throwsWhenRead(createGltf(sparse));
+  GltfParts quantized;
+  quantized.positionAccessor = R"("bufferView": 0, "componentType": 5123, "type": "VEC3", "count": 3)";
+  result["quantizedThrew"] = throwsWhenRead(createGltf(quantized));
+
+  // Node hierarchy
+  GltfParts negativeMesh;
+  negativeMesh.nodes = R"([{ "mesh": -1 }])";
+  result["negativeMeshThrew"] = throwsWhenRead(createGltf(negativeMesh));
+  GltfParts cycle;
+  cycle.nodes = R"([{ "mesh": 0, "children": [1] }, { "children": [0] }])";
+  result["nodeCycleThrew"] = throwsWhenRead(createGltf(cycle));
+
+  // Malformed files
+  result["deepJsonThrew"] = throwsWhenRead(std::string(100, '[') + std::string(100, ']'));
+  result["truncatedJsonThrew"] = throwsWhenRead(createGltf({}).substr(0, 60));
+  std::vector<uint8_t> truncatedGlb(glb.begin(), glb.end() - 8);
+  result["truncatedGlbThrew"] = throwsWhenRead(std::string(truncatedGlb.begin(), truncatedGlb.end()));
+  return result;
+}
+
+} // namespace margelo
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace margelo {
+
+/**
+ * Reads a small triangle glTF (embedded base64 buffer and .glb) with the GltfGeometryReader, and variations of it with
+ * malformed or unsupported content.
+ *
+ * Returns the read primitives, positions and triangle indices of the valid glTF (`primitives`, `positions`,
+ * `triangleIndices`, expected to be 1, 3 and 3), the x of its first position in the scene's space (`translatedX`, 1) and in
+ * the node's own space (`nodeSpaceX`, 0), the positions read from the .glb (`glbPositions`, 3), and for every invalid input
+ * whether reading it threw (keys ending with `Threw`, all expected to be 1).
+ */
+std::unordered_map<std::string, double> testGltfGeometryReader();
+
+} // namespace margelo
@@ -0,0 +1,87 @@
+#include "RNFMappedFileBufferTest.h"
+#include "RNFMappedFileBuffer.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace margelo {
+
+namespace {
+
+  constexpr size_t FILE_SIZE = 4096;
+
+  std::string getTempDirectory() {
+    const char* directory = std::getenv("TMPDIR");
+    if (directory == nullptr || directory[0] == '\0') {
+      [[unlikely]];
+      throw std::runtime_error("Cannot test MappedFileBuffer: TMPDIR is not set!");
+    }
+    return directory;
+  }
+
+  void writeFile(const std::string& path, const std::vector<uint8_t>& content) {
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+      [[unlikely]];
+      throw std::runtime_error("Cannot test MappedFileBuffer: Failed to create \"" + path + "\"!");
+    }
+    size_t written = std::fwrite(content.data(), 1, content.size(), file);
+    std::fclose(file);
+    if (written != content.size()) {
+      [[unlikely]];
+      throw std::runtime_error("Cannot test MappedFileBuffer: Failed to write \"" + path + "\"!");
+    }
+  }
+
+  bool throwsWhenMapped(const std::string& path) {
+    try {
+      MappedFileBuffer buffer(path);
+      return false;
+    } catch (const std::runtime_error&) {
+      return true;
+    }
+  }
+
+} // namespace
+
+std::unordered_map<std::string, double> testMappedFileBuffer() {
+  std::string directory = getTempDirectory();
+  if (directory.back() != '/') {
+    directory += '/';
+  }
+  std::string normalPath = directory + "rnf-mapped-file-test.bin";
+  std::string emptyPath = directory + "rnf-mapped-file-test-empty.bin";
+  std::string missingPath = directory + "rnf-mapped-file-test-missing.bin";
+
+  std::vector<uint8_t> content(FILE_SIZE);
+  for (size_t i = 0; i < content.size(); i++) {
+    content[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+  writeFile(normalPath, content);
+  writeFile(emptyPath, {});
+  std::remove(missingPath.c_str());
+
+  std::unordered_map<std::string, double> result;
+  try {
+    MappedFileBuffer buffer(normalPath);
+    result["size"] = static_cast<double>(buffer.getSize());
+    result["contentMatches"] = buffer.getSize() == content.size() && std::memcmp(buffer.getData(), content.data(), content.size()) == 0;
+    buffer.release();
+    result["released"] = buffer.getData() == nullptr && buffer.getSize() == 0;
+
+    result["emptyThrew"] = throwsWhenMapped(emptyPath);
+    result["missingThrew"] = throwsWhenMapped(missingPath);
+  } catch (...) {
+    std::remove(normalPath.c_str());
+    std::remove(emptyPath.c_str());
+    throw;
+  }
+  std::remove(normalPath.c_str());
+  std::remove(emptyPath.c_str());
+  return result;
+}
+
+} // namespace margelo
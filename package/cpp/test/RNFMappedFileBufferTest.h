@@ -0,0 +1,18 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace margelo {
+
+/**
+ * Maps a normal file, a zero-length file and a file that does not exist with a MappedFileBuffer.
+ * The files are created in the `TMPDIR` directory and deleted again afterwards.
+ *
+ * Returns the size of the mapped normal file (`size`, expected to be 4096), whether its mapped bytes match the written
+ * ones (`contentMatches`), whether releasing it cleared the buffer (`released`), and whether mapping the empty
+ * (`emptyThrew`) and the missing file (`missingThrew`) threw. All flags are 1 or 0.
+ */
+std::unordered_map<std::string, double> testMappedFileBuffer();
+
+} // namespace margelo
@@ -7,27 +7,46 @@ namespace margelo {
 
 void TestHybridObject::loadHybridMethods() {
   // this.int get & set
-  registerHybridGetter("int", &TestHybridObject::getInt, this);
-  registerHybridSetter("int", &TestHybridObject::setInt, this);
+  registerHybridGetter("int", &TestHybridObject::getInt);
+  registerHybridSetter("int", &TestHybridObject::setInt);
   // this.string get & set
-  registerHybridGetter("string", &TestHybridObject::getString, this);
-  registerHybridSetter("string", &TestHybridObject::setString, this);
+  registerHybridGetter("string", &TestHybridObject::getString);
+  registerHybridSetter("string", &TestHybridObject::setString);
   // this.nullableString get & set
-  registerHybridGetter("nullableString", &TestHybridObject::getNullableString, this);
-  registerHybridSetter("nullableString", &TestHybridObject::setNullableString, this);
+  registerHybridGetter("nullableString", &TestHybridObject::getNullableString);
+  registerHybridSetter("nullableString", &TestHybridObject::setNullableString);
   // this.enum
-  registerHybridGetter("enum", &TestHybridObject::getEnum, this);
-  registerHybridSetter("enum", &TestHybridObject::setEnum, this);
+  registerHybridGetter("enum", &TestHybridObject::getEnum);
+  registerHybridSetter("enum", &TestHybridObject::setEnum);
   // methods
-  registerHybridMethod("multipleArguments", &TestHybridObject::multipleArguments, this);
+  registerHybridMethod("multipleArguments", &TestHybridObject::multipleArguments);
+  registerHybridMethod("getPropertyNameConversionsCount", &TestHybridObject::getPropertyNameConversionsCount);
   // callbacks
-  registerHybridMethod("getIntGetter", &TestHybridObject::getIntGetter, this);
-  registerHybridMethod("sayHelloCallback", &TestHybridObject::sayHelloCallback, this);
+  registerHybridMethod("getIntGetter", &TestHybridObject::getIntGetter);
+  registerHybridMethod("sayHelloCallback", &TestHybridObject::sayHelloCallback);
   // custom types
-  registerHybridMethod("createNewHybridObject", &TestHybridObject::createNewHybridObject, this);
+  registerHybridMethod("createNewHybridObject", &TestHybridObject::createNewHybridObject);
   // Promises
-  registerHybridMethod("calculateFibonacci", &TestHybridObject::calculateFibonacci, this);
-  registerHybridMethod("calculateFibonacciAsync", &TestHybridObject::calculateFibonacciAsync, this);
+  registerHybridMethod("calculateFibonacci", &TestHybridObject::calculateFibonacci);
+  registerHybridMethod("calculateFibonacciAsync", &TestHybridObject::calculateFibonacciAsync);
+  // Arrays
+  registerHybridMethod("sumNumbers", &TestHybridObject::sumNumbers);
+  registerHybridMethod("sumFloat32Array", &TestHybridObject::sumFloat32Array);
+  registerHybridMethod("createFloat32Array", &TestHybridObject::createFloat32Array);
+  // Threading
+  registerHybridMethod("benchmarkDispatchers", &TestHybridObject::benchmarkDispatchers);
+  // Animation
+  registerHybridMethod("benchmarkTransformSync", &TestHybridObject::benchmarkTransformSync);
+  registerHybridMethod("benchmarkAnimationBatch", &TestHybridObject::benchmarkAnimationBatch);
+  registerHybridMethod("benchmarkBulletWorld", &TestHybridObject::benchmarkBulletWorld);
+  registerHybridMethod("benchmarkBulkRigidBodies", &TestHybridObject::benchmarkBulkRigidBodies);
+  registerHybridMethod("benchmarkPhysicsSnapshot", &TestHybridObject::benchmarkPhysicsSnapshot);
+  registerHybridMethod("benchmarkChangedBodies", &TestHybridObject::benchmarkChangedBodies);
+  registerHybridMethod("testBakedAnimationRoundTrip", &TestHybridObject::testBakedAnimationRoundTrip);
+  // Loading
+  registerHybridMethod("testMappedFileBuffer", &TestHybridObject::testMappedFileBuffer);
+  registerHybridMethod("testGltfGeometryReader", &TestHybridObject::testGltfGeometryReader);
+  registerHybridMethod("createTestBufferLoader", &TestHybridObject::createTestBufferLoader);
 }
 
 } // namespace margelo
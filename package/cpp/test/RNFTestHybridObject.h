@@ -4,8 +4,19 @@
 
 #pragma once
 
+#include "RNFAnimationBatchBenchmark.h"
+#include "RNFBakedAnimationTest.h"
+#include "RNFBulletWorldBenchmark.h"
+#include "RNFDispatcherBenchmark.h"
+#include "RNFGltfGeometryReaderTest.h"
+#include "RNFMappedFileBufferTest.h"
+#include "RNFTransformSyncBenchmark.h"
 #include "RNFTestEnum.h"
+// Note: Has to be included after RNFTestEnum.h, so the JSIConverter sees its EnumMapper
+#include "RNFChunkedBufferLoaderWrapper.h"
+#include "RNFGeneratedChunkSource.h"
 #include "jsi/RNFHybridObject.h"
+#include "threading/RNFDispatcher.h"
 #include <optional>
 #include <string>
 #include <vector>
@@ -14,7 +25,7 @@ namespace margelo {
 
 class TestHybridObject : public HybridObject {
 public:
-  explicit TestHybridObject() : HybridObject("TestHybridObject") {}
+  explicit TestHybridObject(std::shared_ptr<Dispatcher> dispatcher) : HybridObject("TestHybridObject"), _dispatcher(dispatcher) {}
 
 public:
   int getInt() {
@@ -46,6 +57,10 @@ public:
     return std::unordered_map<std::string, double>{{"first", 5312}, {"second", 532233}, {"third", 2786}};
   }
 
+  double getPropertyNameConversionsCount() {
+    return static_cast<double>(HybridObject::getPropertyNameConversionsCount());
+  }
+
   std::function<int()> getIntGetter() {
     return [this]() -> int { return this->_int; };
   }
@@ -53,7 +68,7 @@ public:
     callback("Test Hybrid");
   }
   std::shared_ptr<TestHybridObject> createNewHybridObject() {
-    return std::make_shared<TestHybridObject>();
+    return std::make_shared<TestHybridObject>(_dispatcher);
   }
 
   uint64_t calculateFibonacci(int count) {
@@ -78,10 +93,71 @@ public:
   }
 
   std::future<uint64_t> calculateFibonacciAsync(int count) {
-    return std::async(std::launch::async, [count, this]() { return this->calculateFibonacci(count); });
+    return _dispatcher->runAsyncAwaitable<uint64_t>([count, this]() { return this->calculateFibonacci(count); });
+  }
+
+  double sumNumbers(std::vector<double> numbers) {
+    double sum = 0;
+    for (double number : numbers) {
+      sum += number;
+    }
+    return sum;
+  }
+  double sumFloat32Array(TypedArrayView<float> numbers) {
+    double sum = 0;
+    for (float number : numbers) {
+      sum += number;
+    }
+    return sum;
+  }
+  std::shared_ptr<TypedArray<float>> createFloat32Array(int size) {
+    auto array = std::make_shared<TypedArray<float>>(size);
+    for (int i = 0; i < size; i++) {
+      array->elements()[i] = static_cast<float>(i);
+    }
+    return array;
+  }
+
+  std::unordered_map<std::string, double> benchmarkDispatchers(int jobsCount, int producersCount) {
+    return margelo::benchmarkDispatchers(jobsCount, producersCount);
+  }
+  std::unordered_map<std::string, double> benchmarkTransformSync(int instancesCount, int bonesCount, int framesCount) {
+    return margelo::benchmarkTransformSync(instancesCount, bonesCount, framesCount);
+  }
+  std::unordered_map<std::string, double> benchmarkAnimationBatch(int instancesCount, int bonesCount, int framesCount) {
+    return margelo::benchmarkAnimationBatch(instancesCount, bonesCount, framesCount);
+  }
+  std::unordered_map<std::string, double> benchmarkBulletWorld(int bodiesCount, int framesCount) {
+    return margelo::benchmarkBulletWorld(bodiesCount, framesCount);
+  }
+  std::unordered_map<std::string, double> benchmarkBulkRigidBodies(int bodiesCount) {
+    return margelo::benchmarkBulkRigidBodies(bodiesCount);
+  }
+  std::unordered_map<std::string, double> benchmarkPhysicsSnapshot(int bodiesCount) {
+    return margelo::benchmarkPhysicsSnapshot(bodiesCount);
+  }
+  std::unordered_map<std::string, double> benchmarkChangedBodies(int bodiesCount) {
+    return margelo::benchmarkChangedBodies(bodiesCount);
+  }
+  std::unordered_map<std::string, double> testBakedAnimationRoundTrip() {
+    return margelo::testBakedAnimationRoundTrip();
+  }
+  std::unordered_map<std::string, double> testMappedFileBuffer() {
+    return margelo::testMappedFileBuffer();
+  }
+  std::unordered_map<std::string, double> testGltfGeometryReader() {
+    return margelo::testGltfGeometryReader();
+  }
+
+  std::shared_ptr<ChunkedBufferLoaderWrapper> createTestBufferLoader(int size, int chunkSize, double chunkDelayMs) {
+    auto chunkDelay = std::chrono::microseconds(static_cast<int64_t>(chunkDelayMs * 1000));
+    auto source = std::make_unique<GeneratedChunkSource>(size, chunkDelay);
+    auto loader = std::make_shared<ChunkedBufferLoader>(std::move(source), chunkSize, _dispatcher);
+    return std::make_shared<ChunkedBufferLoaderWrapper>(loader);
   }
 
 private:
+  std::shared_ptr<Dispatcher> _dispatcher;
   int _int;
   std::string _string;
   TestEnum _enum;
@@ -0,0 +1,90 @@
+#include "RNFTransformSyncBenchmark.h"
+#include "core/RNFTransformSyncList.h"
+
+#include <filament/Engine.h>
+#include <filament/TransformManager.h>
+#include <math/mat4.h>
+#include <utils/EntityManager.h>
+
+#include <chrono>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+namespace margelo {
+
+using namespace filament;
+using namespace utils;
+
+using EntityNameMap = std::map<std::string, Entity>;
+
+template <typename Function> static double measureFrames(TransformManager& transformManager, int framesCount, Function&& syncFrame) {
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < framesCount; frame++) {
+    transformManager.openLocalTransformTransaction();
+    syncFrame();
+    transformManager.commitLocalTransformTransaction();
+  }
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / framesCount;
+}
+
+std::unordered_map<std::string, double> benchmarkTransformSync(int instancesCount, int bonesCount, int framesCount) {
+  if (instancesCount < 1 || bonesCount < 1 || framesCount < 1) [[unlikely]] {
+    throw std::invalid_argument("Cannot benchmark " + std::to_string(instancesCount) + " instances with " + std::to_string(bonesCount) +
+                                " bones over " + std::to_string(framesCount) + " frames!");
+  }
+
+  Engine* engine = Engine::create(Engine::Backend::NOOP);
+  TransformManager& transformManager = engine->getTransformManager();
+  EntityManager& entityManager = EntityManager::get();
+
+  // The master instance and all synced instances share the same bone names
+  std::vector<Entity> entities(static_cast<size_t>(bonesCount) * (instancesCount + 1));
+  entityManager.create(entities.size(), entities.data());
+  for (size_t i = 0; i < entities.size(); i++) {
+    transformManager.create(entities[i], {}, math::mat4f::translation(math::float3(static_cast<float>(i), 0, 0)));
+  }
+  auto getBone = [&](int instance, int bone) { return entities[static_cast<size_t>(instance) * bonesCount + bone]; };
+
+  EntityNameMap masterEntityMap;
+  std::vector<EntityNameMap> instanceEntityMaps(instancesCount);
+  std::vector<TransformSyncList> syncLists(instancesCount);
+  for (int bone = 0; bone < bonesCount; bone++) {
+    masterEntityMap["bone_" + std::to_string(bone)] = getBone(0, bone);
+  }
+  for (int instance = 0; instance < instancesCount; instance++) {
+    for (int bone = 0; bone < bonesCount; bone++) {
+      Entity target = getBone(instance + 1, bone);
+      instanceEntityMaps[instance]["bone_" + std::to_string(bone)] = target;
+      syncLists[instance].add(transformManager, getBone(0, bone), target);
+    }
+  }
+
+  std::unordered_map<std::string, double> results;
+  results["nameMap"] = measureFrames(transformManager, framesCount, [&]() {
+    for (int instance = 0; instance < instancesCount; instance++) {
+      EntityNameMap entityNameMap = instanceEntityMaps[instance];
+      for (auto const& [name, masterEntity] : masterEntityMap) {
+        Entity instanceEntity = entityNameMap[name];
+        TransformManager::Instance masterTransform = transformManager.getInstance(masterEntity);
+        TransformManager::Instance instanceTransform = transformManager.getInstance(instanceEntity);
+        transformManager.setTransform(instanceTransform, transformManager.getTransform(masterTransform));
+      }
+    }
+  });
+  results["syncList"] = measureFrames(transformManager, framesCount, [&]() {
+    for (TransformSyncList& syncList : syncLists) {
+      syncList.sync(transformManager);
+    }
+  });
+
+  for (Entity entity : entities) {
+    transformManager.destroy(entity);
+  }
+  entityManager.destroy(entities.size(), entities.data());
+  Engine::destroy(&engine);
+  return results;
+}
+
+} // namespace margelo
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+namespace margelo {
+
+/**
+ * Measures how long it takes to sync the transforms of `bonesCount` bones from one master instance to `instancesCount`
+ * instances, like `AnimatorWrapper::syncInstances` does every frame. Runs on a Filament Engine with the NOOP backend.
+ *
+ * - `nameMap`: Copies every instance's `std::map<std::string, Entity>` and looks up each bone by name, then resolves both
+ *   transform instances (how `AnimatorWrapper` used to sync)
+ * - `syncList`: Copies the transforms through precomputed `TransformSyncList`s (how `AnimatorWrapper` syncs now)
+ *
+ * Returns the average milliseconds per frame of each approach over `framesCount` frames, keyed by the names above.
+ */
+std::unordered_map<std::string, double> benchmarkTransformSync(int instancesCount, int bonesCount, int framesCount);
+
+} // namespace margelo
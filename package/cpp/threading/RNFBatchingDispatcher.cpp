@@ -0,0 +1,121 @@
+#include "RNFBatchingDispatcher.h"
+#include "RNFLogger.h"
+#include <condition_variable>
+#include <exception>
+#include <iterator>
+#include <mutex>
+
+namespace margelo {
+
+void BatchingDispatcher::runAsync(std::function<void()>&& function) {
+  if (_isOverflowing.load(std::memory_order_acquire) || !_jobs.tryPush(std::move(function))) [[unlikely]] {
+    // The ring is full. Waiting for a slot could deadlock if we are the Thread that drains it, so queue it unbounded.
+    std::unique_lock lock(_overflowMutex);
+    _isOverflowing.store(true, std::memory_order_release);
+    _overflow.push_back(std::move(function));
+  }
+
+  if (!_isDrainScheduled.exchange(true, std::memory_order_acq_rel)) {
+    scheduleDrain();
+  }
+}
+
+void BatchingDispatcher::runSync(std::function<void()>&& function) {
+  if (isDrainingThread()) {
+    // Already on the Dispatcher's Thread, waiting for ourselves would deadlock.
+    function();
+    return;
+  }
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  bool isDone = false;
+  std::exception_ptr error;
+
+  runAsync([&]() {
+    try {
+      function();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    // Notify while holding the lock, otherwise the waiter could return and destroy `condition` before we notify it.
+    std::unique_lock lock(mutex);
+    isDone = true;
+    condition.notify_one();
+  });
+
+  std::unique_lock lock(mutex);
+  condition.wait(lock, [&]() { return isDone; });
+  if (error != nullptr) {
+    std::rethrow_exception(error);
+  }
+}
+
+size_t BatchingDispatcher::drain() {
+  size_t jobsCount = 0;
+  while (true) {
+    jobsCount += runPendingJobs();
+
+    // Allow the next runAsync() to schedule a new drain. This also makes all jobs pushed before it visible to us.
+    _isDrainScheduled.exchange(false, std::memory_order_acq_rel);
+    if (_jobs.isEmpty() && !_isOverflowing.load(std::memory_order_acquire)) {
+      break;
+    }
+    // A job arrived between our last pop and clearing the flag. If its producer already scheduled a new drain,
+    // leave the rest to that one, otherwise keep going ourselves.
+    if (_isDrainScheduled.exchange(true, std::memory_order_acq_rel)) {
+      break;
+    }
+  }
+  return jobsCount;
+}
+
+size_t BatchingDispatcher::runPendingJobs() {
+  std::thread::id previousThread = _drainingThread.exchange(std::this_thread::get_id(), std::memory_order_relaxed);
+  size_t jobsCount = 0;
+  std::function<void()> job;
+  while (true) {
+    while (_jobs.tryPop(job)) {
+      runJob(job);
+      jobsCount++;
+    }
+    if (!_isOverflowing.load(std::memory_order_acquire)) {
+      break;
+    }
+
+    std::vector<std::function<void()>> overflow;
+    {
+      std::unique_lock lock(_overflowMutex);
+      // Jobs that are still in the ring were pushed before the overflowing ones, so they run first.
+      while (_jobs.tryPop(job)) {
+        overflow.push_back(std::move(job));
+      }
+      overflow.insert(overflow.end(), std::make_move_iterator(_overflow.begin()), std::make_move_iterator(_overflow.end()));
+      _overflow.clear();
+      _isOverflowing.store(false, std::memory_order_release);
+    }
+    for (std::function<void()>& overflowJob : overflow) {
+      runJob(overflowJob);
+      jobsCount++;
+    }
+  }
+  _drainingThread.store(previousThread, std::memory_order_relaxed);
+  return jobsCount;
+}
+
+void BatchingDispatcher::runJob(std::function<void()>& job) {
+  try {
+    job();
+  } catch (const std::exception& exception) {
+    Logger::log(TAG, "Job threw an error: %s", exception.what());
+  } catch (...) {
+    Logger::log(TAG, "Job threw an unknown error!");
+  }
+  job = nullptr;
+}
+
+bool BatchingDispatcher::isDrainingThread() const {
+  return _drainingThread.load(std::memory_order_relaxed) == std::this_thread::get_id();
+}
+
+} // namespace margelo
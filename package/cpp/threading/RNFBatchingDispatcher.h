@@ -0,0 +1,63 @@
+#pragma once
+
+#include "RNFDispatcher.h"
+#include "RNFMPSCQueue.h"
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace margelo {
+
+/**
+ * A Dispatcher that collects jobs in a lock-free MPSC ring and runs them in batches.
+ *
+ * Producers never take a lock. Only the first job that arrives while no drain is scheduled asks the
+ * implementation to wake up its Thread (`scheduleDrain()`), and that single wake-up then runs every job
+ * that is pending at that point, including the ones that arrive while it is draining.
+ * If the ring is full, jobs go to a mutex-guarded overflow list instead, so `runAsync()` never blocks - not even
+ * when it is called from the Thread that is supposed to drain the ring.
+ */
+class BatchingDispatcher : public Dispatcher {
+public:
+  static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+  explicit BatchingDispatcher(size_t capacity = DEFAULT_CAPACITY) : _jobs(capacity) {}
+
+public:
+  void runAsync(std::function<void()>&& function) override;
+  void runSync(std::function<void()>&& function) override;
+
+protected:
+  /**
+   * Wake up the Thread this Dispatcher is managing so it calls `drain()`.
+   * This is called at most once until the next `drain()` started, and may be called from any Thread.
+   */
+  virtual void scheduleDrain() = 0;
+
+  /**
+   * Runs all pending jobs on the calling Thread and returns the number of jobs that ran.
+   * Must only be called in response to `scheduleDrain()`.
+   */
+  size_t drain();
+
+private:
+  bool isDrainingThread() const;
+  size_t runPendingJobs();
+  void runJob(std::function<void()>& job);
+
+private:
+  MPSCQueue<std::function<void()>> _jobs;
+  std::atomic<bool> _isDrainScheduled{false};
+  std::atomic<std::thread::id> _drainingThread;
+  // Once a job went to the overflow list, all following jobs do too until it is drained, to keep the FIFO order.
+  std::atomic<bool> _isOverflowing{false};
+  std::mutex _overflowMutex;
+  std::vector<std::function<void()>> _overflow;
+
+private:
+  static constexpr auto TAG = "BatchingDispatcher";
+};
+
+} // namespace margelo
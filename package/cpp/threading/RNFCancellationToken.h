@@ -0,0 +1,37 @@
+#pragma once
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+namespace margelo {
+
+class CancellationError : public std::runtime_error {
+public:
+  explicit CancellationError(const std::string& message) : std::runtime_error(message) {}
+};
+
+// A flag that cooperatively cancels long running work: One Thread calls `cancel()`, and the Thread doing
+// the work checks `throwIfCancelled()` between its steps, unwinding (and freeing) whatever it has done so far.
+class CancellationToken {
+public:
+  void cancel() {
+    _isCancelled.store(true, std::memory_order_release);
+  }
+
+  bool isCancelled() const {
+    return _isCancelled.load(std::memory_order_acquire);
+  }
+
+  void throwIfCancelled(const std::string& message = "The operation has been cancelled!") const {
+    if (isCancelled()) {
+      [[unlikely]];
+      throw CancellationError(message);
+    }
+  }
+
+private:
+  std::atomic<bool> _isCancelled{false};
+};
+
+} // namespace margelo
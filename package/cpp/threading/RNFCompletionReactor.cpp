@@ -0,0 +1,73 @@
+#include "RNFCompletionReactor.h"
+#include "RNFLogger.h"
+#include <algorithm>
+
+namespace margelo {
+
+CompletionReactor& CompletionReactor::getShared() {
+  // Intentionally leaked, the reactor Thread runs until the process exits.
+  static CompletionReactor* shared = new CompletionReactor();
+  return *shared;
+}
+
+void CompletionReactor::notify() {
+  getShared().wakeUp();
+}
+
+void CompletionReactor::wakeUp() {
+  {
+    std::unique_lock lock(_mutex);
+    _isNotified = true;
+  }
+  _condition.notify_one();
+}
+
+void CompletionReactor::add(Job&& job) {
+  {
+    std::unique_lock lock(_mutex);
+    _incomingJobs.push_back(std::move(job));
+    if (!_isRunning) {
+      [[unlikely]];
+      Logger::log(TAG, "Starting CompletionReactor Thread...");
+      _isRunning = true;
+      std::thread([this]() { run(); }).detach();
+    }
+  }
+  _condition.notify_one();
+}
+
+void CompletionReactor::run() {
+  std::vector<Job> pendingJobs;
+  auto pollInterval = MIN_POLL_INTERVAL;
+
+  while (true) {
+    {
+      std::unique_lock lock(_mutex);
+      if (pendingJobs.empty()) {
+        // Nothing to check - sleep until a new future gets watched.
+        _condition.wait(lock, [this]() { return !_incomingJobs.empty(); });
+      } else {
+        _condition.wait_for(lock, pollInterval, [this]() { return _isNotified || !_incomingJobs.empty(); });
+      }
+
+      bool didWakeUp = _isNotified || !_incomingJobs.empty();
+      pollInterval = didWakeUp ? MIN_POLL_INTERVAL : std::min(pollInterval * 2, MAX_POLL_INTERVAL);
+      _isNotified = false;
+      std::move(_incomingJobs.begin(), _incomingJobs.end(), std::back_inserter(pendingJobs));
+      _incomingJobs.clear();
+    }
+
+    // Check all pending futures without holding the lock, so producers never wait for us.
+    auto firstReady = std::partition(pendingJobs.begin(), pendingJobs.end(), [](const Job& job) { return !job.isReady(); });
+    for (auto job = firstReady; job != pendingJobs.end(); ++job) {
+      try {
+        job->onReady();
+      } catch (const std::exception& exception) {
+        Logger::log(TAG, "Failed to complete a future: %s", exception.what());
+      }
+    }
+    pendingJobs.erase(firstReady, pendingJobs.end());
+  }
+}
+
+} // namespace margelo
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace margelo {
+
+/**
+ * Waits for many `std::future`s on a single background Thread, and calls a callback once each of them completed.
+ *
+ * `std::future` has no continuations, so the reactor checks its pending futures whenever it gets notified (see `notify()`),
+ * and otherwise polls them with an exponential backoff. While nothing is pending, the Thread sleeps.
+ */
+class CompletionReactor {
+public:
+  /**
+   * Get the process-wide reactor. Its Thread is started on first use and lives as long as the process.
+   */
+  static CompletionReactor& getShared();
+
+  /**
+   * Calls `onReady` on the reactor Thread once the given future is ready (or deferred).
+   * `onReady` should only hand off the result (e.g. to a Dispatcher), as it blocks all other completions while running.
+   */
+  template <typename T> void watch(std::shared_ptr<std::future<T>> future, std::function<void()>&& onReady) {
+    add(Job{.isReady = [future = std::move(future)]() { return future->wait_for(std::chrono::seconds(0)) != std::future_status::timeout; },
+            .onReady = std::move(onReady)});
+  }
+
+  /**
+   * Wakes up the reactor to check its pending futures now.
+   * Producers should call this right after completing a future that might be watched, to avoid the polling delay.
+   */
+  static void notify();
+
+private:
+  struct Job {
+    std::function<bool()> isReady;
+    std::function<void()> onReady;
+  };
+
+  CompletionReactor() = default;
+  void add(Job&& job);
+  void wakeUp();
+  void run();
+
+private:
+  static constexpr auto TAG = "CompletionReactor";
+  static constexpr auto MIN_POLL_INTERVAL = std::chrono::milliseconds(1);
+  static constexpr auto MAX_POLL_INTERVAL = std::chrono::milliseconds(16);
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::vector<Job> _incomingJobs;
+  bool _isNotified = false;
+  bool _isRunning = false;
+};
+
+} // namespace margelo
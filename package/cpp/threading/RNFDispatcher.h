@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "RNFCompletionReactor.h"
 #include <functional>
 #include <future>
 #include <jsi/jsi.h>
@@ -63,6 +64,8 @@ public:
         // 5.b. Reject the Promise if the call failed
         promise->set_exception(std::current_exception());
       }
+      // 6. Wake up anyone waiting for this future through the CompletionReactor
+      CompletionReactor::notify();
     });
 
     // 3. Return an open future that gets resolved later by the dispatcher Thread
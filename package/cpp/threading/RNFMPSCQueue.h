@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace margelo {
+
+/**
+ * A bounded, lock-free multi-producer/single-consumer ring buffer.
+ *
+ * Every slot carries a sequence number that tells producers and the consumer whether it is free or filled,
+ * so pushing is a single CAS on the tail and popping needs no atomic read-modify-write at all.
+ * Only one thread may call `tryPop` at a time; any number of threads may call `tryPush` concurrently.
+ */
+template <typename T> class MPSCQueue {
+public:
+  explicit MPSCQueue(size_t capacity) : _capacity(capacity), _mask(capacity - 1), _slots(new Slot[capacity]) {
+    if (capacity < 2 || (capacity & (capacity - 1)) != 0) [[unlikely]] {
+      throw std::invalid_argument("MPSCQueue capacity has to be a power of two, but was " + std::to_string(capacity) + "!");
+    }
+    for (size_t i = 0; i < capacity; i++) {
+      _slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+  ~MPSCQueue() {
+    T ignored;
+    while (tryPop(ignored)) {
+    }
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+public:
+  /**
+   * Push the given value into the queue. Returns false (and leaves `value` untouched) if the queue is full.
+   */
+  bool tryPush(T&& value) {
+    size_t position = _tail.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = _slots[position & _mask];
+      size_t sequence = slot.sequence.load(std::memory_order_acquire);
+      intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+      if (difference == 0) {
+        // Slot is free - try to claim it
+        if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          new (&slot.storage) T(std::move(value));
+          // Publish the value to the consumer
+          slot.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        // The consumer has not freed this slot yet, the queue is full
+        return false;
+      } else {
+        // Another producer claimed this slot, retry with the new tail
+        position = _tail.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * Pop the oldest value from the queue. Returns false if the queue is empty. Must only be called by the consumer.
+   */
+  bool tryPop(T& value) {
+    size_t head = _head.load(std::memory_order_relaxed);
+    Slot& slot = _slots[head & _mask];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence != head + 1) {
+      // Either empty, or a producer claimed the slot but hasn't finished writing it yet
+      return false;
+    }
+    T* element = std::launder(reinterpret_cast<T*>(&slot.storage));
+    value = std::move(*element);
+    element->~T();
+    // Hand the slot back to producers for the next lap around the ring
+    slot.sequence.store(head + _capacity, std::memory_order_release);
+    _head.store(head + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * Whether the queue currently looks empty from the consumer's point of view.
+   * This may race with `tryPop` (e.g. to hand off consumption to another Thread), but the result is only a snapshot then.
+   */
+  bool isEmpty() const {
+    size_t head = _head.load(std::memory_order_relaxed);
+    const Slot& slot = _slots[head & _mask];
+    return slot.sequence.load(std::memory_order_acquire) != head + 1;
+  }
+
+  size_t capacity() const {
+    return _capacity;
+  }
+
+private:
+  // Keep the producer-shared tail and the consumer-owned head on separate cache lines.
+  static constexpr size_t CACHE_LINE_SIZE = 64;
+
+  struct Slot {
+    std::atomic<size_t> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+private:
+  const size_t _capacity;
+  const size_t _mask;
+  std::unique_ptr<Slot[]> _slots;
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> _tail{0};
+  // Only written by the consumer, atomic so `isEmpty()` can be read while ownership is handed over
+  alignas(CACHE_LINE_SIZE) std::atomic<size_t> _head{0};
+};
+
+} // namespace margelo
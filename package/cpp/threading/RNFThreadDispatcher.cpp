@@ -0,0 +1,58 @@
+#include "RNFThreadDispatcher.h"
+#include "RNFLogger.h"
+#include <pthread.h>
+
+namespace margelo {
+
+// Linux limits Thread names to 15 characters + '\0'
+static constexpr size_t MAX_THREAD_NAME_LENGTH = 15;
+
+ThreadDispatcher::ThreadDispatcher(const std::string& name, size_t capacity) : BatchingDispatcher(capacity), _name(name) {
+  // Start the Thread last, after all members it uses are initialized
+  _thread = std::thread([this]() { runLoop(); });
+}
+
+ThreadDispatcher::~ThreadDispatcher() {
+  {
+    std::unique_lock lock(_mutex);
+    _isRunning = false;
+  }
+  _condition.notify_one();
+  // Runs all jobs that are still pending, then stops.
+  _thread.join();
+}
+
+void ThreadDispatcher::scheduleDrain() {
+  {
+    std::unique_lock lock(_mutex);
+    _hasPendingDrain = true;
+  }
+  _condition.notify_one();
+}
+
+void ThreadDispatcher::runLoop() {
+  std::string threadName = _name.substr(0, MAX_THREAD_NAME_LENGTH);
+#if defined(__APPLE__)
+  pthread_setname_np(threadName.c_str());
+#else
+  pthread_setname_np(pthread_self(), threadName.c_str());
+#endif
+  Logger::log(TAG, "Thread \"%s\" started!", _name.c_str());
+
+  while (true) {
+    {
+      std::unique_lock lock(_mutex);
+      _condition.wait(lock, [this]() { return _hasPendingDrain || !_isRunning; });
+      if (!_hasPendingDrain) {
+        // Stopped and nothing left to run
+        break;
+      }
+      _hasPendingDrain = false;
+    }
+    drain();
+  }
+
+  Logger::log(TAG, "Thread \"%s\" stopped!", _name.c_str());
+}
+
+} // namespace margelo
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "RNFBatchingDispatcher.h"
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace margelo {
+
+/**
+ * A [Dispatcher] that runs its own `std::thread` event loop, e.g. for platforms without a native run loop.
+ * The Thread sleeps on a condition variable and drains all pending jobs per wake-up.
+ * The Dispatcher must not be destroyed by one of its own jobs, as the destructor joins the Thread.
+ */
+class ThreadDispatcher : public BatchingDispatcher {
+public:
+  explicit ThreadDispatcher(const std::string& name, size_t capacity = DEFAULT_CAPACITY);
+  ~ThreadDispatcher() override;
+
+protected:
+  void scheduleDrain() override;
+
+private:
+  void runLoop();
+
+private:
+  std::string _name;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _hasPendingDrain = false;
+  bool _isRunning = true;
+  std::thread _thread;
+
+private:
+  static constexpr auto TAG = "ThreadDispatcher";
+};
+
+} // namespace margelo
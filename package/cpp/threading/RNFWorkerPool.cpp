@@ -0,0 +1,127 @@
+#include "RNFWorkerPool.h"
+#include "RNFLogger.h"
+#include <algorithm>
+#include <pthread.h>
+
+namespace margelo {
+
+// Linux limits Thread names to 15 characters + '\0'
+static constexpr size_t MAX_THREAD_NAME_LENGTH = 15;
+
+WorkerPool::WorkerPool(const std::string& name, size_t threadsCount) : _name(name) {
+  _threads.reserve(threadsCount);
+  for (size_t i = 0; i < threadsCount; i++) {
+    _threads.emplace_back([this, i]() { runLoop(i); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::unique_lock lock(_mutex);
+    _isRunning = false;
+  }
+  _wakeCondition.notify_all();
+  for (std::thread& thread : _threads) {
+    thread.join();
+  }
+}
+
+size_t WorkerPool::getDefaultThreadsCount() {
+  unsigned int coresCount = std::max(std::thread::hardware_concurrency(), 1u);
+  return coresCount - 1;
+}
+
+void WorkerPool::parallelFor(size_t count, const std::function<void(size_t index)>& function) {
+  if (count == 0) {
+    return;
+  }
+  if (count == 1 || _threads.empty()) {
+    // Waking up the workers would cost more than it saves
+    for (size_t i = 0; i < count; i++) {
+      function(i);
+    }
+    return;
+  }
+
+  std::unique_lock loopLock(_loopMutex);
+  {
+    std::unique_lock lock(_mutex);
+    _function = &function;
+    _count = count;
+    _nextIndex.store(0, std::memory_order_relaxed);
+    _pendingThreadsCount = _threads.size();
+    _error = nullptr;
+    _generation++;
+  }
+  _wakeCondition.notify_all();
+
+  runIndices();
+
+  std::exception_ptr error;
+  {
+    std::unique_lock lock(_mutex);
+    // Workers that woke up late still have to check in, `function` must outlive their last access.
+    _doneCondition.wait(lock, [this]() { return _pendingThreadsCount == 0; });
+    _function = nullptr;
+    error = _error;
+    _error = nullptr;
+  }
+  if (error != nullptr) {
+    [[unlikely]];
+    std::rethrow_exception(error);
+  }
+}
+
+void WorkerPool::runIndices() {
+  while (true) {
+    size_t index = _nextIndex.fetch_add(1, std::memory_order_relaxed);
+    if (index >= _count) {
+      return;
+    }
+    try {
+      (*_function)(index);
+    } catch (...) {
+      std::unique_lock lock(_mutex);
+      if (_error == nullptr) {
+        _error = std::current_exception();
+      }
+    }
+  }
+}
+
+void WorkerPool::runLoop(size_t threadIndex) {
+  std::string threadName = (_name + "." + std::to_string(threadIndex)).substr(0, MAX_THREAD_NAME_LENGTH);
+#if defined(__APPLE__)
+  pthread_setname_np(threadName.c_str());
+#else
+  pthread_setname_np(pthread_self(), threadName.c_str());
+#endif
+  Logger::log(TAG, "Thread \"%s\" started!", threadName.c_str());
+
+  uint64_t lastGeneration = 0;
+  while (true) {
+    {
+      std::unique_lock lock(_mutex);
+      _wakeCondition.wait(lock, [&]() { return _generation != lastGeneration || !_isRunning; });
+      if (!_isRunning) {
+        break;
+      }
+      lastGeneration = _generation;
+    }
+
+    runIndices();
+
+    bool isLastThread;
+    {
+      std::unique_lock lock(_mutex);
+      isLastThread = --_pendingThreadsCount == 0;
+    }
+    if (isLastThread) {
+      _doneCondition.notify_one();
+    }
+  }
+
+  Logger::log(TAG, "Thread \"%s\" stopped!", threadName.c_str());
+}
+
+} // namespace margelo
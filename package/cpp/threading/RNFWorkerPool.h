@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace margelo {
+
+/**
+ * A fixed set of worker Threads that run data-parallel loops, similar to Filament's `JobSystem::parallel_for`.
+ * The calling Thread takes part in every loop, so a pool without any Threads simply runs the loop serially.
+ * Only one loop runs at a time, concurrent `parallelFor` calls wait for each other.
+ */
+class WorkerPool {
+public:
+  explicit WorkerPool(const std::string& name, size_t threadsCount);
+  ~WorkerPool();
+
+  /**
+   * Calls `function` once for every index in [0, count), spread over the pool's Threads and the calling Thread,
+   * and returns once all calls have finished. If any call throws, the first error is rethrown after all calls finished.
+   */
+  void parallelFor(size_t count, const std::function<void(size_t index)>& function);
+
+  size_t getThreadsCount() const {
+    return _threads.size();
+  }
+
+  /**
+   * The number of worker Threads to use for CPU-bound work on this device: One less than the number of cores,
+   * as the calling Thread takes part as well.
+   */
+  static size_t getDefaultThreadsCount();
+
+private:
+  void runLoop(size_t threadIndex);
+  void runIndices();
+
+private:
+  std::string _name;
+  std::vector<std::thread> _threads;
+  // Only one loop at a time
+  std::mutex _loopMutex;
+
+  std::mutex _mutex;
+  std::condition_variable _wakeCondition;
+  std::condition_variable _doneCondition;
+  bool _isRunning = true;
+  // Incremented for every loop, workers compare it to the last loop they ran
+  uint64_t _generation = 0;
+  size_t _pendingThreadsCount = 0;
+  std::exception_ptr _error;
+
+  // The current loop, published to the workers under `_mutex`
+  const std::function<void(size_t)>* _function = nullptr;
+  size_t _count = 0;
+  std::atomic<size_t> _nextIndex{0};
+
+private:
+  static constexpr auto TAG = "WorkerPool";
+};
+
+} // namespace margelo
@@ -0,0 +1,25 @@
+import { useEffect, useMemo } from 'react'
+import { useFilamentContext } from '../../hooks/useFilamentContext'
+import { BulletAPI } from '../bulletApi'
+import { DiscreteDynamicWorld } from '../types/DiscreteDynamicWorld'
+
+/**
+ * Creates a {@linkcode PhysicsClock} for the world that runs while the component is mounted.
+ * @param fixedTimeStep The time the world advances per step, in seconds @default 1/60
+ */
+export function usePhysicsClock(world: DiscreteDynamicWorld, fixedTimeStep?: number) {
+  const { choreographer } = useFilamentContext()
+  const clock = useMemo(
+    () => BulletAPI.createPhysicsClock(world, choreographer, fixedTimeStep, undefined),
+    [choreographer, fixedTimeStep, world]
+  )
+
+  useEffect(() => {
+    clock.start()
+    return () => {
+      clock.stop()
+    }
+  }, [clock])
+
+  return clock
+}
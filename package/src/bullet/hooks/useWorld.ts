@@ -1,6 +1,6 @@
 import { useMemo } from 'react'
 import { BulletAPI } from '../bulletApi'
 
-export function useWorld(x: number, y: number, z: number) {
-  return useMemo(() => BulletAPI.createDiscreteDynamicWorld(x, y, z), [x, y, z])
+export function useWorld(x: number, y: number, z: number, threadsCount?: number) {
+  return useMemo(() => BulletAPI.createDiscreteDynamicWorld(x, y, z, threadsCount), [x, y, z, threadsCount])
 }
@@ -1,5 +1,6 @@
 // Hooks
 export * from './hooks/useWorld'
+export * from './hooks/usePhysicsClock'
 export * from './hooks/useRigidBody'
 export * from './hooks/useCylinderShape'
 export * from './hooks/useBoxShape'
@@ -8,6 +9,7 @@ export * from './hooks/useSphereShape'
 
 // Types
 export * from './types/DiscreteDynamicWorld'
+export * from './types/PhysicsClock'
 export * from './types/RigidBody'
 export * from './types/Shapes'
 export * from './types/api'
@@ -1,13 +1,253 @@
+import { Entity } from '../../types/Entity'
+import { TransformManager } from '../../types/TransformManager'
 import { RigidBody } from './RigidBody'
+import { BaseShape } from './Shapes'
+
+/**
+ * The `type` of a contact event, the first number of every event in a {@linkcode ContactEventsCallback} buffer.
+ */
+export const ContactEventType = {
+  /** The bodies started touching since the previous callback */
+  begin: 0,
+  /** The bodies were touching at the previous callback, and still are */
+  persist: 1,
+  /** The bodies stopped touching since the previous callback */
+  end: 2,
+} as const
+
+/**
+ * The number of values per event in a {@linkcode ContactEventsCallback} buffer.
+ */
+export const CONTACT_EVENT_STRIDE = 10
+
+/**
+ * Receives all contact events of the internal (fixed) steps since the previous callback at once, so contacts that only
+ * lasted for some substeps are reported too. Every pair of bodies gets one event, except for pairs that began and stopped
+ * touching in between, which get a `begin` and an `end` event.
+ * Every event takes {@linkcode CONTACT_EVENT_STRIDE} values in `events`:
+ *
+ * `[type, bodyIdA, bodyIdB, impulse, pointX, pointY, pointZ, normalX, normalY, normalZ]`
+ *
+ * - `type`: See {@linkcode ContactEventType}
+ * - `bodyIdA`, `bodyIdB`: The ids of the bodies (`bodyIdA < bodyIdB`), see {@linkcode DiscreteDynamicWorld.getBodyId}
+ * - `impulse`: The total impulse applied between the bodies in all internal steps since the previous callback
+ * - `point`: The deepest contact point on body B, in world space, of the last internal step the bodies touched in
+ * - `normal`: The contact normal, pointing from body B towards body A, of the last internal step the bodies touched in
+ *
+ * End events only contain the type and the body ids.
+ *
+ * @example
+ * ```ts
+ * world.setContactEventsCallback((events) => {
+ *   for (let i = 0; i < events.length; i += CONTACT_EVENT_STRIDE) {
+ *     if (events[i] === ContactEventType.begin) {
+ *       const body = world.getRigidBody(events[i + 1])
+ *     }
+ *   }
+ * })
+ * ```
+ */
+export type ContactEventsCallback = (events: Float64Array) => void
+
+/**
+ * The number of values per body in {@linkcode DiscreteDynamicWorld.createRigidBodies}: `[mass, x, y, z, shapeIndex]`.
+ */
+export const RIGID_BODY_STRIDE = 5
+
+/**
+ * The number of values per ray or sweep in the queries: `[fromX, fromY, fromZ, toX, toY, toZ]`.
+ */
+export const RAY_STRIDE = 6
+
+/**
+ * The number of values per hit returned by {@linkcode DiscreteDynamicWorld.rayTest} and {@linkcode DiscreteDynamicWorld.convexSweepTest}:
+ *
+ * `[bodyId, fraction, pointX, pointY, pointZ, normalX, normalY, normalZ]`
+ *
+ * - `bodyId`: The id of the body that was hit (see {@linkcode DiscreteDynamicWorld.getBodyId}), or -1 if nothing was hit
+ * - `fraction`: How far along the ray or sweep the hit is, from 0 (`from`) to 1 (`to`)
+ * - `point`: The hit point in world space
+ * - `normal`: The surface normal of the body at the hit point
+ */
+export const HIT_STRIDE = 8
+
+/**
+ * The number of values per hit returned by {@linkcode DiscreteDynamicWorld.rayTestAll}: `[rayIndex, ...hit]`,
+ * where `hit` is laid out as described in {@linkcode HIT_STRIDE}.
+ */
+export const INDEXED_HIT_STRIDE = 9
+
+/**
+ * The number of values per contact returned by {@linkcode DiscreteDynamicWorld.contactTest}:
+ *
+ * `[positionIndex, bodyId, distance, pointX, pointY, pointZ, normalX, normalY, normalZ]`
+ *
+ * - `distance`: The distance between the shape and the body, negative if they penetrate
+ * - `point`: The deepest contact point on the body, in world space
+ * - `normal`: The contact normal, pointing from the body towards the shape
+ */
+export const CONTACT_STRIDE = 9
+
+/**
+ * The number of values per body returned by {@linkcode DiscreteDynamicWorld.takeChangedBodies}:
+ * `[bodyId, activationState, x, y, z, rotationX, rotationY, rotationZ, rotationW]`.
+ */
+export const CHANGED_BODY_STRIDE = 9
 
 export interface DiscreteDynamicWorld {
   addRigidBody(rigidBody: RigidBody): void
   removeRigidBody(rigidBody: RigidBody): void
   /**
-   * Update the simulation each frame.
+   * Adds all bodies in one call and returns their body ids (see {@linkcode getBodyId}), in the same order.
+   */
+  addRigidBodies(rigidBodies: RigidBody[]): Int32Array
+  /**
+   * Creates and adds many bodies in one call, which is much faster than creating and adding them one by one.
+   * The bodies have an empty `id`, use the returned body ids to look them up with {@linkcode getRigidBody} or remove them.
+   * @param bodies {@linkcode RIGID_BODY_STRIDE} values per body: `[mass, x, y, z, shapeIndex]`, with `shapeIndex` pointing into `shapes`
+   * @param shapes The shapes of the bodies
+   * @returns The body ids, in the same order as `bodies`
+   * @example
+   * ```ts
+   * const bodies = new Float64Array(count * RIGID_BODY_STRIDE)
+   * for (let i = 0; i < count; i++) {
+   *   bodies.set([1, i * 1.1, 10, 0, 0], i * RIGID_BODY_STRIDE)
+   * }
+   * const bodyIds = world.createRigidBodies(bodies, [boxShape])
+   * // ...
+   * world.removeRigidBodies(bodyIds)
+   * ```
+   */
+  createRigidBodies(bodies: Float64Array | number[], shapes: BaseShape[]): Int32Array
+  /**
+   * Removes many bodies in one call, which takes linear time in the number of bodies (removing them one by one takes quadratic time).
+   * Ids of bodies that are not in the world are ignored.
+   */
+  removeRigidBodies(bodyIds: Int32Array | number[]): void
+  /**
+   * Update the simulation each frame. Throws while the world is stepped by a {@linkcode PhysicsClock}.
    * @param timeStep The time passed
    * @param maxSubSteps @default 1
    * @param fixedTimeStep @default 1/60 (60 Hz)
    */
   stepSimulation(timeStep: number, maxSubSteps: number, fixedTimeStep: number): void
+  /**
+   * Sets the callback that receives the contact events after each `stepSimulation` call that advanced the world by at least
+   * one internal step, or removes it if `undefined`.
+   * Unlike {@linkcode RigidBody.setCollisionCallback}, this is only called once per step, no matter how many bodies touch.
+   */
+  setContactEventsCallback(callback: ContactEventsCallback | undefined): void
+  /**
+   * Returns the id the body has in this world's contact events. Throws if the body has not been added to this world.
+   */
+  getBodyId(rigidBody: RigidBody): number
+  /**
+   * Returns the body with the given id, or `undefined` if it has been removed from the world.
+   */
+  getRigidBody(bodyId: number): RigidBody | undefined
+  /**
+   * Makes the entity follow the body: After every `stepSimulation` call, the transforms of all bound entities are
+   * updated natively in one pass, skipping bodies that are sleeping. The entity's current scale is kept.
+   * This replaces calling {@linkcode TransformManager.updateTransformByRigidBody} for every body each frame.
+   * The body has to be added to this world, and is unbound when it gets removed.
+   */
+  bindEntity(rigidBody: RigidBody, entity: Entity, transformManager: TransformManager): void
+  /**
+   * Stops updating the entity bound to the body with {@linkcode bindEntity}.
+   */
+  unbindEntity(rigidBody: RigidBody): void
+  /**
+   * Returns the bodies that were added, moved or changed their activation state since the last call, so per-frame code only
+   * has to touch the bodies that are moving. Once a body falls asleep it is reported one last time, and then skipped until it wakes up.
+   * Bodies woken up from JS (e.g. by setting their `activationState`) are reported after the next step.
+   * @returns {@linkcode CHANGED_BODY_STRIDE} values per body, with the interpolated position and rotation (a quaternion) of the body.
+   * The activation state is Bullet's number: 1 active, 2 sleeping, 3 wants deactivation, 4 disable deactivation, 5 disable simulation.
+   * @example
+   * ```ts
+   * world.stepSimulation(delta, 1, 1 / 60)
+   * const changes = world.takeChangedBodies()
+   * for (let i = 0; i < changes.length; i += CHANGED_BODY_STRIDE) {
+   *   const bodyId = changes[i]
+   *   const [x, y, z] = changes.subarray(i + 2, i + 5)
+   * }
+   * ```
+   */
+  takeChangedBodies(): Float64Array
+  /**
+   * Counts the bodies by activation state, and the simulation islands: groups of touching bodies that fall asleep and wake up together.
+   * Static and kinematic bodies are not part of any island.
+   */
+  getSimulationStats(): {
+    bodies: number
+    activeBodies: number
+    sleepingBodies: number
+    /**
+     * Bodies that never fall asleep (`'disable_deactivation'`)
+     */
+    alwaysActiveBodies: number
+    /**
+     * Bodies that aren't simulated (`'disable_simulation'`)
+     */
+    disabledBodies: number
+    islands: number
+    sleepingIslands: number
+    /**
+     * The number of bodies in the largest island
+     */
+    largestIsland: number
+    /**
+     * The number of bodies that will be returned by the next {@linkcode takeChangedBodies}, at most
+     */
+    pendingChangedBodies: number
+  }
+  /**
+   * Casts many rays in one call and returns the closest hit of each ray.
+   * @param rays {@linkcode RAY_STRIDE} values per ray: `[fromX, fromY, fromZ, toX, toY, toZ]`
+   * @returns {@linkcode HIT_STRIDE} values per ray, in the same order as `rays`
+   * @example
+   * ```ts
+   * const hits = world.rayTest([0, 10, 0, 0, -10, 0])
+   * if (hits[0] !== -1) {
+   *   const body = world.getRigidBody(hits[0])
+   * }
+   * ```
+   */
+  rayTest(rays: Float64Array | number[]): Float64Array
+  /**
+   * Casts many rays in one call and returns all hits of each ray.
+   * @param rays {@linkcode RAY_STRIDE} values per ray
+   * @returns {@linkcode INDEXED_HIT_STRIDE} values per hit, sorted by ray and then by distance along the ray
+   */
+  rayTestAll(rays: Float64Array | number[]): Float64Array
+  /**
+   * Sweeps a convex shape (box, cylinder, sphere or convex hull) along many segments in one call, and returns the closest hit
+   * of each sweep. The shape isn't rotated.
+   * @param sweeps {@linkcode RAY_STRIDE} values per sweep, the positions the shape moves between
+   * @returns {@linkcode HIT_STRIDE} values per sweep, in the same order as `sweeps`
+   */
+  convexSweepTest(shape: BaseShape, sweeps: Float64Array | number[]): Float64Array
+  /**
+   * Places a shape at many positions in one call, and returns the bodies it overlaps with at each position. The shape isn't rotated.
+   * @param positions 3 values per position: `[x, y, z]`
+   * @returns {@linkcode CONTACT_STRIDE} values per overlapping body and position
+   */
+  contactTest(shape: BaseShape, positions: Float64Array | number[]): Float64Array
+
+  /**
+   * Captures the transform, velocities, activation state, damping and friction of all bodies in a compact binary buffer,
+   * to rewind the world later with {@linkcode restore} (e.g. for rollback netcode or replays).
+   * The buffer can only be restored by the same build of the app, it is not a portable file format.
+   */
+  snapshot(): Uint8Array
+  /**
+   * Restores the bodies to the state captured by {@linkcode snapshot}.
+   * Bodies added after the snapshot was taken are kept as they are, and bodies removed since then are skipped.
+   *
+   * Restoring also resets the world's contact caches, so stepping a single-threaded world after restoring the same snapshot with
+   * the same time steps and inputs (forces, velocities, added bodies) gives the same results every time, on the same build and CPU
+   * architecture. Multithreaded worlds solve islands in a varying order and are not deterministic.
+   * Pairs that touch after restoring are reported as beginning again by the contact events callback.
+   * @returns The number of bodies that were restored
+   */
+  restore(snapshot: Uint8Array): number
 }
@@ -0,0 +1,26 @@
+/**
+ * Steps a {@linkcode DiscreteDynamicWorld} with a fixed time step on its own native thread, independent of the JS thread
+ * and the frame rate. Create it with {@linkcode BulletAPI.createPhysicsClock} or {@linkcode usePhysicsClock}.
+ *
+ * Every frame, the entities bound with {@linkcode DiscreteDynamicWorld.bindEntity} are set to their bodies' poses,
+ * interpolated between the last two steps. The contact events and collision callbacks of the steps since the previous
+ * frame are then delivered on the JS thread that called `start()`.
+ *
+ * While the clock is running, `stepSimulation` must not be called on its world. Bodies should only be changed
+ * through the world (adding, removing, binding) or from within the world's callbacks, as the clock might be stepping meanwhile.
+ */
+export interface PhysicsClock {
+  /**
+   * Starts stepping the world. Does nothing if the clock is running already.
+   */
+  start(): void
+  /**
+   * Stops stepping the world, after which `stepSimulation` can be used again.
+   */
+  stop(): void
+  readonly isRunning: boolean
+  /**
+   * The number of steps the clock has taken.
+   */
+  readonly stepsCount: number
+}
@@ -2,6 +2,11 @@ export type ActivationState = 'active_state' | 'island_sleeping' | 'want_deactiv
 
 export type CollisionCallback = (thisBody: RigidBody, collidedWith: RigidBody) => void
 
+/**
+ * A rigid body of a physics world.
+ * Once the body has been added to a world, changing (or reading) it waits for the world's current step to finish,
+ * so it is safe to use while a `PhysicsClock` steps the world on its own thread.
+ */
 export interface RigidBody {
   setDamping(linearDamping: number, angularDamping: number): void
   friction: number
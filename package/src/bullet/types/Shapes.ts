@@ -1,6 +1,10 @@
 import { Float3 } from '../../types'
 
 export interface BaseShape {
+  /**
+   * Primitive shapes (box, cylinder, static plane, sphere) are shared between all shapes with the same dimensions, scaling
+   * and margin. Changing the scaling or margin of such a shape only affects rigid bodies created with it afterwards.
+   */
   localScaling: Float3
   margin: number
 }
@@ -12,3 +16,18 @@ export interface CylinderShape extends BaseShape {}
 export interface StaticPlaneShape extends BaseShape {}
 
 export interface SphereShape extends BaseShape {}
+
+/**
+ * A convex hull around the vertices of a glTF mesh, reduced to the few vertices that shape it the most.
+ */
+export interface ConvexHullShape extends BaseShape {}
+
+/**
+ * The exact triangles of a glTF mesh. Can only be used for static (mass 0) bodies.
+ */
+export interface TriangleMeshShape extends BaseShape {}
+
+/**
+ * One convex hull per primitive of a glTF mesh, for dynamic bodies of concave objects.
+ */
+export interface CompoundShape extends BaseShape {}
@@ -1,10 +1,43 @@
+import { FilamentBuffer } from '../../native/FilamentBuffer'
+import { Choreographer } from '../../types/Choreographer'
 import { Mat4 } from '../../types/TransformManager'
 import { DiscreteDynamicWorld } from './DiscreteDynamicWorld'
+import { PhysicsClock } from './PhysicsClock'
 import { CollisionCallback, RigidBody } from './RigidBody'
-import { BaseShape, BoxShape, CylinderShape, SphereShape, StaticPlaneShape } from './Shapes'
+import {
+  BaseShape,
+  BoxShape,
+  CompoundShape,
+  ConvexHullShape,
+  CylinderShape,
+  SphereShape,
+  StaticPlaneShape,
+  TriangleMeshShape,
+} from './Shapes'
 
 export interface BulletAPI {
-  createDiscreteDynamicWorld(gravityX: number, gravityY: number, gravityZ: number): DiscreteDynamicWorld
+  /**
+   * Creates a physics world with the given gravity.
+   * @param threadsCount If set, the world runs collision detection and the constraint solver in parallel on that many
+   * threads (including the one calling `stepSimulation`). This pays off for scenes with many (hundreds of) bodies.
+   * All multithreaded worlds share the threads of the first one, so later worlds have to use the same `threadsCount`,
+   * otherwise this throws.
+   * Only supported on iOS, on Android the world is always single-threaded.
+   * Multithreaded worlds must be created and stepped on the same thread.
+   */
+  createDiscreteDynamicWorld(gravityX: number, gravityY: number, gravityZ: number, threadsCount?: number): DiscreteDynamicWorld
+  /**
+   * Creates a clock that steps the world on its own thread, see {@linkcode PhysicsClock}. Multithreaded worlds are not supported.
+   * @param fixedTimeStep The time the world advances per step, in seconds @default 1/60
+   * @param maxCatchUpSteps If stepping falls behind by more steps (e.g. while the app was in the background), the time is skipped
+   * instead of stepping in a burst @default 5
+   */
+  createPhysicsClock(
+    world: DiscreteDynamicWorld,
+    choreographer: Choreographer,
+    fixedTimeStep: number | undefined,
+    maxCatchUpSteps: number | undefined
+  ): PhysicsClock
   createBoxShape(halfX: number, halfY: number, halfZ: number): BoxShape
   /**
    * Implements a cylinder shape primitive, centered around the origin. Its central axis aligned with the Y axis.
@@ -26,6 +59,39 @@ export interface BulletAPI {
   createCylinderShapeZ(halfX: number, halfY: number, halfZ: number): CylinderShape
   createStaticPlaneShape(normalX: number, normalY: number, normalZ: number, constant: number): StaticPlaneShape
   createSphereShape(radius: number): SphereShape
+  /**
+   * Builds a convex hull around the mesh geometry of a glTF file on a background thread.
+   * Shapes are cached by the file's content, so building the same shape again while it is in use returns the same shape.
+   * Only .glb files and .gltf files with embedded buffers are supported, compressed (Draco, meshopt) meshes are not.
+   * @param buffer The .glb/.gltf file, e.g. the one the asset was loaded from
+   * @param nodeName If set, only the meshes of the first node with this name (and its children) are used, in that node's space.
+   * Otherwise all meshes of the scene are used, in the scene's space.
+   */
+  createConvexHullShape(buffer: FilamentBuffer, nodeName: string | undefined): Promise<ConvexHullShape>
+  /**
+   * Builds a shape of the exact triangles of a glTF file's mesh geometry on a background thread, see `createConvexHullShape`.
+   * Triangle meshes can only be used for static (mass 0) bodies, e.g. level geometry.
+   */
+  createTriangleMeshShape(buffer: FilamentBuffer, nodeName: string | undefined): Promise<TriangleMeshShape>
+  /**
+   * Builds a compound of one convex hull per mesh primitive of a glTF file on a background thread, see `createConvexHullShape`.
+   * Use this for dynamic bodies of concave objects that are modelled from convex parts.
+   */
+  createCompoundShape(buffer: FilamentBuffer, nodeName: string | undefined): Promise<CompoundShape>
+  /**
+   * Returns statistics about the cache that shares identical primitive shapes, and the local inertia of their rigid bodies per mass.
+   */
+  getShapeCacheStats(): {
+    hits: number
+    misses: number
+    /**
+     * The share of primitive shapes that were taken from the cache, between 0 and 1.
+     */
+    hitRate: number
+    residentShapes: number
+    inertiaHits: number
+    inertiaMisses: number
+  }
   createRigidBody(
     mass: number,
     x: number,
@@ -0,0 +1,37 @@
+import { AnimationMixer } from '../types'
+import { RenderCallbackContext } from '../react/RenderCallbackContext'
+import { useDisposableResource } from './useDisposableResource'
+import { useFilamentContext } from './useFilamentContext'
+
+/**
+ * Creates an {@linkcode AnimationMixer} that is advanced once per frame.
+ * Register animators with it and control them with `play`, `queue`, `setPaused`, ..
+ * instead of applying animations in a render callback yourself.
+ *
+ * @note Must be used inside a `<FilamentView>`.
+ * @example
+ * ```ts
+ * const mixer = useAnimationMixer()
+ * const animator = useAnimator(model)
+ * useEffect(() => {
+ *   if (mixer == null || animator == null) return
+ *   const id = mixer.addAnimator(animator)
+ *   mixer.play(id, 0)
+ *   return () => mixer.removeAnimator(id)
+ * }, [mixer, animator])
+ * ```
+ */
+export function useAnimationMixer(): AnimationMixer | undefined {
+  const { engine } = useFilamentContext()
+  const mixer = useDisposableResource(() => Promise.resolve(engine.createAnimationMixer()), [engine])
+
+  RenderCallbackContext.useRenderCallback(
+    ({ timestamp }) => {
+      'worklet'
+      mixer?.update(timestamp)
+    },
+    [mixer]
+  )
+
+  return mixer
+}
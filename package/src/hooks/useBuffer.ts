@@ -1,8 +1,10 @@
-import { useEffect, useMemo, useState } from 'react'
+import { useEffect, useMemo, useRef, useState } from 'react'
 import { FilamentBuffer } from '../native/FilamentBuffer'
 import { FilamentProxy } from '../native/FilamentProxy'
 import { withCleanupScope } from '../utilities/withCleanupScope'
 import { Image } from 'react-native'
+import { BufferLoader, BufferLoadProgressCallback } from '../types/BufferLoader'
+import { Listener } from '../types/Listener'
 
 // In React Native, `require(..)` returns a number.
 type Require = number // ReturnType<typeof require>
@@ -26,13 +28,23 @@ export interface BufferProps {
    * @default true
    */
   releaseOnUnmount?: boolean
+
+  /**
+   * Called with the loaded and total amount of bytes while a local file (`file://`) is being loaded.
+   * If set, local files are read in chunks (instead of being memory mapped) so that the progress can be reported,
+   * and a load that is still running when unmounting gets cancelled.
+   */
+  onProgress?: BufferLoadProgressCallback
 }
 
 /**
  * Asynchronously load an asset from the given web URL, local file path, or resource ID.
  */
-export function useBuffer({ source: source, releaseOnUnmount = true }: BufferProps): FilamentBuffer | undefined {
+export function useBuffer({ source: source, releaseOnUnmount = true, onProgress }: BufferProps): FilamentBuffer | undefined {
   const [buffer, setBuffer] = useState<FilamentBuffer | undefined>(undefined)
+  const onProgressRef = useRef(onProgress)
+  onProgressRef.current = onProgress
+  const reportsProgress = onProgress != null
 
   const uri = useMemo(() => {
     if (typeof source === 'object') {
@@ -52,20 +64,42 @@ export function useBuffer({ source: source, releaseOnUnmount = true }: BufferPro
   // TODO: useDisposableResource
   useEffect(() => {
     let localBuffer: FilamentBuffer | undefined
-    FilamentProxy.loadAsset(uri)
+    let loader: BufferLoader | undefined
+    let progressListener: Listener | undefined
+    let isUnmounted = false
+
+    let load: Promise<FilamentBuffer>
+    if (reportsProgress && uri.startsWith('file://')) {
+      loader = FilamentProxy.createBufferLoader(uri)
+      progressListener = loader.addOnProgressListener((loadedBytes, totalBytes) => onProgressRef.current?.(loadedBytes, totalBytes))
+      load = loader.load()
+    } else {
+      load = FilamentProxy.loadAsset(uri)
+    }
+
+    load
       .then((asset) => {
         localBuffer = asset
         setBuffer(asset)
       })
       .catch((error) => {
+        // Cancelled on unmount
+        if (isUnmounted && loader != null) return
         console.error(`Failed to load asset: ${uri}`, error)
       })
-    return withCleanupScope(() => {
-      if (releaseOnUnmount) {
-        localBuffer?.release()
-      }
-    })
-  }, [releaseOnUnmount, uri])
+    return () => {
+      isUnmounted = true
+      // Stop reading right away, no one is waiting for the buffer anymore
+      loader?.cancel()
+      withCleanupScope(() => {
+        progressListener?.remove()
+        loader?.release()
+        if (releaseOnUnmount) {
+          localBuffer?.release()
+        }
+      })()
+    }
+  }, [releaseOnUnmount, reportsProgress, uri])
 
   return buffer
 }
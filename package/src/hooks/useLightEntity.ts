@@ -63,12 +63,11 @@ export function useLightEntity(lightManager: LightManager, config: UseLightEntit
     if (intensity == null) return
     if (typeof intensity === 'number') return
 
-    const setIntensity = lightManager.setIntensity
-
     return intensity.addListener(
       workletContext.createRunAsync(() => {
         'worklet'
-        setIntensity(entity, intensity.value)
+        // Hybrid methods take their instance from `this`, so they must be called on the object
+        lightManager.setIntensity(entity, intensity.value)
       })
     )
   }, [config.intensity, entity, lightManager, workletContext])
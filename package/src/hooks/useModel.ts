@@ -25,6 +25,21 @@ export interface UseModelConfigParams {
    * @default 1
    */
   instanceCount?: number
+
+  /**
+   * Whether the model should be loaded over multiple frames, without blocking rendering (see `Engine.loadAssetAsync`).
+   * The model only finishes loading while the FilamentView is rendering.
+   * @default false
+   */
+  loadAsync?: boolean
+
+  /**
+   * Whether the model should be loaded through the engine's asset cache (see `Engine.loadCachedAsset`).
+   * All models loaded from the same content then share one asset, and each get their own instance of it.
+   * Only used when loading synchronously with a single instance.
+   * @default false
+   */
+  cache?: boolean
 }
 
 /**
@@ -58,7 +73,7 @@ export type FilamentModel =
  * ```
  */
 export function useModel(source: BufferSource, props?: UseModelConfigParams): FilamentModel {
-  const { shouldReleaseSourceData = true, addToScene = true, instanceCount } = props ?? {}
+  const { shouldReleaseSourceData = true, addToScene = true, instanceCount, loadAsync = false, cache = false } = props ?? {}
   const { engine, scene, workletContext } = useFilamentContext()
   const assetBuffer = useBuffer({ source: source, releaseOnUnmount: false })
 
@@ -69,12 +84,20 @@ export function useModel(source: BufferSource, props?: UseModelConfigParams): Fi
       throw new Error('instanceCount must be greater than 0')
     }
 
+    if (loadAsync) {
+      return engine.loadAssetAsync(assetBuffer, instanceCount === 1 ? undefined : instanceCount).then((loadedAsset) => {
+        // After loading the asset we can release the buffer
+        assetBuffer.release()
+        return loadedAsset
+      })
+    }
+
     return workletContext.runAsync(() => {
       'worklet'
 
       let loadedAsset: FilamentAsset
       if (instanceCount == null || instanceCount === 1) {
-        loadedAsset = engine.loadAsset(assetBuffer)
+        loadedAsset = cache ? engine.loadCachedAsset(assetBuffer) : engine.loadAsset(assetBuffer)
       } else {
         loadedAsset = engine.loadInstancedAsset(assetBuffer, instanceCount)
       }
@@ -84,7 +107,7 @@ export function useModel(source: BufferSource, props?: UseModelConfigParams): Fi
 
       return loadedAsset
     })
-  }, [assetBuffer, workletContext, engine, instanceCount])
+  }, [assetBuffer, workletContext, engine, instanceCount, loadAsync, cache])
 
   useWorkletEffect(() => {
     'worklet'
@@ -7,6 +7,7 @@ export * from './hooks/useWorkletMemo'
 export * from './hooks/useBuffer'
 export * from './hooks/useModel'
 export * from './hooks/useAnimator'
+export * from './hooks/useAnimationMixer'
 export * from './hooks/useConfigureAssetShadow'
 export * from './hooks/useEntityInScene'
 export * from './hooks/useLightEntity'
@@ -6,6 +6,7 @@ import type { IWorkletContext } from 'react-native-worklets-core'
 import { EngineBackend, EngineConfig } from '../types'
 import { TFilamentRecorder } from '../types/FilamentRecorder'
 import { Choreographer } from '../types/Choreographer'
+import { BufferLoader } from '../types/BufferLoader'
 import { Dispatcher } from './Dispatcher'
 import { FilamentModule } from './FilamentModule'
 import { Worklets } from 'react-native-worklets-core'
@@ -16,11 +17,26 @@ interface TestHybridObject {
   nullableString: string | undefined
 
   multipleArguments(first: number, second: boolean, third: string): Record<string, number>
+  getPropertyNameConversionsCount(): number
   getIntGetter(): () => number
   sayHelloCallback(callback: () => string): void
   createNewHybridObject: () => TestHybridObject
   calculateFibonacciAsync: (count: number) => Promise<BigInt>
   calculateFibonacci: (count: number) => number
+  sumNumbers(numbers: number[]): number
+  sumFloat32Array(numbers: Float32Array | number[]): number
+  createFloat32Array(size: number): Float32Array
+  benchmarkDispatchers(jobsCount: number, producersCount: number): Record<string, number>
+  benchmarkTransformSync(instancesCount: number, bonesCount: number, framesCount: number): Record<string, number>
+  benchmarkAnimationBatch(instancesCount: number, bonesCount: number, framesCount: number): Record<string, number>
+  benchmarkBulletWorld(bodiesCount: number, framesCount: number): Record<string, number>
+  benchmarkBulkRigidBodies(bodiesCount: number): Record<string, number>
+  benchmarkPhysicsSnapshot(bodiesCount: number): Record<string, number>
+  benchmarkChangedBodies(bodiesCount: number): Record<string, number>
+  testBakedAnimationRoundTrip(): Record<string, number>
+  testMappedFileBuffer(): Record<string, number>
+  testGltfGeometryReader(): Record<string, number>
+  createTestBufferLoader(size: number, chunkSize: number, chunkDelayMs: number): BufferLoader
   enum: 'first' | 'second' | 'third'
 }
 
@@ -30,6 +46,11 @@ export interface TFilamentProxy {
    * @param path A web URL (http:// or https://), local file (file://) or resource ID. (Only resource ID supported for now)
    */
   loadAsset(path: string): Promise<FilamentBuffer>
+  /**
+   * Creates a loader that loads the given local file (file://) in chunks, with progress and cancellation.
+   * @param chunkSize The amount of bytes read per chunk. Default: 256 KiB
+   */
+  createBufferLoader(path: string, chunkSize?: number): BufferLoader
   /**
    * @private
    */
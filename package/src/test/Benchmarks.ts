@@ -0,0 +1,189 @@
+import { FilamentProxy } from '../native/FilamentProxy'
+
+const ITERATIONS = 100_000
+
+function measure(name: string, iterations: number, func: () => void): void {
+  const start = performance.now()
+  func()
+  const end = performance.now()
+  const nsPerOp = ((end - start) * 1_000_000) / iterations
+  console.log(`${name}: ${(end - start).toFixed(2)}ms for ${iterations} iterations (${nsPerOp.toFixed(0)}ns/op)`)
+}
+
+export function benchmarkHybridObjectPropertyAccess(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  let sum = 0
+  measure('HybridObject getter', ITERATIONS, () => {
+    for (let i = 0; i < ITERATIONS; i++) {
+      sum += hybridObject.int
+    }
+  })
+  measure('HybridObject setter', ITERATIONS, () => {
+    for (let i = 0; i < ITERATIONS; i++) {
+      hybridObject.int = i
+    }
+  })
+  measure('HybridObject method lookup', ITERATIONS, () => {
+    for (let i = 0; i < ITERATIONS; i++) {
+      // eslint-disable-next-line @typescript-eslint/no-unused-expressions
+      hybridObject.getIntGetter
+    }
+  })
+  measure('HybridObject method call', ITERATIONS, () => {
+    for (let i = 0; i < ITERATIONS; i++) {
+      hybridObject.multipleArguments(i, true, 'benchmark')
+    }
+  })
+  measure('HybridObject unknown property', ITERATIONS, () => {
+    for (let i = 0; i < ITERATIONS; i++) {
+      // @ts-expect-error this property does not exist on purpose
+      sum += hybridObject.doesNotExist === undefined ? 0 : 1
+    }
+  })
+  console.log(`(checksum: ${sum})`)
+}
+
+const INSTANCES = 10_000
+
+export function benchmarkHybridObjectInstances(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  // Creating instances, e.g. like FilamentAsset.getEntities() does for every entity
+  const instances: (typeof hybridObject)[] = []
+  measure('HybridObject creation', INSTANCES, () => {
+    for (let i = 0; i < INSTANCES; i++) {
+      instances.push(hybridObject.createNewHybridObject())
+    }
+  })
+  // The first access on each instance used to build that instance's method table
+  measure('HybridObject first method access', INSTANCES, () => {
+    for (const instance of instances) {
+      instance.calculateFibonacci(1)
+    }
+  })
+  measure('HybridObject repeated method access', INSTANCES, () => {
+    for (const instance of instances) {
+      instance.calculateFibonacci(1)
+    }
+  })
+}
+
+const ARRAY_SIZE = 16
+
+export function benchmarkTypedArrayConversion(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+  const numbers = Array.from({ length: ARRAY_SIZE }, (_, i) => i)
+  const float32Array = new Float32Array(numbers)
+
+  let sum = 0
+  measure(`number[${ARRAY_SIZE}] to native`, ITERATIONS, () => {
+    for (let i = 0; i < ITERATIONS; i++) {
+      sum += hybridObject.sumNumbers(numbers)
+    }
+  })
+  measure(`Float32Array(${ARRAY_SIZE}) to native`, ITERATIONS, () => {
+    for (let i = 0; i < ITERATIONS; i++) {
+      sum += hybridObject.sumFloat32Array(float32Array)
+    }
+  })
+  measure(`Float32Array(${ARRAY_SIZE}) from native`, ITERATIONS, () => {
+    for (let i = 0; i < ITERATIONS; i++) {
+      sum += hybridObject.createFloat32Array(ARRAY_SIZE).length
+    }
+  })
+  console.log(`(checksum: ${sum})`)
+}
+
+const DISPATCHER_JOBS = 100_000
+
+export function benchmarkDispatcherThroughput(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  for (const producersCount of [1, 4]) {
+    const results = hybridObject.benchmarkDispatchers(DISPATCHER_JOBS, producersCount)
+    for (const [name, ms] of Object.entries(results)) {
+      const nsPerJob = (ms * 1_000_000) / DISPATCHER_JOBS
+      const label = `Dispatcher ${name} (${producersCount} producers)`
+      console.log(`${label}: ${ms.toFixed(2)}ms for ${DISPATCHER_JOBS} jobs (${nsPerJob.toFixed(0)}ns/job)`)
+    }
+  }
+}
+
+const SYNC_INSTANCES = 100
+const SYNC_BONES = 60
+const SYNC_FRAMES = 300
+
+export function benchmarkAnimatorInstanceSync(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  const results = hybridObject.benchmarkTransformSync(SYNC_INSTANCES, SYNC_BONES, SYNC_FRAMES)
+  for (const [name, ms] of Object.entries(results)) {
+    const nsPerBone = (ms * 1_000_000) / (SYNC_INSTANCES * SYNC_BONES)
+    const label = `Instance sync ${name} (${SYNC_INSTANCES}x${SYNC_BONES} bones)`
+    console.log(`${label}: ${ms.toFixed(3)}ms per frame (${nsPerBone.toFixed(0)}ns/bone)`)
+  }
+}
+
+const BATCH_INSTANCES = 64
+const BATCH_BONES = 60
+const BATCH_FRAMES = 120
+
+export function benchmarkAnimationBatch(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  const { threads, ...results } = hybridObject.benchmarkAnimationBatch(BATCH_INSTANCES, BATCH_BONES, BATCH_FRAMES)
+  for (const [name, ms] of Object.entries(results)) {
+    const label = `Animation batch ${name} (${BATCH_INSTANCES}x${BATCH_BONES} bones, ${threads} threads)`
+    console.log(`${label}: ${ms.toFixed(3)}ms per frame`)
+  }
+}
+
+const PILE_BODIES = 2_000
+const PILE_FRAMES = 120
+
+export function benchmarkBulletWorld(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  const results = hybridObject.benchmarkBulletWorld(PILE_BODIES, PILE_FRAMES)
+  for (const [name, ms] of Object.entries(results)) {
+    console.log(`Bullet world ${name} (${PILE_BODIES} bodies): ${ms.toFixed(3)}ms per step`)
+  }
+}
+
+const BULK_BODIES = 5_000
+
+export function benchmarkBulkRigidBodies(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  const results = hybridObject.benchmarkBulkRigidBodies(BULK_BODIES)
+  for (const [name, ms] of Object.entries(results)) {
+    console.log(`Bulk rigid bodies ${name} (${BULK_BODIES} bodies): ${ms.toFixed(2)}ms`)
+  }
+}
+
+const SNAPSHOT_BODIES = 1_000
+
+export function benchmarkPhysicsSnapshot(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  const { bytes, deterministic, ...results } = hybridObject.benchmarkPhysicsSnapshot(SNAPSHOT_BODIES)
+  for (const [name, ms] of Object.entries(results)) {
+    console.log(`Physics snapshot ${name} (${SNAPSHOT_BODIES} bodies): ${ms.toFixed(3)}ms`)
+  }
+  console.log(`Physics snapshot size (${SNAPSHOT_BODIES} bodies): ${bytes} bytes`)
+  if (deterministic !== 1) {
+    throw new Error('Stepping from the same snapshot twice ended in different states!')
+  }
+}
+
+const CHANGED_BODIES = 5_000
+
+export function benchmarkChangedBodies(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  const results = hybridObject.benchmarkChangedBodies(CHANGED_BODIES)
+  for (const [name, value] of Object.entries(results)) {
+    console.log(`Changed bodies ${name} (${CHANGED_BODIES} bodies): ${value.toFixed(2)}`)
+  }
+}
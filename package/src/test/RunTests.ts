@@ -1,4 +1,23 @@
-import { testHybridObject } from './TestHybridObject'
+import {
+  benchmarkAnimationBatch,
+  benchmarkAnimatorInstanceSync,
+  benchmarkBulkRigidBodies,
+  benchmarkBulletWorld,
+  benchmarkChangedBodies,
+  benchmarkDispatcherThroughput,
+  benchmarkHybridObjectInstances,
+  benchmarkHybridObjectPropertyAccess,
+  benchmarkPhysicsSnapshot,
+  benchmarkTypedArrayConversion,
+} from './Benchmarks'
+import {
+  stressTestPromises,
+  testBakedAnimation,
+  testChunkedBufferLoader,
+  testGltfGeometryReader,
+  testHybridObject,
+  testMappedFileBuffer,
+} from './TestHybridObject'
 
 async function wrapTest(name: string, func: () => void | Promise<void>): Promise<void> {
   console.log(`-------- BEGIN TEST: ${name}`)
@@ -17,6 +36,29 @@ export function runTests() {
   if (__DEV__ && TEST_HYBRID_OBJECTS) {
     const run = async () => {
       await wrapTest('HybridObject', testHybridObject)
+      await wrapTest('Promise stress test', stressTestPromises)
+      await wrapTest('Chunked buffer loader', testChunkedBufferLoader)
+      await wrapTest('Baked animation', testBakedAnimation)
+      await wrapTest('Mapped file buffer', testMappedFileBuffer)
+      await wrapTest('glTF geometry reader', testGltfGeometryReader)
+    }
+    run()
+  }
+
+  // Benchmarks are meaningless in __DEV__, so run them in release builds when comparing native changes.
+  const RUN_BENCHMARKS = false
+  if (RUN_BENCHMARKS) {
+    const run = async () => {
+      await wrapTest('HybridObject property access', benchmarkHybridObjectPropertyAccess)
+      await wrapTest('HybridObject instances', benchmarkHybridObjectInstances)
+      await wrapTest('TypedArray conversion', benchmarkTypedArrayConversion)
+      await wrapTest('Dispatcher throughput', benchmarkDispatcherThroughput)
+      await wrapTest('Animator instance sync', benchmarkAnimatorInstanceSync)
+      await wrapTest('Animation batch', benchmarkAnimationBatch)
+      await wrapTest('Bullet world', benchmarkBulletWorld)
+      await wrapTest('Bulk rigid bodies', benchmarkBulkRigidBodies)
+      await wrapTest('Physics snapshot', benchmarkPhysicsSnapshot)
+      await wrapTest('Changed bodies', benchmarkChangedBodies)
     }
     run()
   }
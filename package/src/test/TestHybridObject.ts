@@ -1,6 +1,7 @@
 import { FilamentProxy } from '../native/FilamentProxy'
 
 const FIBONACCI_LIMIT = 70
+const PROPERTY_LOOKUPS = 1_000
 
 export async function testHybridObject(): Promise<void> {
   // 1. Creation
@@ -50,6 +51,159 @@ export async function testHybridObject(): Promise<void> {
   const fibonacci = await hybridObject.calculateFibonacciAsync(FIBONACCI_LIMIT)
   const end = performance.now()
   console.log(`Calculated Fibonacci for ${FIBONACCI_LIMIT} = ${fibonacci} (took ${(end - start).toFixed(0)}ms)`)
+
+  // 11. TypedArrays
+  const typedArray = hybridObject.createFloat32Array(4)
+  console.log(`Created Float32Array: ${typedArray}`)
+  console.log(`Sum of Float32Array: ${hybridObject.sumFloat32Array(typedArray)}`)
+  console.log(`Sum of Float32Array slice: ${hybridObject.sumFloat32Array(typedArray.subarray(2))}`)
+  console.log(`Sum of number[] as Float32Array: ${hybridObject.sumFloat32Array([1, 2, 3])}`)
+
+  // 12. Methods are shared between all instances of a class
+  const isSharedMethod = hybridObject.calculateFibonacci === newObject.calculateFibonacci
+  console.log(`Methods are shared between instances: ${isSharedMethod}`)
+  const boundMethod = hybridObject.multipleArguments.bind(newObject)
+  console.log(`Method called on other instance: ${JSON.stringify(boundMethod(1, false, 'bound'))}`)
+  try {
+    const unbound = hybridObject.calculateFibonacci
+    unbound(5)
+    console.error('Calling an unbound method should have thrown!')
+  } catch (e) {
+    console.log(`Calling an unbound method threw: ${e}`)
+  }
+
+  // 13. Repeated property lookups don't convert the property name to a (heap allocated) string,
+  // only the first lookup of a name goes through the hash index
+  let sum = hybridObject.int + hybridObject.string.length
+  // @ts-expect-error this property does not exist on purpose
+  sum += hybridObject.doesNotExist === undefined ? 0 : 1
+  const conversionsBefore = hybridObject.getPropertyNameConversionsCount()
+  for (let i = 0; i < PROPERTY_LOOKUPS; i++) {
+    hybridObject.int = i
+    sum += hybridObject.int
+    sum += hybridObject.string.length
+    // @ts-expect-error this property does not exist on purpose
+    sum += hybridObject.doesNotExist === undefined ? 0 : 1
+  }
+  const conversions = hybridObject.getPropertyNameConversionsCount() - conversionsBefore
+  if (conversions !== 0) {
+    throw new Error(`${conversions} property names were converted to strings during ${PROPERTY_LOOKUPS} get/set loops (sum ${sum})!`)
+  }
+  // Makes sure the counter actually sees conversions, toString() converts every property name
+  hybridObject.toString()
+  if (hybridObject.getPropertyNameConversionsCount() === conversionsBefore) {
+    throw new Error('toString() did not convert any property names, the conversions counter is broken!')
+  }
+  console.log(`Looked up properties ${PROPERTY_LOOKUPS * 4} times without converting their names`)
+}
+
+const STRESS_TEST_PROMISES = 10_000
+
+export async function stressTestPromises(): Promise<void> {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  console.log(`Awaiting ${STRESS_TEST_PROMISES} concurrent Promises...`)
+  const start = performance.now()
+  const promises: Promise<BigInt>[] = []
+  for (let i = 0; i < STRESS_TEST_PROMISES; i++) {
+    promises.push(hybridObject.calculateFibonacciAsync(10))
+  }
+  const results = await Promise.all(promises)
+  const end = performance.now()
+
+  const failed = results.filter((r) => Number(r) !== 55).length
+  if (failed > 0) {
+    throw new Error(`${failed} of ${STRESS_TEST_PROMISES} Promises resolved with a wrong value!`)
+  }
+  console.log(`Resolved ${STRESS_TEST_PROMISES} concurrent Promises in ${(end - start).toFixed(0)}ms`)
+}
+
+const BUFFER_LOADER_SIZE = 1024 * 1024
+const BUFFER_LOADER_CHUNK_SIZE = 64 * 1024
+
+export async function testChunkedBufferLoader(): Promise<void> {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  // 1. Loading all chunks
+  const loader = hybridObject.createTestBufferLoader(BUFFER_LOADER_SIZE, BUFFER_LOADER_CHUNK_SIZE, 0)
+  let lastLoadedBytes = 0
+  const listener = loader.addOnProgressListener((loadedBytes, totalBytes) => {
+    if (loadedBytes <= lastLoadedBytes || totalBytes !== BUFFER_LOADER_SIZE) {
+      throw new Error(`Unexpected progress: ${loadedBytes} / ${totalBytes} bytes after ${lastLoadedBytes} bytes!`)
+    }
+    lastLoadedBytes = loadedBytes
+  })
+  const buffer = await loader.load()
+  if (loader.loadedBytes !== BUFFER_LOADER_SIZE) {
+    throw new Error(`Loaded ${loader.loadedBytes} of ${BUFFER_LOADER_SIZE} bytes!`)
+  }
+  console.log(`Loaded ${loader.loadedBytes} bytes in chunks of ${BUFFER_LOADER_CHUNK_SIZE} bytes`)
+  listener.remove()
+  buffer.release()
+  loader.release()
+
+  // 2. Cancelling in the middle of the load (16 chunks, 10ms each)
+  const slowLoader = hybridObject.createTestBufferLoader(BUFFER_LOADER_SIZE, BUFFER_LOADER_CHUNK_SIZE, 10)
+  const slowLoad = slowLoader.load()
+  setTimeout(() => slowLoader.cancel(), 35)
+  const error = await slowLoad.then(
+    () => undefined,
+    (e) => e
+  )
+  if (error == null || slowLoader.loadedBytes >= BUFFER_LOADER_SIZE) {
+    throw new Error(`The cancelled load still read ${slowLoader.loadedBytes} of ${BUFFER_LOADER_SIZE} bytes!`)
+  }
+  console.log(`Cancelled load after ${slowLoader.loadedBytes} of ${BUFFER_LOADER_SIZE} bytes: ${error}`)
+  slowLoader.release()
+}
+
+// Quantizing to 16 bits over a translation range of 10 units loses ~0.00015 units
+const BAKED_ANIMATION_MAX_ERROR = 0.001
+
+export function testBakedAnimation(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  const { tracks, constantTrack, maxError } = hybridObject.testBakedAnimationRoundTrip()
+  if (tracks !== 3 || constantTrack !== 1) {
+    throw new Error(`Expected 3 tracks including the constant entity, but baked ${tracks} tracks (constant: ${constantTrack})!`)
+  }
+  if (maxError > BAKED_ANIMATION_MAX_ERROR) {
+    throw new Error(`Decoded baked transforms differ by up to ${maxError} from the sampled transforms!`)
+  }
+  console.log(`Baked animation round trip: ${tracks} tracks, max error ${maxError}`)
+}
+
+export function testMappedFileBuffer(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  const { size, contentMatches, released, emptyThrew, missingThrew } = hybridObject.testMappedFileBuffer()
+  if (size !== 4096 || contentMatches !== 1 || released !== 1) {
+    throw new Error(`Mapped ${size} bytes of a 4096 bytes file (content matches: ${contentMatches}, released: ${released})!`)
+  }
+  if (emptyThrew !== 1 || missingThrew !== 1) {
+    throw new Error(`Mapping an empty or missing file did not throw (empty: ${emptyThrew}, missing: ${missingThrew})!`)
+  }
+  console.log('Mapped a normal file, empty and missing files threw')
+}
+
+export function testGltfGeometryReader(): void {
+  const hybridObject = FilamentProxy.createTestObject()
+
+  const { primitives, positions, triangleIndices, translatedX, nodeSpaceX, glbPositions, ...cases } = hybridObject.testGltfGeometryReader()
+  if (primitives !== 1 || positions !== 3 || triangleIndices !== 3 || glbPositions !== 3) {
+    throw new Error(
+      `Read ${primitives} primitives with ${positions} positions and ${triangleIndices} indices (${glbPositions} positions from the glb) ` +
+        'instead of one triangle!'
+    )
+  }
+  if (translatedX !== 1 || nodeSpaceX !== 0) {
+    throw new Error(`The triangle was read at x ${translatedX} (scene) and ${nodeSpaceX} (node) instead of 1 and 0!`)
+  }
+  const notThrown = Object.keys(cases).filter((key) => cases[key] !== 1)
+  if (notThrown.length > 0) {
+    throw new Error(`Reading invalid glTFs did not throw: ${notThrown.join(', ')}`)
+  }
+  console.log(`Read a triangle glTF, ${Object.keys(cases).length} invalid glTFs threw`)
 }
 
 // @ts-expect-error
@@ -0,0 +1,79 @@
+import { Animator } from './Animator'
+import { PointerHolder } from './PointerHolder'
+
+/**
+ * - `repeat`: Starts over from the beginning when reaching the end.
+ * - `once`: Stops at (and holds) the last frame.
+ * - `pingPong`: Plays backwards when reaching the end, and forwards again when reaching the beginning.
+ */
+export type AnimationLoopMode = 'repeat' | 'once' | 'pingPong'
+
+/**
+ * Plays animations on any number of {@linkcode Animator}s natively.
+ * Each animator has its own playback state (animation, time, speed, loop mode), cross-fades between animations,
+ * and has a queue of animations to play next. Calling {@linkcode update} once per frame advances all animators,
+ * applies their animations and updates their bone matrices, so JS only has to issue state changes.
+ *
+ * @example
+ * ```ts
+ * const mixer = engine.createAnimationMixer()
+ * const id = mixer.addAnimator(animator)
+ * mixer.play(id, 0)
+ * // Later, cross-fade to another animation over 0.3 seconds:
+ * mixer.play(id, 1, 0.3)
+ *
+ * // In the render callback:
+ * mixer.update(frameInfo.timestamp)
+ * ```
+ */
+export interface AnimationMixer extends PointerHolder {
+  /**
+   * Registers the animator with the mixer. It does not play anything until {@linkcode play} is called.
+   * @note The animator's asset must not be released before the animator has been removed again.
+   * @returns The id of the animator in this mixer.
+   */
+  addAnimator(animator: Animator): number
+  removeAnimator(animatorId: number): void
+
+  /**
+   * Plays the animation from its start and clears the queue.
+   * @param fadeDuration Seconds to cross-fade from the currently playing animation. Default: 0
+   * @param speed Playback speed, negative values play backwards. Default: 1
+   * @param loopMode Default: `repeat`
+   */
+  play(animatorId: number, animationIndex: number, fadeDuration?: number, speed?: number, loopMode?: AnimationLoopMode): void
+  /**
+   * Plays the animation once the current one has finished (for looping animations: once it completed its current loop).
+   * Starts right away if nothing is playing. Parameters are the same as for {@linkcode play}.
+   */
+  queue(animatorId: number, animationIndex: number, fadeDuration?: number, speed?: number, loopMode?: AnimationLoopMode): void
+  setPaused(animatorId: number, isPaused: boolean): void
+  setSpeed(animatorId: number, speed: number): void
+  /**
+   * Seeks the playing animation to the given time in seconds.
+   */
+  setTime(animatorId: number, time: number): void
+  /**
+   * Pre-samples the animation into a compact pose buffer, using this animator's model.
+   * From then on, all animators of the same asset in this mixer (e.g. the instances of a crowd) play the animation
+   * by interpolating the baked poses, and animators playing it at the same time share one pose per frame.
+   * Cross-fades still sample the animation. Only node transforms are baked, morph target weights are not animated.
+   * @param frameRate Samples per second. Higher rates are more accurate, but use more memory. Default: 30
+   */
+  bakeAnimation(animatorId: number, animationIndex: number, frameRate?: number): void
+  /**
+   * Returns the index of the playing animation, or `undefined` if none is playing.
+   */
+  getAnimationIndex(animatorId: number): number | undefined
+  /**
+   * Returns the time of the playing animation in seconds.
+   */
+  getTime(animatorId: number): number
+
+  /**
+   * Advances all animators to the given frame timestamp and applies their animations.
+   * Call this once per frame from the render callback.
+   * @param timestamp The frame timestamp in nanoseconds, as passed in `FrameInfo.timestamp`.
+   */
+  update(timestamp: number): void
+}
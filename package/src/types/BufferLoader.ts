@@ -0,0 +1,29 @@
+import { FilamentBuffer } from '../native/FilamentBuffer'
+import { Listener } from './Listener'
+import { PointerHolder } from './PointerHolder'
+
+export type BufferLoadProgressCallback = (loadedBytes: number, totalBytes: number) => void
+
+/**
+ * Loads a local file into a {@linkcode FilamentBuffer} in fixed-size chunks on a background thread,
+ * reporting progress after every chunk and allowing the load to be cancelled between chunks.
+ *
+ * Releasing the loader also cancels its load.
+ */
+export interface BufferLoader extends PointerHolder {
+  /**
+   * Starts loading. Can only be called once.
+   * Rejects if the load has been cancelled, in which case the partially loaded data has already been freed.
+   */
+  load(): Promise<FilamentBuffer>
+  /**
+   * Adds a listener that is called after every loaded chunk.
+   */
+  addOnProgressListener(callback: BufferLoadProgressCallback): Listener
+  /**
+   * Cancels the load. No more chunks will be read.
+   */
+  cancel(): void
+  readonly loadedBytes: number
+  readonly totalBytes: number
+}
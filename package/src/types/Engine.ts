@@ -13,6 +13,7 @@ import { PointerHolder } from './PointerHolder'
 import { TFilamentRecorder } from './FilamentRecorder'
 import { SwapChain } from './SwapChain'
 import { NameComponentManager } from './NameComponentManager'
+import { AnimationMixer } from './AnimationMixer'
 import { CameraManipulator, OrbitCameraManipulatorConfig } from './CameraManipulator'
 
 export interface Engine extends PointerHolder {
@@ -34,6 +35,45 @@ export interface Engine extends PointerHolder {
    */
   loadInstancedAsset(buffer: FilamentBuffer, instanceCount: number): FilamentAsset
 
+  /**
+   * Given a {@linkcode FilamentBuffer} (e.g. from a .glb file), load the asset into the engine without blocking rendering.
+   * The asset is created and its textures are uploaded over the next frames, spending at most the budget set with
+   * {@linkcode setAssetLoadingFrameBudget} per frame. Textures are decoded in the background.
+   * Loads are only advanced while frames are being rendered.
+   * @param instanceCount If set, the asset will be created with this many instances (see {@linkcode loadInstancedAsset}).
+   * @param onProgress Called with the progress of the load in [0, 1] on the thread of the calling runtime.
+   */
+  loadAssetAsync(buffer: FilamentBuffer, instanceCount?: number, onProgress?: (progress: number) => void): Promise<FilamentAsset>
+
+  /**
+   * Sets how many milliseconds per frame may be spent on loading assets asynchronously (see {@linkcode loadAssetAsync}).
+   * @default 2
+   */
+  setAssetLoadingFrameBudget(milliseconds: number): void
+
+  /**
+   * Loads the given glTF buffer through the asset cache: Loading the same content again does not create a new asset,
+   * but a new instance of the already loaded one, which shares its textures, materials and geometry.
+   * The returned asset only refers to its own instance (entities, root, bounding box, animator).
+   * Once all assets returned for the same content have been released, the shared asset is destroyed.
+   * Note: `releaseSourceData()` has no effect on cached assets, as new instances are created from the source data.
+   */
+  loadCachedAsset(buffer: FilamentBuffer): FilamentAsset
+
+  /**
+   * Returns statistics about the asset cache (see {@linkcode loadCachedAsset}).
+   */
+  getAssetCacheStats(): {
+    hits: number
+    misses: number
+    /**
+     * Size in bytes of the glTF sources of all cached assets. The cache keeps a copy of each source to verify hits.
+     */
+    residentBytes: number
+    residentAssets: number
+    activeInstances: number
+  }
+
   /**
    * Set the indirect light for the scene.
    * @param iblBuffer A buffer containing the IBL data (e.g. from a .ktx file)
@@ -58,6 +98,10 @@ export interface Engine extends PointerHolder {
    * @private
    */
   createNameComponentManager(): NameComponentManager
+  /**
+   * Creates a mixer that plays the animations of multiple animators natively (see {@linkcode AnimationMixer}).
+   */
+  createAnimationMixer(): AnimationMixer
 
   /**
    * Per engine instance you only need one {@linkcode TransformManager}.
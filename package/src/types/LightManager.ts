@@ -1,7 +1,7 @@
 import { Entity } from './Entity'
 import { LightConfig, LightType, SpotLightExtraConfig } from './LightConfig'
 import { PointerHolder } from './PointerHolder'
-import { Float3 } from './Math'
+import { Float3, Float3Input } from './Math'
 
 /**
  * LightManager allows to create a light source in the scene, such as a sun or street lights.
@@ -30,7 +30,7 @@ export interface LightManager extends PointerHolder {
    *
    * @param position Light's position in world space. The default is at the origin.
    */
-  setPosition(entityWrapper: Entity, position: Float3[]): void
+  setPosition(entityWrapper: Entity, position: Float3Input): void
   /**
    * Returns the light's position in world space.
    */
@@ -41,7 +41,7 @@ export interface LightManager extends PointerHolder {
    * @param direction Light's direction in world space. Should be a unit vector.
    *                  The default is {0,-1,0}.
    */
-  setDirection(entityWrapper: Entity, direction: Float3[]): void
+  setDirection(entityWrapper: Entity, direction: Float3Input): void
   /**
    * Returns the light's direction in world space.
    */
@@ -52,7 +52,7 @@ export interface LightManager extends PointerHolder {
    * @param color Color of the light specified in the linear sRGB color-space.
    *              The default is white {1,1,1}.
    */
-  setColor(entityWrapper: Entity, linearSRGBColor: Float3[]): void
+  setColor(entityWrapper: Entity, linearSRGBColor: Float3Input): void
   /**
    * Returns the light's color in linear sRGB color-space.
    */
@@ -3,6 +3,12 @@
  */
 export type Float3 = [number, number, number]
 
+/**
+ * A {@link Float3}, or a `Float32Array` of 3 elements.
+ * Native APIs read a `Float32Array` directly instead of converting each element.
+ */
+export type Float3Input = Float3 | Float32Array
+
 export type Float2 = [number, number]
 
 export type Float4 = [number, number, number, number]
@@ -5,6 +5,14 @@
  * or implicitly when the JS garbage collector runs.
  *
  * Instances of {@linkcode PointerHolder} are always backed by a `jsi::HostObject`.
+ *
+ * Methods are shared by all instances of the same type and operate on the object they are called on (`this`),
+ * so calling a method that has been detached from its object throws an Error. Bind it first if you want to pass it around:
+ * ```ts
+ * const release = holder.release // ❌ throws when called
+ * const release = holder.release.bind(holder) // ✅
+ * const release = () => holder.release() // ✅
+ * ```
  */
 export interface PointerHolder {
   /**
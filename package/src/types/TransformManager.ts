@@ -1,31 +1,34 @@
 import { RigidBody } from '../bullet'
 import { Entity } from './Entity'
 import { PointerHolder } from './PointerHolder'
-import { Float3 } from './Math'
+import { Float3, Float3Input } from './Math'
 import { AABB } from './Boxes'
 
 /**
  * A 4x4 column-major matrix.
  */
 export interface Mat4 {
-  readonly data: number[]
+  /**
+   * The 16 elements of this matrix, in column-major order.
+   */
+  readonly data: Float32Array
   readonly scale: Float3
   readonly translation: Float3
 
   /**
    * Returns a new matrix that is the result of multiplying the provided scale matrix with this matrix.
    */
-  scaling(scale: Float3): Mat4
+  scaling(scale: Float3Input): Mat4
 
   /**
    * Returns a new matrix that is the result of multiplying the provided translation matrix with this matrix.
    */
-  translate(translation: Float3): Mat4
+  translate(translation: Float3Input): Mat4
 
   /**
    * Returns a new matrix that is the result of multiplying the provided rotation matrix with this matrix.
    */
-  rotate(angleRadians: number, axis: Float3): Mat4
+  rotate(angleRadians: number, axis: Float3Input): Mat4
 }
 
 /**
@@ -108,22 +111,48 @@ export interface TransformManager extends PointerHolder {
    * Sets the position of an entity.
    * @param multiplyCurrent If true, the new position will be multiplied with the current transform.
    */
-  setEntityPosition(entity: Entity, position: Float3, multiplyCurrent: boolean): void
+  setEntityPosition(entity: Entity, position: Float3Input, multiplyCurrent: boolean): void
 
   /**
    * Sets the rotation of an entity.
    * @param multiplyCurrent If true, the new rotation will be multiplied with the current transform.
    */
-  setEntityRotation(entity: Entity, angleRadians: number, axis: Float3, multiplyCurrent: boolean): void
+  setEntityRotation(entity: Entity, angleRadians: number, axis: Float3Input, multiplyCurrent: boolean): void
 
   /**
    * Sets the scale of an entity.
    * @param multiplyCurrent If true, the new scale will be multiplied with the current transform.
    */
-  setEntityScale(entity: Entity, scale: Float3, multiplyCurrent: boolean): void
+  setEntityScale(entity: Entity, scale: Float3Input, multiplyCurrent: boolean): void
+
+  /**
+   * Sets the local transforms of many entities at once, inside a single local transform transaction.
+   * This is much faster than calling {@link setTransform} for every entity.
+   * Must not be called while a local transform transaction is open.
+   * @param entityIds The {@link Entity.id}s of the entities to update
+   * @param matrices 16 floats (a column-major 4x4 matrix) per entity
+   */
+  setTransforms(entityIds: Int32Array | number[], matrices: Float32Array): void
+
+  /**
+   * Sets the translation of many entities at once, keeping their rotation and scale.
+   * Must not be called while a local transform transaction is open.
+   * @param entityIds The {@link Entity.id}s of the entities to update
+   * @param translations 3 floats (x, y, z) per entity
+   */
+  setTranslations(entityIds: Int32Array | number[], translations: Float32Array): void
+
+  /**
+   * Sets the local transforms of many entities at once from translation, rotation and scale.
+   * Must not be called while a local transform transaction is open.
+   * @param entityIds The {@link Entity.id}s of the entities to update
+   * @param transforms 10 floats per entity: translation (x, y, z), rotation quaternion (x, y, z, w) and scale (x, y, z)
+   */
+  setTransformsTRS(entityIds: Int32Array | number[], transforms: Float32Array): void
 
   /**
    * Updates the transform of an entity based on the rigid body's transform.
+   * To update many entities every frame, bind them to their bodies with `DiscreteDynamicWorld.bindEntity` instead.
    */
   updateTransformByRigidBody(entity: Entity, rigidBody: RigidBody): void
 }
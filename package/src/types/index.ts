@@ -8,6 +8,7 @@ export * from './View'
 export * from './SwapChain'
 export * from './Math'
 export { Animator as FilamentAnimator } from './Animator'
+export * from './AnimationMixer'
 export * from './FilamentInstanceBase'
 export * from './FilamentAsset'
 export * from './FilamentInstance'
@@ -22,6 +23,7 @@ export * from './LightManager'
 export * from './Color'
 export * from './TextureFlags'
 export * from './Choreographer'
+export * from './BufferLoader'
 export * from './NameComponentManager'
 export * from './CameraManipulator'
 export * from './FilamentRecorder'